@@ -215,6 +215,7 @@ HEADER_FILES = [
     'genoStru.h',
     'individual.h',
     'population.h',
+    'genealogy.h',
     'simulator.h',
     'mating.h',
     'operator.h',
@@ -237,6 +238,7 @@ SOURCE_FILES = [
     'genoStru.cpp',
     'individual.cpp',
     'population.cpp',
+    'genealogy.cpp',
     'simulator.cpp',
     'mating.cpp',
     'operator.cpp',
@@ -597,6 +599,8 @@ def ModuInfo(modu, SIMUPOP_VER, SIMUPOP_REV):
         res['libraries'].append('z')
     else:
         res['libraries'].append('z')
+        # for saving populations in background threads
+        res['libraries'].append('pthread')
         if USE_OPENMP:
             if USE_ICC:
                 res['libraries'].append('iomp5')
@@ -91,6 +91,7 @@ simuOptions = {
     'GUI': True,
     'Plotter': None,
     'NumThreads': 1,
+    'FirstTouch': False,
 }
 
 # Optimized: command line option --optimized or environmental variable SIMUOPTIMIZED
@@ -136,7 +137,8 @@ elif _gui is not None:
     print("Invalid value '%s' for environmental variable SIMUGUI or commandline option --gui." % _gui)
 
 def setOptions(alleleType=None, optimized=None, gui=None, quiet=None,
-        debug=None, version=None, revision=None, numThreads=None, plotter=None):
+        debug=None, version=None, revision=None, numThreads=None, firstTouch=None,
+        plotter=None):
     '''Set options before simuPOP is loaded to control which simuPOP module to
     load, and how the module should be loaded.
 
@@ -202,6 +204,15 @@ def setOptions(alleleType=None, optimized=None, gui=None, quiet=None,
         ``OMP_NUM_THREADS``). If this parameter is not set, the number of
         threads will be set to 1, or a value set by environmental variable
         ``OMP_NUM_THREADS``.
+
+    firstTouch
+        If set to ``True``, newly allocated genotype and information field
+        buffers of populations will be first written by the threads that
+        generate offspring into them so that memory pages are placed on the
+        NUMA nodes of these threads (Linux only). This can improve the
+        performance of multi-threaded simulations on multi-socket systems.
+        The policy is not used by default and can be changed at runtime using
+        function ``simuPOP.setOptions``.
     '''
     # if the module has already been imported, check which module
     # was imported
@@ -272,6 +283,11 @@ def setOptions(alleleType=None, optimized=None, gui=None, quiet=None,
         simuOptions['NumThreads'] = numThreads
     elif numThreads is not None:
         raise TypeError('An integer number is expected for parameter numThreads.')
+    # FirstTouch
+    if firstTouch in [True, False]:
+        simuOptions['FirstTouch'] = firstTouch
+    elif firstTouch is not None:
+        raise TypeError('True or False is expected for parameter firstTouch.')
     if plotter is not None:
         sys.stderr.write('WARNING: plotter option is deprecated because of the removal of rpy/rpy2 support\n')
 
@@ -206,6 +206,7 @@ __all__ = [
     'PyMlPenetrance',
     #
     'PyQuanTrait',
+    'AdditiveQuanTrait',
     #
     'Stat',
     #
@@ -294,6 +295,7 @@ __all__ = [
     'pyMlSelect',
     #
     'pyQuanTrait',
+    'additiveQuanTrait',
     #
     # For testing only
     'applyDuringMatingOperator',
@@ -371,6 +373,10 @@ if simuOptions['Revision'] is not None:
 if simuOptions['NumThreads'] is not None:
     setOptions(numThreads=simuOptions['NumThreads'])
 
+# place population buffers by first touch
+if simuOptions['FirstTouch']:
+    setOptions(firstTouch=1)
+
 if not simuOptions['Quiet']:
     info = moduleInfo()
     print("simuPOP Version %s : Copyright (c) 2004-2016 Bo Peng" %
@@ -1517,6 +1523,15 @@ def pyQuanTrait(pop, func, loci=[], ancGens=ALL_AVAIL, *args, **kwargs):
     PyQuanTrait(func, loci, ancGens, *args, **kwargs).apply(pop)
 
 
+def additiveQuanTrait(pop, loci, effects, dominance=[], envVar=0,
+        ancGens=ALL_AVAIL, *args, **kwargs):
+    '''Apply opertor ``AdditiveQuanTrait`` to population *pop*. Unlike the
+    operator form of this operator that only handles the current generation,
+    this function by default assign trait values to all generations.'''
+    AdditiveQuanTrait(loci, effects, dominance, envVar, ancGens, *args,
+        **kwargs).apply(pop)
+
+
 def discardIf(pop, *args, **kwargs):
     '''Apply operator ``DiscardIf`` to population *pop* to remove individuals according
     to an expression or a Python function.'''
@@ -0,0 +1,374 @@
+/**
+ *  $File: genealogy.cpp $
+ *  $LastChangedDate$
+ *  $Rev$
+ *
+ *  This file is part of simuPOP, a forward-time population genetics
+ *  simulation environment. Please visit http://simupop.sourceforge.net
+ *  for details.
+ *
+ *  Copyright (C) 2004 - 2010 Bo Peng (bpeng@mdanderson.org)
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "genealogy.h"
+#include "population.h"
+
+using std::min;
+using std::max;
+
+namespace simuPOP {
+
+namespace {
+
+bool edgeLess(const Genealogy::Edge & lhs, const Genealogy::Edge & rhs)
+{
+	if (lhs.parent != rhs.parent)
+		return lhs.parent < rhs.parent;
+	if (lhs.child != rhs.child)
+		return lhs.child < rhs.child;
+	return lhs.left < rhs.left;
+}
+
+
+// merge overlapping and adjacent segments
+void mergeSegments(vector<pairu> & segs)
+{
+	if (segs.size() < 2)
+		return;
+	std::sort(segs.begin(), segs.end());
+	size_t last = 0;
+	for (size_t i = 1; i < segs.size(); ++i) {
+		if (segs[i].first <= segs[last].second)
+			segs[last].second = max(segs[last].second, segs[i].second);
+		else
+			segs[++last] = segs[i];
+	}
+	segs.resize(last + 1);
+}
+
+
+}
+
+Genealogy::Genealogy(const string & idField, size_t simplifyInterval)
+	: m_idField(idField), m_simplifyInterval(simplifyInterval), m_time(0),
+	m_ploidy(0), m_numLoci(0), m_nodeID(), m_nodeTime(), m_edges(),
+	m_samples(), m_pending(numThreads())
+{
+}
+
+
+string Genealogy::describe(bool /* format */) const
+{
+	return (boost::format("<simuPOP.Genealogy> with %1% nodes and %2% edges over %3% generations")
+	        % m_nodeID.size() % m_edges.size() % m_time).str();
+}
+
+
+void Genealogy::addNodes(const Population & pop)
+{
+	size_t idIdx = pop.infoIdx(m_idField);
+
+	m_ploidy = pop.ploidy();
+	m_numLoci = pop.totNumLoci();
+	m_samples.clear();
+	ConstRawIndIterator it = pop.rawIndBegin();
+	ConstRawIndIterator it_end = pop.rawIndEnd();
+	for (; it != it_end; ++it) {
+		size_t id = toID(it->info(idIdx));
+		DBG_FAILIF(id == 0, ValueError,
+			"Individual ID is not set. Please use an IdTagger to assign unique IDs to individuals.");
+		for (size_t p = 0; p < m_ploidy; ++p) {
+			m_nodeID.push_back(id * m_ploidy + p);
+			m_nodeTime.push_back(m_time);
+			m_samples.push_back(id * m_ploidy + p);
+		}
+	}
+}
+
+
+void Genealogy::prepare()
+{
+	if (m_pending.size() < numThreads())
+		m_pending.resize(numThreads());
+}
+
+
+void Genealogy::addEdge(const Individual & parent, size_t parPloidy,
+                        size_t offIdx, size_t ploidy, size_t left, size_t right)
+{
+	if (left >= right)
+		return;
+#ifdef _OPENMP
+	vector<PendingEdge> & pending = m_pending[omp_get_thread_num()];
+#else
+	vector<PendingEdge> & pending = m_pending[0];
+#endif
+	// extend the last edge if the segment continues it
+	if (!pending.empty()) {
+		PendingEdge & last = pending.back();
+		if (last.parent == &parent && last.parPloidy == parPloidy && last.offIdx == offIdx
+		    && last.ploidy == ploidy && last.right == left) {
+			last.right = right;
+			return;
+		}
+	}
+	PendingEdge edge = { &parent, parPloidy, offIdx, ploidy, left, right };
+	pending.push_back(edge);
+}
+
+
+void Genealogy::commit(const Population & offPop)
+{
+	size_t idIdx = offPop.infoIdx(m_idField);
+
+	++m_time;
+	m_samples.clear();
+	ConstRawIndIterator offBegin = offPop.rawIndBegin();
+	ConstRawIndIterator it = offBegin;
+	ConstRawIndIterator it_end = offPop.rawIndEnd();
+	for (; it != it_end; ++it) {
+		size_t id = toID(it->info(idIdx));
+		DBG_FAILIF(id == 0, ValueError,
+			"Offspring ID is not set. Please use an IdTagger to assign unique IDs to offspring.");
+		for (size_t p = 0; p < m_ploidy; ++p) {
+			m_nodeID.push_back(id * m_ploidy + p);
+			m_nodeTime.push_back(m_time);
+			m_samples.push_back(id * m_ploidy + p);
+		}
+	}
+
+	for (size_t t = 0; t < m_pending.size(); ++t) {
+		vector<PendingEdge> & pending = m_pending[t];
+		for (size_t i = 0; i < pending.size(); ++i) {
+			const PendingEdge & pe = pending[i];
+			Edge edge;
+			edge.left = pe.left;
+			edge.right = pe.right;
+			edge.parent = toID(pe.parent->info(idIdx)) * m_ploidy + pe.parPloidy;
+			edge.child = toID((offBegin + pe.offIdx)->info(idIdx)) * m_ploidy + pe.ploidy;
+			DBG_FAILIF(edge.parent / m_ploidy == edge.child / m_ploidy, ValueError,
+				"Offspring has the same ID as its parent. Please apply an IdTagger after "
+				"operators that copy information fields from parents to offspring.");
+			m_edges.push_back(edge);
+		}
+		pending.clear();
+	}
+	prepare();
+
+	if (m_simplifyInterval > 0 && m_time % m_simplifyInterval == 0)
+		simplify(offPop);
+}
+
+
+void Genealogy::buildNodeMap(NodeMap & nodeMap) const
+{
+	nodeMap.clear();
+	for (size_t i = 0; i < m_nodeID.size(); ++i)
+		nodeMap[m_nodeID[i]] = i;
+}
+
+
+void Genealogy::sortEdges()
+{
+	if (m_edges.empty())
+		return;
+	std::sort(m_edges.begin(), m_edges.end(), edgeLess);
+	size_t last = 0;
+	for (size_t i = 1; i < m_edges.size(); ++i) {
+		Edge & prev = m_edges[last];
+		const Edge & cur = m_edges[i];
+		if (prev.parent == cur.parent && prev.child == cur.child && prev.right == cur.left)
+			prev.right = cur.right;
+		else
+			m_edges[++last] = cur;
+	}
+	m_edges.resize(last + 1);
+}
+
+
+PyObject * Genealogy::nodes() const
+{
+	PyObject * res = PyList_New(m_nodeID.size());
+
+	for (size_t i = 0; i < m_nodeID.size(); ++i)
+		PyList_SET_ITEM(res, i, Py_BuildValue("(kk)", static_cast<unsigned long>(m_nodeID[i]),
+				static_cast<unsigned long>(m_nodeTime[i])));
+	return res;
+}
+
+
+PyObject * Genealogy::edges() const
+{
+	PyObject * res = PyList_New(m_edges.size());
+
+	for (size_t i = 0; i < m_edges.size(); ++i) {
+		const Edge & e = m_edges[i];
+		PyList_SET_ITEM(res, i, Py_BuildValue("(kkkk)", static_cast<unsigned long>(e.left),
+				static_cast<unsigned long>(e.right), static_cast<unsigned long>(e.parent),
+				static_cast<unsigned long>(e.child)));
+	}
+	return res;
+}
+
+
+void Genealogy::simplify(const Population & pop)
+{
+	size_t idIdx = pop.infoIdx(m_idField);
+
+	NodeMap nodeMap;
+	buildNodeMap(nodeMap);
+
+	// ancestral segments carried by each node, starting from the whole
+	// genome of the present generation
+	vector<vector<pairu> > segs(m_nodeID.size());
+	m_samples.clear();
+	ConstRawIndIterator it = pop.rawIndBegin();
+	ConstRawIndIterator it_end = pop.rawIndEnd();
+	for (; it != it_end; ++it) {
+		size_t id = toID(it->info(idIdx));
+		for (size_t p = 0; p < m_ploidy; ++p) {
+			NodeMap::iterator nit = nodeMap.find(id * m_ploidy + p);
+			if (nit == nodeMap.end())
+				continue;
+			segs[nit->second].assign(1, pairu(0, m_numLoci));
+			m_samples.push_back(id * m_ploidy + p);
+		}
+	}
+
+	// process edges from the youngest to the oldest children so that all
+	// segments of a parent are collected before its own edges are visited.
+	// Parents are always older than their offspring.
+	vector<std::pair<size_t, size_t> > order(m_edges.size());
+	for (size_t i = 0; i < m_edges.size(); ++i) {
+		DBG_FAILIF(nodeMap.find(m_edges[i].child) == nodeMap.end(), SystemError,
+			"Child node of an edge is not in the node table.");
+		order[i] = std::pair<size_t, size_t>(nodeMap[m_edges[i].child], i);
+	}
+	std::sort(order.begin(), order.end());
+
+	vector<Edge> edges;
+	size_t lastChild = NOT_FOUND;
+	for (size_t i = order.size(); i > 0; --i) {
+		size_t childIdx = order[i - 1].first;
+		const Edge & e = m_edges[order[i - 1].second];
+		vector<pairu> & childSegs = segs[childIdx];
+		if (childIdx != lastChild) {
+			mergeSegments(childSegs);
+			lastChild = childIdx;
+		}
+		if (childSegs.empty())
+			continue;
+		NodeMap::iterator pit = nodeMap.find(e.parent);
+		DBG_FAILIF(pit == nodeMap.end(), SystemError,
+			"Parent node of an edge is not in the node table.");
+		for (size_t s = 0; s < childSegs.size(); ++s) {
+			size_t left = max(e.left, childSegs[s].first);
+			size_t right = min(e.right, childSegs[s].second);
+			if (left >= right)
+				continue;
+			Edge ne = { left, right, e.parent, e.child };
+			edges.push_back(ne);
+			segs[pit->second].push_back(pairu(left, right));
+		}
+	}
+
+	// keep only nodes that carry ancestral material
+	vectoru nodeID;
+	vectoru nodeTime;
+	for (size_t i = 0; i < m_nodeID.size(); ++i) {
+		if (segs[i].empty())
+			continue;
+		nodeID.push_back(m_nodeID[i]);
+		nodeTime.push_back(m_nodeTime[i]);
+	}
+	m_nodeID.swap(nodeID);
+	m_nodeTime.swap(nodeTime);
+	m_edges.swap(edges);
+	sortEdges();
+	DBG_DO(DBG_POPULATION, cerr << "Genealogy simplified to " << m_nodeID.size() << " nodes and "
+		                        << m_edges.size() << " edges" << endl);
+}
+
+
+PyObject * Genealogy::mutate(double rate) const
+{
+	DBG_FAILIF(rate < 0, ValueError, "Mutation rate should be non-negative.");
+
+	NodeMap nodeMap;
+	buildNodeMap(nodeMap);
+
+	// edges indexed by parent
+	vector<vectoru> children(m_nodeID.size());
+	for (size_t i = 0; i < m_edges.size(); ++i) {
+		NodeMap::iterator pit = nodeMap.find(m_edges[i].parent);
+		DBG_FAILIF(pit == nodeMap.end(), SystemError,
+			"Parent node of an edge is not in the node table.");
+		children[pit->second].push_back(i);
+	}
+	vector<bool> isSample(m_nodeID.size(), false);
+	for (size_t i = 0; i < m_samples.size(); ++i) {
+		NodeMap::iterator nit = nodeMap.find(m_samples[i]);
+		if (nit != nodeMap.end())
+			isSample[nit->second] = true;
+	}
+
+	// (position, edge index)
+	vector<std::pair<double, size_t> > mutants;
+	for (size_t i = 0; i < m_edges.size(); ++i) {
+		const Edge & e = m_edges[i];
+		size_t tp = m_nodeTime[nodeMap[e.parent]];
+		size_t tc = m_nodeTime[nodeMap[e.child]];
+		if (tc <= tp)
+			continue;
+		ULONG cnt = getRNG().randPoisson(rate * (e.right - e.left) * (tc - tp));
+		for (ULONG j = 0; j < cnt; ++j)
+			mutants.push_back(std::pair<double, size_t>(
+					e.left + getRNG().randUniform() * (e.right - e.left), i));
+	}
+	std::sort(mutants.begin(), mutants.end());
+
+	PyObject * res = PyList_New(mutants.size());
+	vectoru carriers;
+	vectoru stack;
+	for (size_t m = 0; m < mutants.size(); ++m) {
+		double pos = mutants[m].first;
+		size_t node = m_edges[mutants[m].second].child;
+		// all samples that inherit the mutated segment
+		carriers.clear();
+		stack.assign(1, nodeMap[node]);
+		while (!stack.empty()) {
+			size_t idx = stack.back();
+			stack.pop_back();
+			if (isSample[idx])
+				carriers.push_back(m_nodeID[idx]);
+			const vectoru & ce = children[idx];
+			for (size_t k = 0; k < ce.size(); ++k) {
+				const Edge & e = m_edges[ce[k]];
+				if (e.left <= pos && pos < e.right)
+					stack.push_back(nodeMap[e.child]);
+			}
+		}
+		std::sort(carriers.begin(), carriers.end());
+		PyObject * carrierList = PyList_New(carriers.size());
+		for (size_t k = 0; k < carriers.size(); ++k)
+			PyList_SET_ITEM(carrierList, k, PyLong_FromUnsignedLong(static_cast<unsigned long>(carriers[k])));
+		PyList_SET_ITEM(res, m, Py_BuildValue("(dkN)", pos, static_cast<unsigned long>(node), carrierList));
+	}
+	return res;
+}
+
+
+}
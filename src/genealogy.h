@@ -0,0 +1,217 @@
+/**
+ *  $File: genealogy.h $
+ *  $LastChangedDate$
+ *  $Rev$
+ *
+ *  This file is part of simuPOP, a forward-time population genetics
+ *  simulation environment. Please visit http://simupop.sourceforge.net
+ *  for details.
+ *
+ *  Copyright (C) 2004 - 2010 Bo Peng (bpeng@mdanderson.org)
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _GENEALOGY_H
+#define _GENEALOGY_H
+/**
+   \file
+   \brief head file of class Genealogy
+ */
+
+#include "utility.h"
+
+#if TR1_SUPPORT == 0
+#  include <map>
+#elif TR1_SUPPORT == 1
+#  include <unordered_map>
+#else
+#  include <tr1/unordered_map>
+#endif
+
+namespace simuPOP {
+
+class Individual;
+class Population;
+
+/** A genealogy records how haplotypes are inherited from parents to
+ *  offspring during evolution, in the form of a node table and an edge
+ *  table. Each homologous set of chromosomes of an individual is a node,
+ *  identified by <tt>ID * ploidy + p</tt> where \c ID is the value of an
+ *  information field that stores unique individual IDs (e.g. set by an
+ *  \c IdTagger) and \c p is the index of the homologous set. The time of a
+ *  node is the number of generations since recording started. Each edge
+ *  <tt>(left, right, parent, child)</tt> states that loci
+ *  <tt>[left, right)</tt> of node \c child are copied from node \c parent.
+ *
+ *  A genealogy is created by function <tt>Population.recordGenealogy</tt>
+ *  and is filled by genotype transmitters (\c MendelianGenoTransmitter,
+ *  \c SelfingGenoTransmitter, \c HaplodiploidGenoTransmitter,
+ *  \c CloneGenoTransmitter and \c Recombinator) during mating. Because only
+ *  the ancestry of the present generation is usually of interest, the
+ *  genealogy can be simplified (periodically, or by calling function
+ *  \c simplify) to remove nodes and edges that do not contribute genetic
+ *  material to the present generation. Neutral mutations can then be placed
+ *  on the recorded genealogy after evolution (function \c mutate) so that
+ *  only loci under selection need to be simulated forward in time.
+ */
+class Genealogy
+{
+public:
+	/// CPPONLY an inheritance edge
+	struct Edge
+	{
+		size_t left;
+		size_t right;
+		size_t parent;
+		size_t child;
+	};
+
+	/** CPPONLY Create an empty genealogy that uses information field
+	 *  \e idField to identify individuals and simplifies itself every
+	 *  \e simplifyInterval generations (\c 0 for no automatic
+	 *  simplification).
+	 */
+	Genealogy(const string & idField, size_t simplifyInterval);
+
+	/// CPPONLY
+	Genealogy * clone() const
+	{
+		return new Genealogy(*this);
+	}
+
+
+	/// HIDDEN
+	string describe(bool format = true) const;
+
+	/** CPPONLY Add all individuals in the present generation of \e pop as
+	 *  nodes at the current time, and mark them as samples.
+	 */
+	void addNodes(const Population & pop);
+
+	/** CPPONLY Make sure that there is an edge buffer for each thread. This
+	 *  function should be called before offspring are generated.
+	 */
+	void prepare();
+
+	/** CPPONLY Record that loci <tt>[left, right)</tt> of the \e ploidy-th
+	 *  homologous set of the \e offIdx-th offspring are copied from the
+	 *  \e parPloidy-th homologous set of \e parent. This function is called
+	 *  by genotype transmitters and can be called from multiple threads.
+	 *  Because offspring IDs might be assigned after genotype transmission,
+	 *  offspring are identified by their index in the offspring population.
+	 */
+	void addEdge(const Individual & parent, size_t parPloidy,
+		size_t offIdx, size_t ploidy, size_t left, size_t right);
+
+	/** CPPONLY Add all offspring in \e offPop as nodes of a new generation,
+	 *  and convert recorded edges to the edge table. This function should be
+	 *  called after offspring are generated, before \e offPop replaces
+	 *  its parental population.
+	 */
+	void commit(const Population & offPop);
+
+	/** Return the node table as a list of <tt>(node, time)</tt> pairs.
+	 */
+	PyObject * nodes() const;
+
+	/** Return the edge table as a list of <tt>(left, right, parent,
+	 *  child)</tt> tuples, sorted by parent, child and left position.
+	 */
+	PyObject * edges() const;
+
+	/** Return a list of nodes of the present generation, namely nodes of
+	 *  individuals in the population when the genealogy was last committed
+	 *  or simplified.
+	 */
+	vectoru samples() const
+	{
+		return m_samples;
+	}
+
+
+	/** Remove nodes and edges that do not contribute genetic material to
+	 *  individuals in the present generation of population \e pop, and
+	 *  trim the remaining edges to the inherited regions. Nodes of the
+	 *  present generation are marked as samples.
+	 */
+	void simplify(const Population & pop);
+
+	/** Place neutral mutations on the genealogy with \e rate mutations per
+	 *  locus per generation. Mutations are placed on each edge according to
+	 *  a Poisson distribution with mean <tt>rate * (right - left) *
+	 *  (time(child) - time(parent))</tt>, at positions uniformly distributed
+	 *  in <tt>[left, right)</tt>, so that a mutation at position \c x lies
+	 *  between loci <tt>int(x)</tt> and <tt>int(x) + 1</tt>. This function
+	 *  returns a list of <tt>(pos, node, carriers)</tt> where \c node is the
+	 *  child node of the edge on which the mutation happens, and \c carriers
+	 *  is a list of samples that inherit the mutation.
+	 */
+	PyObject * mutate(double rate) const;
+
+private:
+	struct PendingEdge
+	{
+		const Individual * parent;
+		size_t parPloidy;
+		size_t offIdx;
+		size_t ploidy;
+		size_t left;
+		size_t right;
+	};
+
+	/// map from node to its index in the node table
+#if TR1_SUPPORT == 0
+	typedef std::map<size_t, size_t> NodeMap;
+#elif TR1_SUPPORT == 1
+	typedef std::unordered_map<size_t, size_t> NodeMap;
+#else
+	typedef std::tr1::unordered_map<size_t, size_t> NodeMap;
+#endif
+
+	void buildNodeMap(NodeMap & nodeMap) const;
+
+	/// sort edges by parent, child and left, and merge adjacent edges
+	void sortEdges();
+
+private:
+	string m_idField;
+
+	size_t m_simplifyInterval;
+
+	/// number of committed generations
+	size_t m_time;
+
+	/// number of homologous sets of chromosomes
+	size_t m_ploidy;
+
+	/// total number of loci
+	size_t m_numLoci;
+
+	/// node table
+	vectoru m_nodeID;
+	vectoru m_nodeTime;
+
+	/// edge table
+	vector<Edge> m_edges;
+
+	/// present generation
+	vectoru m_samples;
+
+	/// edges recorded by each thread
+	vector<vector<PendingEdge> > m_pending;
+};
+
+}
+#endif
@@ -379,6 +379,11 @@ void GenoStruTrait::setGenoStructure(const GenoStructure & rhs)
 							             "recompile simuPOP.") % (MaxTraitIndex - 1)).str());
 	}
 
+	// reserve all slots so that adding a structure never moves existing
+	// ones, which might be read by populations saved in background threads
+	if (s_genoStruRepository.capacity() < MaxTraitIndex)
+		s_genoStruRepository.reserve(MaxTraitIndex);
+
 	if (m_genoStruIdx != MaxTraitIndex)
 		decGenoStruRef();
 
@@ -28,6 +28,7 @@
 #include <set>
 #include <map>
 #include <algorithm>
+#include <limits>
 using std::ostringstream;
 using std::setprecision;
 
@@ -39,12 +40,115 @@ extern "C" PyObject * PyDefDict_New();
 namespace simuPOP {
 
 
+IndBuffers::Buffers * IndBuffers::s_chunks[1 << (32 - IndBuffers::ChunkBits)];
+
+vector<UINT> IndBuffers::s_released;
+
+size_t IndBuffers::s_numUsed = 0;
+
+#ifdef MUTANTALLELE
+IndBuffers::IndBuffers(vectorm * geno, vectorf * info, vectori * lineage)
+#else
+IndBuffers::IndBuffers(vectora * geno, vectorf * info, vectori * lineage)
+#endif
+{
+	if (!s_released.empty()) {
+		m_idx = s_released.back();
+		s_released.pop_back();
+	} else {
+		if (s_numUsed > std::numeric_limits<UINT>::max())
+			throw SystemError("Too many populations or ancestral generations.");
+		m_idx = static_cast<UINT>(s_numUsed++);
+		if ((m_idx & ChunkMask) == 0)
+			s_chunks[m_idx >> ChunkBits] = new Buffers[ChunkMask + 1];
+	}
+	Buffers & buf = buffers(m_idx);
+	buf.geno = geno;
+	buf.ownGeno = geno;
+	buf.info = info;
+#ifdef LINEAGE
+	buf.lineage = lineage;
+#else
+	(void)lineage;
+#endif
+}
+
+
+IndBuffers::~IndBuffers()
+{
+	Buffers & buf = buffers(m_idx);
+
+	buf.geno = NULL;
+	buf.ownGeno = NULL;
+	buf.sharedGeno.reset();
+	buf.info = NULL;
+	LINEAGE_EXPR(buf.lineage = NULL);
+	s_released.push_back(m_idx);
+}
+
+
+void IndBuffers::swap(IndBuffers & rhs)
+{
+	Buffers & buf = buffers(m_idx);
+	Buffers & rhsBuf = buffers(rhs.m_idx);
+
+	std::swap(buf.ownGeno, rhsBuf.ownGeno);
+	std::swap(buf.info, rhsBuf.info);
+	LINEAGE_EXPR(std::swap(buf.lineage, rhsBuf.lineage));
+	buf.geno = buf.sharedGeno ? buf.sharedGeno.get() : buf.ownGeno;
+	rhsBuf.geno = rhsBuf.sharedGeno ? rhsBuf.sharedGeno.get() : rhsBuf.ownGeno;
+	std::swap(m_idx, rhs.m_idx);
+}
+
+
+void IndBuffers::makeGenotypeShared(size_t idx)
+{
+	Buffers & buf = buffers(idx);
+
+	if (buf.sharedGeno)
+		return;
+	buf.sharedGeno.reset(new GenoBuffer());
+	buf.sharedGeno->swap(*buf.ownGeno);
+	buf.geno = buf.sharedGeno.get();
+}
+
+
+void IndBuffers::shareGenotype(size_t idx)
+{
+	makeGenotypeShared(idx);
+	Buffers & buf = buffers(m_idx);
+	buf.sharedGeno = buffers(idx).sharedGeno;
+	buf.geno = buf.sharedGeno.get();
+}
+
+
+void IndBuffers::releaseGenotype()
+{
+	Buffers & buf = buffers(m_idx);
+
+	buf.sharedGeno.reset();
+	buf.geno = buf.ownGeno;
+}
+
+
+void IndBuffers::copySharedGenotype(Buffers & buf)
+{
+	// the last owner of shared genotypes takes them without copying
+	if (buf.sharedGeno.unique())
+		buf.ownGeno->swap(*buf.sharedGeno);
+	else
+		*buf.ownGeno = *buf.sharedGeno;
+	buf.sharedGeno.reset();
+	buf.geno = buf.ownGeno;
+}
+
+
 Individual & Individual::operator=(const Individual & rhs)
 {
 	m_flags = rhs.m_flags;
-	setGenoPtr(rhs.genoPtr());
-	setInfoPtr(rhs.infoPtr());
-	LINEAGE_EXPR(setLineagePtr(rhs.lineagePtr()));
+	m_bufferIdx = rhs.m_bufferIdx;
+	m_genoSlot = rhs.m_genoSlot;
+	m_infoSlot = rhs.m_infoSlot;
 	// also copy genoStru pointer...
 	this->setGenoStruIdx(rhs.genoStruIdx());
 	return *this;
@@ -54,6 +158,8 @@ Individual & Individual::operator=(const Individual & rhs)
 Individual & Individual::copyFrom(const Individual & rhs)
 {
 	m_flags = rhs.m_flags;
+	// positions of data depend on genotypic structure
+	this->setGenoStruIdx(rhs.genoStruIdx());
 #ifdef MUTANTALLELE
 	copyGenotype(rhs.genoBegin(), rhs.genoEnd(), genoBegin());
 #else
@@ -61,8 +167,6 @@ Individual & Individual::copyFrom(const Individual & rhs)
 #endif
 	copy(rhs.infoBegin(), rhs.infoEnd(), infoBegin());
 	LINEAGE_EXPR(copy(rhs.lineageBegin(), rhs.lineageEnd(), lineageBegin()));
-	// also copy genoStru pointer...
-	this->setGenoStruIdx(rhs.genoStruIdx());
 	return *this;
 }
 
@@ -84,16 +188,18 @@ bool Individual::operator==(const Individual & rhs) const
 	}
 
 #ifndef MUTANTALLELE
+	GenoIterator ptr = genoPtr();
+	GenoIterator rptr = rhs.genoPtr();
 	for (size_t i = 0, iEnd = genoSize(); i < iEnd; ++i)
-		if (*(m_genoPtr + i) != *(rhs.m_genoPtr + i))
+		if (*(ptr + i) != *(rptr + i))
 			return false;
 #else
-	vectorm::const_val_iterator it = m_genoPtr.get_val_iterator();
-	vectorm::const_val_iterator it_end = (m_genoPtr + genoSize()).get_val_iterator();
-	size_t s_idx = m_genoPtr.index();
-	vectorm::const_val_iterator rit = rhs.m_genoPtr.get_val_iterator();
-	vectorm::const_val_iterator rit_end = (rhs.m_genoPtr + genoSize()).get_val_iterator();
-	size_t rs_idx = rhs.m_genoPtr.index();
+	vectorm::const_val_iterator it = genoPtr().get_val_iterator();
+	vectorm::const_val_iterator it_end = (genoPtr() + genoSize()).get_val_iterator();
+	size_t s_idx = genoPtr().index();
+	vectorm::const_val_iterator rit = rhs.genoPtr().get_val_iterator();
+	vectorm::const_val_iterator rit_end = (rhs.genoPtr() + genoSize()).get_val_iterator();
+	size_t rs_idx = rhs.genoPtr().index();
 	for (; it != it_end; ++it, ++rit)
 		if (rit == rit_end || ((it->first - s_idx) != (rit->first - rs_idx)) || it->second != rit->second)
 			return false;
@@ -102,13 +208,17 @@ bool Individual::operator==(const Individual & rhs) const
 #endif
 
 #ifdef LINEAGE
+	LineageIterator lineage = lineagePtr();
+	LineageIterator rlineage = rhs.lineagePtr();
 	for (size_t i = 0, iEnd = genoSize(); i < iEnd; ++i)
-		if (*(m_lineagePtr + i) != *(rhs.m_lineagePtr + i))
+		if (*(lineage + i) != *(rlineage + i))
 			return false;
 #endif
 
+	InfoIterator info = infoPtr();
+	InfoIterator rinfo = rhs.infoPtr();
 	for (size_t i = 0, iEnd = infoSize(); i < iEnd; ++i)
-		if (*(m_infoPtr + i) != *(rhs.m_infoPtr + i)) {
+		if (*(info + i) != *(rinfo + i)) {
 			DBG_DO(DBG_POPULATION, cerr << "Information field " << infoField(i) << " differ" << endl);
 			return false;
 		}
@@ -165,16 +275,16 @@ ULONG Individual::allele(size_t idx, ssize_t p, ssize_t chrom) const
 		"A valid ploidy index has to be specified if chrom is non-positive");
 	if (p < 0) {
 		CHECKRANGEGENOSIZE(idx);
-		return static_cast<ULONG>(DEREF_ALLELE(m_genoPtr + idx));
+		return static_cast<ULONG>(DEREF_ALLELE(genoPtr() + idx));
 	} else if (chrom < 0) {
 		CHECKRANGEABSLOCUS(idx);
 		CHECKRANGEPLOIDY(static_cast<size_t>(p));
-		return static_cast<ULONG>(DEREF_ALLELE(m_genoPtr + idx + p * totNumLoci()));
+		return static_cast<ULONG>(DEREF_ALLELE(genoPtr() + idx + p * totNumLoci()));
 	} else {
 		CHECKRANGELOCUS(chrom, idx);
 		CHECKRANGEPLOIDY(static_cast<size_t>(p));
 		CHECKRANGECHROM(static_cast<size_t>(chrom));
-		return static_cast<ULONG>(DEREF_ALLELE(m_genoPtr + idx + p * totNumLoci() + chromBegin(chrom)));
+		return static_cast<ULONG>(DEREF_ALLELE(genoPtr() + idx + p * totNumLoci() + chromBegin(chrom)));
 	}
 }
 
@@ -186,16 +296,16 @@ long Individual::alleleLineage(size_t idx, ssize_t p, ssize_t chrom) const
 		"A valid ploidy index has to be specified if chrom is non-positive");
 	if (p < 0) {
 		CHECKRANGEGENOSIZE(idx);
-		return *(m_lineagePtr + idx);
+		return *(lineagePtr() + idx);
 	} else if (chrom < 0) {
 		CHECKRANGEABSLOCUS(idx);
 		CHECKRANGEPLOIDY(static_cast<size_t>(p));
-		return *(m_lineagePtr + idx + p * totNumLoci());
+		return *(lineagePtr() + idx + p * totNumLoci());
 	} else {
 		CHECKRANGELOCUS(chrom, idx);
 		CHECKRANGEPLOIDY(static_cast<size_t>(p));
 		CHECKRANGECHROM(static_cast<size_t>(chrom));
-		return *(m_lineagePtr + idx + p * totNumLoci() + chromBegin(chrom));
+		return *(lineagePtr() + idx + p * totNumLoci() + chromBegin(chrom));
 	}
 #else
 	(void)idx;
@@ -233,6 +343,8 @@ PyObject * Individual::genotype(const uintList & ply, const uintList & ch)
 		             "carray object that reflects the underlying genotype of an individual. "
 		             "It will become invalid once the population changes. Please use "
 		             "list(ind.genotype()) if you would like to keep a copy of genotypes");
+	// the returned object can change genotypes
+	IndBuffers::detachGenotype(m_bufferIdx);
 
 	size_t beginP = 0;
 	size_t endP = 0;
@@ -284,11 +396,11 @@ PyObject * Individual::genotype(const uintList & ply, const uintList & ch)
 		// has to be all chromosomes
 		DBG_FAILIF(beginCh != 0 || endCh != numChrom(), ValueError,
 			"If multiple ploidy are chosen, all chromosomes has to be chosen.");
-		return Allele_Vec_As_NumArray(m_genoPtr + beginP * totNumLoci(),
-			m_genoPtr + endP * totNumLoci());
+		return Allele_Vec_As_NumArray(genoPtr() + beginP * totNumLoci(),
+			genoPtr() + endP * totNumLoci());
 	} else
-		return Allele_Vec_As_NumArray(m_genoPtr + beginP * totNumLoci() + chromBegin(beginCh),
-			m_genoPtr + beginP * totNumLoci() + chromEnd(endCh - 1));
+		return Allele_Vec_As_NumArray(genoPtr() + beginP * totNumLoci() + chromBegin(beginCh),
+			genoPtr() + beginP * totNumLoci() + chromEnd(endCh - 1));
 }
 
 
@@ -304,7 +416,7 @@ pyMutantIterator Individual::mutants(const uintList & ply, const uintList & ch)
 	else {
 		const vectoru & ploidys = ply.elems();
 		if (ploidys.empty())
-			return pyMutantIterator(m_genoPtr, 0, 0, 1);
+			return pyMutantIterator(genoPtr(), 0, 0, 1);
 		beginP = ploidys[0];
 		endP = ploidys[0];
 		CHECKRANGEPLOIDY(static_cast<size_t>(beginP));
@@ -322,7 +434,7 @@ pyMutantIterator Individual::mutants(const uintList & ply, const uintList & ch)
 	else {
 		const vectoru & chroms = ch.elems();
 		if (chroms.empty())
-			return pyMutantIterator(m_genoPtr, 0, 0, 1);
+			return pyMutantIterator(genoPtr(), 0, 0, 1);
 		beginCh = chroms[0];
 		endCh = chroms[0];
 		CHECKRANGECHROM(static_cast<size_t>(beginCh));
@@ -340,10 +452,10 @@ pyMutantIterator Individual::mutants(const uintList & ply, const uintList & ch)
 		// has to be all chromosomes
 		DBG_FAILIF(beginCh != 0 || endCh != numChrom(), ValueError,
 			"If multiple ploidy are chosen, all chromosomes has to be chosen.");
-		return pyMutantIterator(m_genoPtr, beginP * totNumLoci(),
+		return pyMutantIterator(genoPtr(), beginP * totNumLoci(),
 			endP * totNumLoci(), genoSize());
 	} else
-		return pyMutantIterator(m_genoPtr, beginP * totNumLoci() + chromBegin(beginCh),
+		return pyMutantIterator(genoPtr(), beginP * totNumLoci() + chromBegin(beginCh),
 			beginP * totNumLoci() + chromEnd(endCh - 1), genoSize());
 }
 
@@ -406,11 +518,11 @@ PyObject * Individual::lineage(const uintList & ply, const uintList & ch)
 		// has to be all chromosomes
 		DBG_FAILIF(beginCh != 0 || endCh != numChrom(), ValueError,
 			"If multiple ploidy are chosen, all chromosomes has to be chosen.");
-		return Lineage_Vec_As_NumArray(m_lineagePtr + beginP * totNumLoci(),
-			m_lineagePtr + endP * totNumLoci());
+		return Lineage_Vec_As_NumArray(lineagePtr() + beginP * totNumLoci(),
+			lineagePtr() + endP * totNumLoci());
 	} else
-		return Lineage_Vec_As_NumArray(m_lineagePtr + beginP * totNumLoci() + chromBegin(beginCh),
-			m_lineagePtr + beginP * totNumLoci() + chromEnd(endCh - 1));
+		return Lineage_Vec_As_NumArray(lineagePtr() + beginP * totNumLoci() + chromBegin(beginCh),
+			lineagePtr() + beginP * totNumLoci() + chromEnd(endCh - 1));
 #else
 	(void)ply;
 	(void)ch;
@@ -436,8 +548,8 @@ PyObject * Individual::mutAtLoci(const lociList & lociList)
 		bool autosome_only = chromX() == -1 && chromY() == -1;
 		if (autosome_only) {
 
-			vectorm::const_val_iterator m_ptr = m_genoPtr.get_val_iterator();
-			vectorm::const_val_iterator m_end = (m_genoPtr + genoSize()).get_val_iterator();
+			vectorm::const_val_iterator m_ptr = genoPtr().get_val_iterator();
+			vectorm::const_val_iterator m_end = (genoPtr() + genoSize()).get_val_iterator();
 			for (; m_ptr != m_end; ++m_ptr) {
 				PyDict_SetItem(mutDict,
 					dkey = PyInt_FromLong(m_ptr->first % genoSize()),
@@ -448,8 +560,8 @@ PyObject * Individual::mutAtLoci(const lociList & lociList)
 		} else {
 			vector<ULONG> tmp_mutants(ply * totNumLoci(), 0);
 
-			vectorm::const_val_iterator m_ptr = m_genoPtr.get_val_iterator();
-			vectorm::const_val_iterator m_end = (m_genoPtr + genoSize()).get_val_iterator();
+			vectorm::const_val_iterator m_ptr = genoPtr().get_val_iterator();
+			vectorm::const_val_iterator m_end = (genoPtr() + genoSize()).get_val_iterator();
 			for (; m_ptr != m_end; ++m_ptr)
 				tmp_mutants[ m_ptr->first % genoSize() ] = m_ptr->second;
 
@@ -487,11 +599,12 @@ PyObject * Individual::mutAtLoci(const lociList & lociList)
 				if (chType == MITOCHONDRIAL && p > 0)
 					continue;
 				size_t k = p * totNumLoci() + chromBegin(ch);
+				GenoIterator ptr = genoPtr() + k;
 				for (size_t idx = 0; idx < numLoci(ch); ++idx) {
-					if (*(m_genoPtr + k + idx) != 0) {
+					if (*(ptr + idx) != 0) {
 						PyDict_SetItem(mutDict,
 							dkey = PyInt_FromLong(k + idx),
-							dval = PyInt_FromLong(*(m_genoPtr + k + idx)));
+							dval = PyInt_FromLong(*(ptr + idx)));
 						Py_DECREF(dkey);
 						Py_DECREF(dval);
 					}
@@ -545,8 +658,8 @@ PyObject * Individual::mutAtLoci(const lociList & lociList)
 				vectoru::const_iterator eit = sorted->end();
 				for (size_t p = 0; p < ploidy(); ++p) {
 					vectoru::const_iterator it = sorted->begin();
-					vectorm::const_val_iterator m_ptr = (m_genoPtr + (l + p * nLoci)).get_val_iterator();
-					vectorm::const_val_iterator m_end = (m_genoPtr + (h + 1 + p * nLoci)).get_val_iterator();
+					vectorm::const_val_iterator m_ptr = (genoPtr() + (l + p * nLoci)).get_val_iterator();
+					vectorm::const_val_iterator m_end = (genoPtr() + (h + 1 + p * nLoci)).get_val_iterator();
 					for (; m_ptr != m_end; ++m_ptr) {
 						size_t loc = m_ptr->first % nLoci;
 						// move it
@@ -607,8 +720,8 @@ PyObject * Individual::mutAtLoci(const lociList & lociList)
 				for (size_t i = 0; i < nLoci; ++i)
 					loci_map[loci[i]] = i;
 
-				vectorm::const_val_iterator m_ptr = m_genoPtr.get_val_iterator();
-				vectorm::const_val_iterator m_end = (m_genoPtr + genoSize()).get_val_iterator();
+				vectorm::const_val_iterator m_ptr = genoPtr().get_val_iterator();
+				vectorm::const_val_iterator m_end = (genoPtr() + genoSize()).get_val_iterator();
 				for (; m_ptr != m_end; ++m_ptr) {
 					size_t loc = m_ptr->first % genoSize();
 					size_t p = loc / totNumLoci();
@@ -685,8 +798,8 @@ PyObject * Individual::genoAtLoci(const lociList & lociList)
 		alleles.reserve(ply * totNumLoci());
 		vector<ULONG> tmp_alleles(ply * totNumLoci(), 0);
 
-		vectorm::const_val_iterator m_ptr = m_genoPtr.get_val_iterator();
-		vectorm::const_val_iterator m_end = (m_genoPtr + genoSize()).get_val_iterator();
+		vectorm::const_val_iterator m_ptr = genoPtr().get_val_iterator();
+		vectorm::const_val_iterator m_end = (genoPtr() + genoSize()).get_val_iterator();
 		for (; m_ptr != m_end; ++m_ptr)
 			tmp_alleles[ m_ptr->first % genoSize() ] = m_ptr->second;
 
@@ -759,8 +872,8 @@ PyObject * Individual::genoAtLoci(const lociList & lociList)
 			for (size_t i = 0; i < nLoci; ++i)
 				loci_map[loci[i]] = i;
 
-			vectorm::const_val_iterator m_ptr = m_genoPtr.get_val_iterator();
-			vectorm::const_val_iterator m_end = (m_genoPtr + genoSize()).get_val_iterator();
+			vectorm::const_val_iterator m_ptr = genoPtr().get_val_iterator();
+			vectorm::const_val_iterator m_end = (genoPtr() + genoSize()).get_val_iterator();
 			for (; m_ptr != m_end; ++m_ptr) {
 				size_t loc = m_ptr->first % genoSize();
 				size_t p = loc / totNumLoci();
@@ -817,31 +930,32 @@ PyObject * Individual::genoAtLoci(const lociList & lociList)
 
 void Individual::setAllele(ULONG allele, size_t idx, int p, int chrom)
 {
+	IndBuffers::detachGenotype(m_bufferIdx);
 	DBG_FAILIF(p < 0 && chrom >= 0, ValueError,
 		"A valid ploidy index has to be specified if chrom is non-positive");
 	if (p < 0) {
 		CHECKRANGEGENOSIZE(idx);
 #ifdef MUTANTALLELE
-		(m_genoPtr + idx).assignIfDiffer(allele);
+		(genoPtr() + idx).assignIfDiffer(allele);
 #else
-		*(m_genoPtr + idx) = TO_ALLELE(allele);
+		*(genoPtr() + idx) = TO_ALLELE(allele);
 #endif
 	} else if (chrom < 0) {
 		CHECKRANGEABSLOCUS(idx);
 		CHECKRANGEPLOIDY(static_cast<size_t>(p));
 #ifdef MUTANTALLELE
-		(m_genoPtr + idx + p * totNumLoci()).assignIfDiffer(allele);
+		(genoPtr() + idx + p * totNumLoci()).assignIfDiffer(allele);
 #else
-		*(m_genoPtr + idx + p * totNumLoci()) = TO_ALLELE(allele);
+		*(genoPtr() + idx + p * totNumLoci()) = TO_ALLELE(allele);
 #endif
 	} else {
 		CHECKRANGELOCUS(static_cast<size_t>(chrom), idx);
 		CHECKRANGEPLOIDY(static_cast<size_t>(p));
 		CHECKRANGECHROM(static_cast<size_t>(chrom));
 #ifdef MUTANTALLELE
-		(m_genoPtr + idx + p * totNumLoci() + chromBegin(chrom)).assignIfDiffer(allele);
+		(genoPtr() + idx + p * totNumLoci() + chromBegin(chrom)).assignIfDiffer(allele);
 #else
-		*(m_genoPtr + idx + p * totNumLoci() + chromBegin(chrom)) = TO_ALLELE(allele);
+		*(genoPtr() + idx + p * totNumLoci() + chromBegin(chrom)) = TO_ALLELE(allele);
 #endif
 	}
 }
@@ -854,16 +968,16 @@ void Individual::setAlleleLineage(long lineage, size_t idx, int p, int chrom)
 		"A valid ploidy index has to be specified if chrom is non-positive");
 	if (p < 0) {
 		CHECKRANGEGENOSIZE(idx);
-		*(m_lineagePtr + idx) = lineage;
+		*(lineagePtr() + idx) = lineage;
 	} else if (chrom < 0) {
 		CHECKRANGEABSLOCUS(idx);
 		CHECKRANGEPLOIDY(static_cast<size_t>(p));
-		*(m_lineagePtr + idx + p * totNumLoci()) = lineage;
+		*(lineagePtr() + idx + p * totNumLoci()) = lineage;
 	} else {
 		CHECKRANGELOCUS(static_cast<size_t>(chrom), idx);
 		CHECKRANGEPLOIDY(static_cast<size_t>(p));
 		CHECKRANGECHROM(static_cast<size_t>(chrom));
-		*(m_lineagePtr + idx + p * totNumLoci() + chromBegin(chrom)) = lineage;
+		*(lineagePtr() + idx + p * totNumLoci() + chromBegin(chrom)) = lineage;
 	}
 #else
 	(void)lineage;
@@ -876,6 +990,7 @@ void Individual::setAlleleLineage(long lineage, size_t idx, int p, int chrom)
 
 void Individual::setGenotype(const uintList & genoList, const uintList & ply, const uintList & ch)
 {
+	IndBuffers::detachGenotype(m_bufferIdx);
 	const vectoru & geno = genoList.elems();
 
 	size_t sz = geno.size();
@@ -908,7 +1023,7 @@ void Individual::setGenotype(const uintList & genoList, const uintList & ply, co
 		size_t p = ploidys[i];
 		for (size_t j = 0; j < chroms.size(); ++j) {
 			size_t chrom = chroms[j];
-			GenoIterator ptr = m_genoPtr + p * totNumLoci() + chromBegin(chrom);
+			GenoIterator ptr = genoPtr() + p * totNumLoci() + chromBegin(chrom);
 
 #ifdef MUTANTALLELE
 			vectorm ctmp;
@@ -964,7 +1079,7 @@ void Individual::setLineage(const uintList & lineageList, const uintList & ply,
 		size_t p = ploidys[i];
 		for (size_t j = 0; j < chroms.size(); ++j) {
 			size_t chrom = chroms[j];
-			LineageIterator ptr = m_lineagePtr + p * totNumLoci() + chromBegin(chrom);
+			LineageIterator ptr = lineagePtr() + p * totNumLoci() + chromBegin(chrom);
 
 			for (size_t i = 0; i < numLoci(chrom); i++, ++idx)
 				*(ptr + i) = static_cast<long>(lineage[idx % sz]);
@@ -983,56 +1098,37 @@ void Individual::swap(Individual & ind, bool swapContent)
 	if (genoStruIdx() != ind.genoStruIdx())
 		throw SystemError("Can only swap individuals with different geno structure.");
 
-	std::swap(m_infoPtr, ind.m_infoPtr);
+	// individuals in different buffers can only exchange their data
+	if (m_bufferIdx != ind.m_bufferIdx) {
+		DBG_FAILIF(!swapContent, SystemError,
+			"Can only swap the content of individuals in different populations.");
+		std::swap_ranges(infoBegin(), infoEnd(), ind.infoBegin());
+	} else
+		std::swap(m_infoSlot, ind.m_infoSlot);
 
 	if (swapContent) {
+		IndBuffers::detachGenotype(m_bufferIdx);
+		IndBuffers::detachGenotype(ind.m_bufferIdx);
 		Allele tmp;
+		GenoIterator ptr = genoPtr();
+		GenoIterator indPtr = ind.genoPtr();
 		LINEAGE_EXPR(long tmpLineage);
 		for (size_t i = 0, iEnd = genoSize(); i < iEnd; i++) {
-			tmp = DEREF_ALLELE(m_genoPtr + i);
-			REF_ASSIGN_ALLELE(m_genoPtr + i, DEREF_ALLELE(ind.m_genoPtr + i));
-			REF_ASSIGN_ALLELE(ind.m_genoPtr + i, tmp);
+			tmp = DEREF_ALLELE(ptr + i);
+			REF_ASSIGN_ALLELE(ptr + i, DEREF_ALLELE(indPtr + i));
+			REF_ASSIGN_ALLELE(indPtr + i, tmp);
 		}
 #ifdef LINEAGE
+		LineageIterator lineage = lineagePtr();
+		LineageIterator indLineage = ind.lineagePtr();
 		for (size_t i = 0, iEnd = genoSize(); i < iEnd; i++) {
-			tmpLineage = m_lineagePtr[i];
-			m_lineagePtr[i] = ind.m_lineagePtr[i];
-			ind.m_lineagePtr[i] = tmpLineage;
+			tmpLineage = lineage[i];
+			lineage[i] = indLineage[i];
+			indLineage[i] = tmpLineage;
 		}
 #endif
-	} else {
-		std::swap(m_genoPtr, ind.m_genoPtr);
-		LINEAGE_EXPR(std::swap(m_lineagePtr, ind.m_lineagePtr));
-	}
-}
-
-
-void Individual::display(ostream & out, int width, const vectoru & loci, const vectoru & infoIdx)
-{
-	out << (sex() == MALE ? 'M' : 'F') << (affected() ? 'A' : 'U') << " ";
-	int pEnd = ploidy();
-	for (int p = 0; p < pEnd; ++p) {
-		if (loci.empty()) {
-			for (ssize_t ch = 0, chEnd = numChrom(); ch < chEnd; ++ch) {
-				for (size_t j = 0, jEnd = numLoci(ch); j < jEnd; ++j)
-					out << setw(width) << alleleChar(j, p, ch);
-				out << " ";
-			}
-		} else {
-			for (vectoru::const_iterator loc = loci.begin(); loc != loci.end(); ++loc)
-				out << setw(width) << alleleChar(*loc, p);
-			out << " ";
-		}
-
-		if (p != pEnd - 1)
-			out << "| ";
-	}
-	if (infoSize() != 0) {
-		out << "| ";
-		for (vectoru::const_iterator info = infoIdx.begin();
-			info != infoIdx.end(); ++info)
-			out << " " << *(infoBegin() + *info);
-	}
+	} else
+		std::swap(m_genoSlot, ind.m_genoSlot);
 }
 
 
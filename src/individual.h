@@ -35,6 +35,8 @@
 #include "simuPOP_cfg.h"
 #include "genoStru.h"
 
+#include <boost/shared_ptr.hpp>
+
 #include <iterator>
 using std::ostream;
 using std::ostream_iterator;
@@ -52,6 +54,138 @@ using std::pair;
 
 namespace simuPOP {
 
+/** CPPONLY
+ *  Genotypes, lineages and information fields of a generation of individuals
+ *  are stored in vectors owned by a population (or one of its ancestral
+ *  generations). Individuals do not store pointers to these vectors. They
+ *  store the index of the vectors in a global repository and the slots (in
+ *  units of individual genotype and info sizes) of their data, so that
+ *  reallocating or swapping the vectors does not require updating individuals.
+ *  An \c IndBuffers object registers the vectors of its owner and releases
+ *  them upon destruction. If the vectors of two owners are swapped together
+ *  with their individuals, their \c IndBuffers objects should be swapped so
+ *  that the individuals still refer to their own data.
+ *
+ *  Identical genotypes of several generations, for example of replicates
+ *  of a population, can be shared in a reference-counted vector instead of
+ *  being stored in the vectors of their owners. The genotypes are copied to
+ *  the vector of an owner (detached) before they are changed.
+ */
+class IndBuffers
+{
+public:
+#ifdef MUTANTALLELE
+	typedef vectorm GenoBuffer;
+#else
+	typedef vectora GenoBuffer;
+#endif
+
+	/// vectors that hold the data of a generation of individuals
+	struct Buffers
+	{
+		/// genotypes of individuals, which is either ownGeno or sharedGeno
+		GenoBuffer * geno;
+#ifdef LINEAGE
+		vectori * lineage;
+#endif
+		vectorf * info;
+		/// genotype vector of the owner
+		GenoBuffer * ownGeno;
+		/// genotypes shared with other owners, if any
+		boost::shared_ptr<GenoBuffer> sharedGeno;
+	};
+
+#ifdef MUTANTALLELE
+	IndBuffers(vectorm * geno, vectorf * info, vectori * lineage = NULL);
+#else
+	IndBuffers(vectora * geno, vectorf * info, vectori * lineage = NULL);
+#endif
+
+	~IndBuffers();
+
+	/// index of the registered vectors
+	size_t index() const
+	{
+		return m_idx;
+	}
+
+
+	/// exchange registered vectors with \e rhs, along with their indexes.
+	/// Shared genotypes stay with the individuals that refer to them.
+	void swap(IndBuffers & rhs);
+
+	/// move the genotypes registered at index \e idx to a shared vector,
+	/// unless they are already shared.
+	static void makeGenotypeShared(size_t idx);
+
+	/** Share the genotypes registered at index \e idx, which are moved to a
+	 *  shared vector if they are not shared yet. The genotype vector of the
+	 *  owner of this object should be empty.
+	 */
+	void shareGenotype(size_t idx);
+
+	/// if the genotypes of this object are shared with other owners
+	bool sharesGenotype() const
+	{
+		return buffers(m_idx).sharedGeno.get() != NULL;
+	}
+
+
+	/** Copy shared genotypes to the genotype vector of the owner, which is
+	 *  needed before the genotypes are changed. Nothing is done if the
+	 *  genotypes are not shared.
+	 */
+	void detachGenotype() const
+	{
+		detachGenotype(m_idx);
+	}
+
+
+	/// detach genotypes registered at index \e idx.
+	static void detachGenotype(size_t idx)
+	{
+		if (buffers(idx).sharedGeno)
+			copySharedGenotype(buffers(idx));
+	}
+
+
+	/** Stop sharing genotypes without copying them, which is needed if the
+	 *  genotypes of the owner are to be discarded.
+	 */
+	void releaseGenotype();
+
+
+	/// vectors registered at index \e idx
+	static Buffers & buffers(size_t idx)
+	{
+		return s_chunks[idx >> ChunkBits][idx & ChunkMask];
+	}
+
+
+private:
+	IndBuffers(const IndBuffers &);
+
+	IndBuffers & operator=(const IndBuffers &);
+
+	static void copySharedGenotype(Buffers & buf);
+
+	UINT m_idx;
+
+	// the repository is allocated in chunks that are never moved so that
+	// individuals of a population that is being saved in a background thread
+	// can be accessed while other populations are created.
+	static const size_t ChunkBits = 16;
+	static const size_t ChunkMask = (1 << ChunkBits) - 1;
+
+	static Buffers * s_chunks[1 << (32 - ChunkBits)];
+
+	/// released indexes that can be reused
+	static vector<UINT> s_released;
+
+	/// number of indexes that have been used
+	static size_t s_numUsed;
+};
+
 
 /** this class implements a Python itertor class that can be used to iterate
  *  through individuals in a (sub)population. If allInds are true,
@@ -193,7 +327,7 @@ public:
 	 * from a \c Population object using functions such as
 	 * <tt>Population::Individual(idx)</tt>.
 	 */
-	Individual() : m_flags(m_flagVisible)
+	Individual() : m_flags(m_flagVisible), m_bufferIdx(0), m_genoSlot(0), m_infoSlot(0)
 	{
 	}
 
@@ -201,11 +335,9 @@ public:
 	/// CPPONLY
 	Individual(const Individual & ind) :
 		GenoStruTrait(ind), m_flags(ind.m_flags),
-		m_genoPtr(ind.m_genoPtr),
-#ifdef LINEAGE
-		m_lineagePtr(ind.m_lineagePtr),
-#endif
-		m_infoPtr(ind.m_infoPtr)
+		m_bufferIdx(ind.m_bufferIdx),
+		m_genoSlot(ind.m_genoSlot),
+		m_infoSlot(ind.m_infoSlot)
 	{
 	}
 
@@ -216,27 +348,54 @@ public:
 	}
 
 
-	/// CPPONLY set genotype pointer (use if Allele*pos can not be determined during construction)
-	void setGenoPtr(GenoIterator pos)
+	/// CPPONLY set the buffers (by index to \c IndBuffers) that hold the data of this individual
+	void setBufferIdx(size_t idx)
 	{
-		m_genoPtr = pos;
+		m_bufferIdx = static_cast<UINT>(idx);
 	}
 
 
-#ifdef LINEAGE
-	/// CPPONLY set lineage pointer
-	void setLineagePtr(LineageIterator pos)
+	/// CPPONLY set the position of genotype (and lineage), in units of genoSize()
+	void setGenoSlot(size_t slot)
 	{
-		m_lineagePtr = pos;
+		m_genoSlot = static_cast<UINT>(slot);
 	}
 
 
-#endif
+	/// CPPONLY set the position of information fields, in units of infoSize()
+	void setInfoSlot(size_t slot)
+	{
+		m_infoSlot = static_cast<UINT>(slot);
+	}
+
+
+	/// CPPONLY set buffers and positions of genotype and information fields
+	void setSlot(size_t idx, size_t slot)
+	{
+		m_bufferIdx = static_cast<UINT>(idx);
+		m_genoSlot = static_cast<UINT>(slot);
+		m_infoSlot = static_cast<UINT>(slot);
+	}
 
-	/// CPPONLY set pointer to individual info
-	void setInfoPtr(InfoIterator pos)
+
+	/// CPPONLY
+	size_t bufferIdx() const
+	{
+		return m_bufferIdx;
+	}
+
+
+	/// CPPONLY
+	size_t genoSlot() const
+	{
+		return m_genoSlot;
+	}
+
+
+	/// CPPONLY
+	size_t infoSlot() const
 	{
-		m_infoPtr = pos;
+		return m_infoSlot;
 	}
 
 
@@ -253,7 +412,7 @@ public:
 	/// CPPONLY pointer to alleles
 	GenoIterator genoPtr() const
 	{
-		return m_genoPtr;
+		return IndBuffers::buffers(m_bufferIdx).geno->begin() + static_cast<size_t>(m_genoSlot) * genoSize();
 	}
 
 
@@ -261,7 +420,7 @@ public:
 	/// CPPONLY pointer to lineage
 	LineageIterator lineagePtr() const
 	{
-		return m_lineagePtr;
+		return IndBuffers::buffers(m_bufferIdx).lineage->begin() + static_cast<size_t>(m_genoSlot) * genoSize();
 	}
 
 
@@ -270,7 +429,7 @@ public:
 	/// CPPONLY
 	InfoIterator infoPtr() const
 	{
-		return m_infoPtr;
+		return IndBuffers::buffers(m_bufferIdx).info->begin() + static_cast<size_t>(m_infoSlot) * infoSize();
 	}
 
 
@@ -514,7 +673,7 @@ public:
 		size_t idx = field.empty() ? field.value() : infoIdx(field.name());
 
 		CHECKRANGEINFO(idx);
-		return m_infoPtr[idx];
+		return infoPtr()[idx];
 	}
 
 
@@ -527,7 +686,7 @@ public:
 		size_t idx = field.empty() ? field.value() : infoIdx(field.name());
 
 		CHECKRANGEINFO(idx);
-		return static_cast<int>(m_infoPtr[idx]);
+		return static_cast<int>(infoPtr()[idx]);
 	}
 
 
@@ -542,27 +701,21 @@ public:
 		size_t idx = field.empty() ? field.value() : infoIdx(field.name());
 
 		CHECKRANGEINFO(idx);
-		m_infoPtr[idx] = value;
+		infoPtr()[idx] = value;
 	}
 
 
 	/// CPPONLY start of alleles
 	GenoIterator genoBegin() const
 	{
-#ifdef MUTANTALLELE
-		// Call + operator in order to find the correct m_com_index;
-		// more information see operator+ function in vectorm.h
-		return m_genoPtr + 0;
-#else
-		return m_genoPtr;
-#endif
+		return genoPtr();
 	}
 
 
 	/// CPPONLY end of allele
 	GenoIterator genoEnd() const
 	{
-		return m_genoPtr + genoSize();
+		return genoPtr() + genoSize();
 	}
 
 
@@ -570,14 +723,14 @@ public:
 	/// CPPONLY start of lineage
 	LineageIterator lineageBegin() const
 	{
-		return m_lineagePtr;
+		return lineagePtr();
 	}
 
 
 	/// CPPONLY end of lineage
 	LineageIterator lineageEnd() const
 	{
-		return m_lineagePtr + genoSize();
+		return lineagePtr() + genoSize();
 	}
 
 
@@ -587,7 +740,7 @@ public:
 	GenoIterator genoBegin(size_t p) const
 	{
 		CHECKRANGEPLOIDY(p);
-		return m_genoPtr + p * totNumLoci();
+		return genoPtr() + p * totNumLoci();
 
 	}
 
@@ -596,7 +749,7 @@ public:
 	GenoIterator genoEnd(size_t p) const
 	{
 		CHECKRANGEPLOIDY(p);
-		return m_genoPtr + (p + 1) * totNumLoci();
+		return genoPtr() + (p + 1) * totNumLoci();
 	}
 
 
@@ -605,7 +758,7 @@ public:
 	LineageIterator lineageBegin(size_t p) const
 	{
 		CHECKRANGEPLOIDY(p);
-		return m_lineagePtr + p * totNumLoci();
+		return lineagePtr() + p * totNumLoci();
 
 	}
 
@@ -614,7 +767,7 @@ public:
 	LineageIterator lineageEnd(size_t p) const
 	{
 		CHECKRANGEPLOIDY(p);
-		return m_lineagePtr + (p + 1) * totNumLoci();
+		return lineagePtr() + (p + 1) * totNumLoci();
 	}
 
 
@@ -625,7 +778,7 @@ public:
 	{
 		CHECKRANGEPLOIDY(p);
 		CHECKRANGECHROM(chrom);
-		return m_genoPtr + p * totNumLoci() + chromBegin(chrom);
+		return genoPtr() + p * totNumLoci() + chromBegin(chrom);
 
 	}
 
@@ -635,7 +788,7 @@ public:
 	{
 		CHECKRANGEPLOIDY(p);
 		CHECKRANGECHROM(chrom);
-		return m_genoPtr + p * totNumLoci() + chromEnd(chrom);
+		return genoPtr() + p * totNumLoci() + chromEnd(chrom);
 
 	}
 
@@ -646,7 +799,7 @@ public:
 	{
 		CHECKRANGEPLOIDY(p);
 		CHECKRANGECHROM(chrom);
-		return m_lineagePtr + p * totNumLoci() + chromBegin(chrom);
+		return lineagePtr() + p * totNumLoci() + chromBegin(chrom);
 
 	}
 
@@ -656,7 +809,7 @@ public:
 	{
 		CHECKRANGEPLOIDY(p);
 		CHECKRANGECHROM(chrom);
-		return m_lineagePtr + p * totNumLoci() + chromEnd(chrom);
+		return lineagePtr() + p * totNumLoci() + chromEnd(chrom);
 
 	}
 
@@ -666,14 +819,14 @@ public:
 	/// CPPONLY start of info
 	InfoIterator infoBegin() const
 	{
-		return m_infoPtr;
+		return infoPtr();
 	}
 
 
 	/// CPPONLY end of info
 	InfoIterator infoEnd() const
 	{
-		return m_infoPtr + infoSize();
+		return infoPtr() + infoSize();
 	}
 
 
@@ -715,9 +868,10 @@ public:
 	/// @name misc (only relevant to developers)
 	//@{
 
-	/// CPPONLY
-	void display(ostream & out, int width = 1, const vectoru & loci = vectoru(),
-		const vectoru & infoIdx = vectoru());
+	/** CPPONLY whether or not locus \e idx on the \e p-th homologous copy of
+	 *  chromosome \e ch exists (e.g. not the second copy of chromosome Y).
+	 */
+	bool validIndex(size_t idx, size_t p, size_t ch) const;
 
 	//@}
 
@@ -726,8 +880,6 @@ private:
 
 	bool validIndex(size_t idx, size_t p) const;
 
-	bool validIndex(size_t idx, size_t p, size_t ch) const;
-
 	friend class boost::serialization::access;
 
 	template<class Archive>
@@ -765,16 +917,16 @@ protected:
 	// bitset<3> was previously used but that will take 4 bytes.
 	mutable unsigned char m_flags;
 
-	/// pointer to genotype.
-	GenoIterator m_genoPtr;
+	/// index of the buffers that hold the data of this individual. Pointers
+	/// are not used to save RAM (16 vs 24 or 32 bytes per individual) and
+	/// to avoid updating individuals when the buffers are reallocated.
+	UINT m_bufferIdx;
 
-#ifdef LINEAGE
-	/// pointer to lineage.
-	LineageIterator m_lineagePtr;
-#endif
+	/// position of genotype and lineage in the buffers
+	UINT m_genoSlot;
 
-	/// pointer to info
-	InfoIterator m_infoPtr;
+	/// position of information fields in the buffers
+	UINT m_infoSlot;
 };
 
 
@@ -62,9 +62,26 @@ bool InitSex::apply(Population & pop) const
 			prop[1] = 1 - prop[0];
 			ws.set(prop.begin(), prop.end());
 		}
+		size_t sexSz = m_sex.size();
+		if (!sp->isVirtual()) {
+			// all individuals of a subpopulation are set by index, in parallel
+			const ssize_t spSize = static_cast<ssize_t>(pop.subPopSize(sp->subPop()));
+			RawIndIterator ind = pop.rawIndBegin(sp->subPop());
+			if (!m_sex.empty()) {
+#pragma omp parallel for if(numThreads() > 1)
+				for (ssize_t i = 0; i < spSize; ++i)
+					(ind + i)->setSex(m_sex[(idx + i) % sexSz] == 1 ? MALE : FEMALE);
+				idx += spSize;
+			} else {
+				// each thread draws for a block of individuals from its own RNG
+#pragma omp parallel for if(numThreads() > 1)
+				for (ssize_t i = 0; i < spSize; ++i)
+					(ind + i)->setSex(ws.draw() == 0 ? MALE : FEMALE);
+			}
+			continue;
+		}
 		pop.activateVirtualSubPop(*sp);
 		IndIterator ind = pop.indIterator(sp->subPop());
-		size_t sexSz = m_sex.size();
 		if (!m_sex.empty())
 			for (; ind.valid(); ++ind, ++idx)
 				ind->setSex(m_sex[idx % sexSz] == 1 ? MALE : FEMALE);
@@ -123,8 +140,19 @@ bool InitInfo::apply(Population & pop) const
 	const vectorf & values = m_values.elems();
 
 	for (; sp != sp_end; ++sp) {
-		pop.activateVirtualSubPop(*sp);
 		size_t numValues = m_values.size();
+		if (!values.empty() && !sp->isVirtual()) {
+			// all individuals of a subpopulation are set by index, in parallel
+			const ssize_t spSize = static_cast<ssize_t>(pop.subPopSize(sp->subPop()));
+			RawIndIterator ind = pop.rawIndBegin(sp->subPop());
+#pragma omp parallel for if(numThreads() > 1)
+			for (ssize_t i = 0; i < spSize; ++i)
+				for (size_t j = 0; j < infoIdx.size(); ++j)
+					(ind + i)->setInfo(values[(idx + i) % numValues], infoIdx[j]);
+			idx += spSize;
+			continue;
+		}
+		pop.activateVirtualSubPop(*sp);
 		if (numThreads() > 1 && !values.empty()) {
 #ifdef _OPENMP
 #  pragma omp parallel firstprivate (idx)
@@ -252,6 +280,7 @@ vectorf InitGenotype::getFreqOrProp(size_t locus, const vspID & vsp) const
 
 bool InitGenotype::apply(Population & pop) const
 {
+	pop.detachGenotype();
 	const subPopList subPops = applicableSubPops(pop);
 
 	const vectoru & loci = m_loci.elems(&pop);
@@ -315,6 +315,17 @@ void OffspringGenerator::initialize(const Population &pop, size_t /* subPop */)
 	m_initialized = true;
 }
 
+void OffspringGenerator::prepareOffspring(Population &pop, Population &offPop,
+										  RawIndIterator offBegin, RawIndIterator offEnd)
+{
+	opList::const_iterator iop = m_transmitters.begin();
+	opList::const_iterator iopEnd = m_transmitters.end();
+
+	for (; iop != iopEnd; ++iop)
+		if ((*iop)->isActive(pop.rep(), pop.gen()))
+			(*iop)->prepareDuringMating(pop, offPop, offBegin, offEnd);
+}
+
 string OffspringGenerator::describe(bool format) const
 {
 	string desc = "<simuPOP.OffspringGenerator> produces offspring using operators\n<ul>\n";
@@ -945,54 +956,114 @@ void PolyParentsChooser::initialize(Population &pop, size_t subPop)
 	m_numMale = 0;
 	m_numFemale = 0;
 #ifdef _OPENMP
-	for (size_t i = 0; i < m_polyCount.size(); i++)
-		m_polyCount[i] = 0;
+	// the number of threads might have been changed since this parent
+	// chooser was created, and each thread keeps its own polygamy cycle.
+	m_polyCount.assign(numThreads(), 0);
+	m_lastParent.assign(numThreads(), NULL);
 #else
 	m_polyCount = 0;
 #endif
 
-	IndIterator it = pop.indIterator(subPop);
-	for (; it.valid(); ++it)
-	{
-		if (it->sex() == MALE)
-			m_numMale++;
-		else
-			m_numFemale++;
-	}
-
-	// allocate memory at first for performance reasons
-	m_maleIndex.resize(m_numMale);
-	m_femaleIndex.resize(m_numFemale);
-
 	m_selection = pop.hasInfoField(m_selectionField);
+	size_t fit_id = m_selection ? pop.infoIdx(m_selectionField) : 0;
 
-	size_t fit_id = 0;
-	if (m_selection)
+	if (pop.hasActivatedVirtualSubPop(subPop))
 	{
-		fit_id = pop.infoIdx(m_selectionField);
-		m_maleFitness.resize(m_numMale);
-		m_femaleFitness.resize(m_numFemale);
-	}
+		IndIterator it = pop.indIterator(subPop);
+		for (; it.valid(); ++it)
+		{
+			if (it->sex() == MALE)
+				m_numMale++;
+			else
+				m_numFemale++;
+		}
 
-	m_numMale = 0;
-	m_numFemale = 0;
+		// allocate memory at first for performance reasons
+		m_maleIndex.resize(m_numMale);
+		m_femaleIndex.resize(m_numFemale);
+		if (m_selection)
+		{
+			m_maleFitness.resize(m_numMale);
+			m_femaleFitness.resize(m_numFemale);
+		}
 
-	it = pop.indIterator(subPop);
-	for (; it.valid(); it++)
+		m_numMale = 0;
+		m_numFemale = 0;
+
+		it = pop.indIterator(subPop);
+		for (; it.valid(); it++)
+		{
+			if (it->sex() == MALE)
+			{
+				m_maleIndex[m_numMale] = it.rawIter();
+				if (m_selection)
+					m_maleFitness[m_numMale] = it->info(fit_id);
+				m_numMale++;
+			}
+			else
+			{
+				m_femaleIndex[m_numFemale] = it.rawIter();
+				if (m_selection)
+					m_femaleFitness[m_numFemale] = it->info(fit_id);
+				m_numFemale++;
+			}
+		}
+	}
+	else
 	{
-		if (it->sex() == MALE)
+		// males and females are counted by blocks of individuals in parallel,
+		// and are indexed in their original order.
+		RawIndIterator begin = pop.rawIndBegin(subPop);
+		const size_t size = pop.subPopSize(subPop);
+		const ssize_t numBlocks = numThreads();
+		vectoru maleBegin(numBlocks + 1, 0);
+		vectoru femaleBegin(numBlocks + 1, 0);
+#pragma omp parallel for if(numThreads() > 1)
+		for (ssize_t b = 0; b < numBlocks; ++b)
 		{
-			m_maleIndex[m_numMale] = it.rawIter();
-			if (m_selection)
-				m_maleFitness[m_numMale] = it->info(fit_id);
-			m_numMale++;
+			size_t cnt = 0;
+			size_t iBegin = size * b / numBlocks;
+			size_t iEnd = size * (b + 1) / numBlocks;
+			for (size_t i = iBegin; i < iEnd; ++i)
+				if ((begin + i)->sex() == MALE)
+					++cnt;
+			maleBegin[b + 1] = cnt;
+			femaleBegin[b + 1] = iEnd - iBegin - cnt;
 		}
-		else
+		std::partial_sum(maleBegin.begin(), maleBegin.end(), maleBegin.begin());
+		std::partial_sum(femaleBegin.begin(), femaleBegin.end(), femaleBegin.begin());
+		m_numMale = maleBegin.back();
+		m_numFemale = femaleBegin.back();
+
+		m_maleIndex.resize(m_numMale);
+		m_femaleIndex.resize(m_numFemale);
+		if (m_selection)
 		{
-			m_femaleIndex[m_numFemale] = it.rawIter();
-			if (m_selection)
-				m_femaleFitness[m_numFemale] = it->info(fit_id);
-			m_numFemale++;
+			m_maleFitness.resize(m_numMale);
+			m_femaleFitness.resize(m_numFemale);
+		}
+
+#pragma omp parallel for if(numThreads() > 1)
+		for (ssize_t b = 0; b < numBlocks; ++b)
+		{
+			size_t m = maleBegin[b];
+			size_t f = femaleBegin[b];
+			for (size_t i = size * b / numBlocks, iEnd = size * (b + 1) / numBlocks; i < iEnd; ++i)
+			{
+				RawIndIterator ind = begin + i;
+				if (ind->sex() == MALE)
+				{
+					if (m_selection)
+						m_maleFitness[m] = ind->info(fit_id);
+					m_maleIndex[m++] = ind;
+				}
+				else
+				{
+					if (m_selection)
+						m_femaleFitness[f] = ind->info(fit_id);
+					m_femaleIndex[f++] = ind;
+				}
+			}
 		}
 	}
 
@@ -1209,14 +1280,19 @@ CombinedParentsChooser::CombinedParentsChooser(const ParentChooser &fatherChoose
 
 void CombinedParentsChooser::initialize(Population &pop, size_t sp)
 {
+	// each parent chooser builds its own indexes, in parallel if it can.
 	m_fatherChooser->initialize(pop, sp);
 	m_motherChooser->initialize(pop, sp);
+	m_initialized = true;
 }
 
 ParentChooser::IndividualPair CombinedParentsChooser::chooseParents()
 {
-	size_t attempts = 0;
-	while (attempts < 100)
+	DBG_ASSERT(initialized(), SystemError,
+			   "Please initialize this parent chooser before using it");
+	// all states are kept by the two parent choosers, so this function is
+	// thread-safe if both of them are.
+	for (size_t attempts = 0; attempts < 100; ++attempts)
 	{
 		ParentChooser::IndividualPair p1 = m_fatherChooser->chooseParents();
 		ParentChooser::IndividualPair p2 = m_motherChooser->chooseParents();
@@ -1225,17 +1301,15 @@ ParentChooser::IndividualPair CombinedParentsChooser::chooseParents()
 
 		if (dad != mom || m_allowSelfing)
 			return ParentChooser::IndividualPair(dad, mom);
-		if (attempts++ == 100)
-			throw RuntimeError("Failed to select distinct parents using CombinedParentsChooser.");
 	}
-	// just make the compiler happy
-	return ParentChooser::IndividualPair((Individual *)(0), (Individual *)(0));
+	throw RuntimeError("Failed to select distinct parents using CombinedParentsChooser.");
 }
 
 void CombinedParentsChooser::finalize()
 {
 	m_fatherChooser->finalize();
 	m_motherChooser->finalize();
+	m_initialized = false;
 }
 
 PyParentsChooser::PyParentsChooser(PyObject *pc)
@@ -1416,6 +1490,13 @@ bool MatingScheme::prepareScratchPop(Population &pop, Population &scratch)
 	scratch.setGen(pop.gen());
 	scratch.setRep(pop.rep());
 	scratch.clearInfo();
+	// make sure that genotype transmitters can record genealogy from all threads
+	if (pop.genealogyRecorder())
+		pop.genealogyRecorder()->prepare();
+	// and that during-mating operators can test if offspring belong to
+	// virtual subpopulations from all threads
+	if (scratch.virtualSplitter())
+		scratch.virtualSplitter()->prepare(scratch);
 #ifdef MUTANTALLELE
 	// for mutant allele, clearing all existing genotype will make subsequent
 	// copyChromosomes much faster ...
@@ -1442,6 +1523,9 @@ bool MatingScheme::mate(Population &pop, Population &scratch)
 
 void MatingScheme::submitScratch(Population &pop, Population &scratch)
 {
+	// add offspring to the genealogy while parents are still available
+	if (pop.genealogyRecorder())
+		pop.genealogyRecorder()->commit(scratch);
 	// use scratch population,
 	pop.push(scratch);
 	scratch.validate("after push and discard");
@@ -1477,6 +1561,10 @@ bool HomoMating::mateSubPop(Population &pop, Population &offPop, size_t subPop,
 	if (!m_OffspringGenerator->initialized())
 		m_OffspringGenerator->initialize(pop, subPop);
 
+	// let operators such as IdTagger reserve resources for all offspring
+	// before they are generated by several threads
+	m_OffspringGenerator->prepareOffspring(pop, offPop, offBegin, offEnd);
+
 	// generate scratch.subPopSize(sp) individuals.
 	RawIndIterator it = offBegin;
 	// If the parent chooser is not parallelizable, or if openMP is not supported
@@ -1505,7 +1593,10 @@ bool HomoMating::mateSubPop(Population &pop, Population &offPop, size_t subPop,
 		ssize_t numOffspring = m_OffspringGenerator->numOffspring(pop.gen());
 		int except = 0;
 		string msg;
-#pragma omp parallel for
+		// blocks are statically assigned to threads so that parent choosers
+		// that keep per-thread states (e.g. polygamy cycles of
+		// PolyParentsChooser) see the same sequence of offspring.
+#pragma omp parallel for schedule(static)
 		for (int i = 0; i < nBlocks; i++)
 		{
 			try
@@ -1581,6 +1672,98 @@ bool HomoMating::mateSubPop(Population &pop, Population &offPop, size_t subPop,
 	return true;
 }
 
+// markers of parents that do not exist, or are not in the parental generation
+// of the pedigree and have to be looked up by ID.
+static const UINT NO_PARENT = ~static_cast<UINT>(0);
+static const UINT MISSING_PARENT = NO_PARENT - 1;
+
+PedigreeMating::PedigreeMating(const Pedigree & ped, const opList & ops,
+	const string & idField) :
+	m_ped(ped), m_transmitters(ops), m_idField(idField), m_gen(ped.ancestralGens() - 1),
+	m_parentIdx(ped.ancestralGens()), m_resolved(ped.ancestralGens(), true)
+{
+	// resolve parents of each generation against their parental generation
+	// once so that mate() does not have to look up parents by ID.
+	Pedigree & pedigree = const_cast<Pedigree &>(m_ped);
+	size_t oldGen = pedigree.curAncestralGen();
+	size_t idIdx = pedigree.idIdx();
+	int parentFields[2] = { pedigree.fatherIdx(), pedigree.motherIdx() };
+
+	for (int gen = 0; gen < pedigree.ancestralGens(); ++gen) {
+		pedigree.useAncestralGen(gen + 1);
+		if (pedigree.popSize() >= MISSING_PARENT) {
+			pedigree.useAncestralGen(oldGen);
+			throw ValueError("Parental generation of the pedigree is too large.");
+		}
+		IdMap idMap;
+		Individual * first = pedigree.popSize() == 0 ? NULL : &*pedigree.rawIndBegin();
+		RawIndIterator it = pedigree.rawIndBegin();
+		RawIndIterator it_end = pedigree.rawIndEnd();
+		for (; it != it_end; ++it)
+			idMap[toID(it->info(idIdx))] = &*it;
+
+		pedigree.useAncestralGen(gen);
+		vector<UINT> & parentIdx = m_parentIdx[gen];
+		parentIdx.resize(2 * pedigree.popSize());
+		RawIndIterator offBegin = pedigree.rawIndBegin();
+		int resolved = 1;
+#pragma omp parallel for reduction(&:resolved) if(numThreads() > 1)
+		for (ssize_t i = 0; i < static_cast<ssize_t>(pedigree.popSize()); ++i) {
+			for (size_t p = 0; p < 2; ++p) {
+				size_t parent = parentFields[p] == -1 ? 0 : toID((offBegin + i)->info(parentFields[p]));
+				if (parent == 0) {
+					parentIdx[2 * i + p] = NO_PARENT;
+					continue;
+				}
+				IdMap::const_iterator found = idMap.find(parent);
+				if (found == idMap.end()) {
+					parentIdx[2 * i + p] = MISSING_PARENT;
+					resolved = 0;
+				} else
+					parentIdx[2 * i + p] = static_cast<UINT>(found->second - first);
+			}
+		}
+		m_resolved[gen] = resolved != 0;
+	}
+	pedigree.useAncestralGen(oldGen);
+}
+
+
+bool PedigreeMating::locateParents(Population & pop, size_t gen, vector<Individual *> & parents) const
+{
+	Pedigree & pedigree = const_cast<Pedigree &>(m_ped);
+
+	pedigree.useAncestralGen(gen + 1);
+	size_t pedIdIdx = pedigree.idIdx();
+	size_t idIdx = pop.infoIdx(m_idField);
+	RawIndIterator pedBegin = pedigree.rawIndBegin();
+	RawIndIterator popBegin = pop.rawIndBegin();
+	parents.resize(pedigree.popSize());
+
+	// the population evolved by this mating scheme usually follows the order
+	// of the pedigree, in which case no lookup by ID is needed.
+	bool sameOrder = pop.popSize() == pedigree.popSize();
+	for (size_t i = 0; sameOrder && i < parents.size(); ++i)
+		sameOrder = toID((pedBegin + i)->info(pedIdIdx)) == toID((popBegin + i)->info(idIdx));
+
+	if (sameOrder) {
+		for (size_t i = 0; i < parents.size(); ++i)
+			parents[i] = &*(popBegin + i);
+	} else {
+		IdMap idMap;
+		RawIndIterator it = pop.rawIndBegin();
+		RawIndIterator it_end = pop.rawIndEnd();
+		for (; it != it_end; ++it)
+			idMap[toID(it->info(idIdx))] = &*it;
+		for (size_t i = 0; i < parents.size(); ++i) {
+			IdMap::iterator found = idMap.find(toID((pedBegin + i)->info(pedIdIdx)));
+			parents[i] = found == idMap.end() ? NULL : found->second;
+		}
+	}
+	return sameOrder;
+}
+
+
 bool PedigreeMating::mate(Population &pop, Population &scratch)
 {
 	if (m_gen == -1)
@@ -1591,26 +1774,55 @@ bool PedigreeMating::mate(Population &pop, Population &scratch)
 		scratch.fitGenoStru(pop.genoStruIdx());
 	//
 	size_t oldGen = m_ped.curAncestralGen();
+	// parents in the order of the parental generation of the pedigree
+	vector<Individual *> parents;
+	bool sameOrder = locateParents(pop, m_gen, parents);
 	const_cast<Pedigree &>(m_ped).useAncestralGen(m_gen);
 	DBG_DO(DBG_MATING, cerr << "Producing offspring generation of size " << m_ped.subPopSizes() << " using generation " << m_gen << " of the pedigree." << endl);
 	scratch.fitSubPopStru(m_ped.subPopSizes(), m_ped.subPopNames());
 	scratch.setVirtualSplitter(pop.virtualSplitter());
 	scratch.clearInfo();
-
-	// build an index for parents
-	IdMap idMap;
+	if (pop.genealogyRecorder())
+		pop.genealogyRecorder()->prepare();
+	if (scratch.virtualSplitter())
+		scratch.virtualSplitter()->prepare(scratch);
+
+	const vector<UINT> & parentIdx = m_parentIdx[m_gen];
+	const Individual * pedBegin = m_ped.popSize() == 0 ? NULL : &*m_ped.rawIndBegin();
+	size_t pedIdIdx = m_ped.idIdx();
+	int parentFields[2] = { m_ped.fatherIdx(), m_ped.motherIdx() };
 	size_t idIdx = pop.infoIdx(m_idField);
-	RawIndIterator it = pop.rawIndBegin();
-	RawIndIterator it_end = pop.rawIndEnd();
-	for (; it != it_end; ++it)
-		idMap[toID(it->info(idIdx))] = &*it;
+	// parents that are not in the parental generation of the pedigree have
+	// to be looked up by ID.
+	IdMap idMap;
+	if (!m_resolved[m_gen]) {
+		RawIndIterator it = pop.rawIndBegin();
+		RawIndIterator it_end = pop.rawIndEnd();
+		for (; it != it_end; ++it)
+			idMap[toID(it->info(idIdx))] = &*it;
+	}
+	// make sure that all parents exist before entering the parallel region
+	if (!sameOrder || !m_resolved[m_gen]) {
+		for (size_t i = 0; i < parentIdx.size(); ++i) {
+			if (parentIdx[i] == NO_PARENT)
+				continue;
+			size_t parent = toID((pedBegin + i / 2)->info(parentFields[i % 2]));
+			PARAM_FAILIF(parentIdx[i] == MISSING_PARENT ? idMap.find(parent) == idMap.end() : parents[parentIdx[i]] == NULL,
+				RuntimeError, (boost::format("Could not locate individual with ID %1%") % parent).str());
+		}
+	}
 
 	// initialize operator before entering parallel region in order to avoid race condition
 	opList::const_iterator iop = m_transmitters.begin();
 	opList::const_iterator iopEnd = m_transmitters.end();
-	for (; iop != iopEnd; ++iop)
+	for (; iop != iopEnd; ++iop) {
 		(*iop)->initializeIfNeeded(*pop.rawIndBegin());
+		if ((*iop)->isActive(pop.rep(), pop.gen()))
+			(*iop)->prepareDuringMating(pop, scratch, scratch.rawIndBegin(), scratch.rawIndEnd());
+	}
 
+	RawIndIterator it;
+	RawIndIterator it_end;
 #pragma omp parallel private(it, it_end) if (numThreads() > 1 && parallelizable())
 	{
 #ifdef _OPENMP
@@ -1626,30 +1838,19 @@ bool PedigreeMating::mate(Population &pop, Population &scratch)
 #endif
 		for (; it != it_end; ++it, ++i)
 		{
-			const Individual &pedInd = m_ped.individual(static_cast<double>(i));
-
-			size_t my_id = toID(pedInd.info(m_ped.idIdx()));
-			size_t father_id = m_ped.fatherOf(my_id);
-			size_t mother_id = m_ped.motherOf(my_id);
-			Individual *dad = NULL;
-			Individual *mom = NULL;
-
-			if (father_id)
-			{
-				IdMap::iterator dad_it = idMap.find(father_id);
-				DBG_FAILIF(dad_it == idMap.end(), RuntimeError,
-						   (boost::format("Could not locate individual with ID %1%") % father_id).str());
-				dad = &*(dad_it->second);
-			}
-			if (mother_id)
-			{
-				IdMap::iterator mom_it = idMap.find(mother_id);
-				DBG_FAILIF(mom_it == idMap.end(), RuntimeError,
-						   (boost::format("Could not locate individual with ID %1%") % mother_id).str());
-				mom = &*(mom_it->second);
+			const Individual &pedInd = *(pedBegin + i);
+
+			size_t my_id = toID(pedInd.info(pedIdIdx));
+			Individual * parent[2] = { NULL, NULL };
+			for (size_t p = 0; p < 2; ++p) {
+				UINT idx = parentIdx[2 * i + p];
+				if (idx == MISSING_PARENT)
+					parent[p] = idMap.find(toID(pedInd.info(parentFields[p])))->second;
+				else if (idx != NO_PARENT)
+					parent[p] = parents[idx];
 			}
-			DBG_DO(DBG_MATING, cerr << "Choosing parents " << father_id << " and "
-									<< mother_id << " for offspring " << my_id << endl);
+			DBG_DO(DBG_MATING, cerr << "Choosing parents " << (parent[0] ? toID(parent[0]->info(idIdx)) : 0) << " and "
+									<< (parent[1] ? toID(parent[1]->info(idIdx)) : 0) << " for offspring " << my_id << endl);
 
 			// copy sex
 			it->setSex(pedInd.sex());
@@ -1661,7 +1862,7 @@ bool PedigreeMating::mate(Population &pop, Population &scratch)
 			for (; iop != iopEnd; ++iop)
 			{
 				if ((*iop)->isActive(pop.rep(), pop.gen()))
-					(*iop)->applyDuringMating(pop, scratch, it, dad, mom);
+					(*iop)->applyDuringMating(pop, scratch, it, parent[0], parent[1]);
 			}
 			// copy individual ID again, just to make sure that even if during mating operators
 			// changes ID, pedigree mating could proceed normally.
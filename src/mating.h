@@ -621,6 +621,10 @@ public:
 	 */
 	virtual void initialize(const Population & pop, size_t subPop);
 
+	/// CPPONLY prepare active operators for offspring from \e offBegin to \e offEnd
+	void prepareOffspring(Population & pop, Population & offPop,
+		RawIndIterator offBegin, RawIndIterator offEnd);
+
 	/// CPPONLY
 	virtual UINT generateOffspring(Population & pop, Population & offPop, Individual * dad, Individual * mom,
 		RawIndIterator & offBegin, RawIndIterator & offEnd);
@@ -1625,13 +1629,12 @@ public:
 	 *  generation who have offspring. After parents of each individuals are
 	 *  determined from their IDs, a list of during-mating operators
 	 *  \e ops are applied to transmit genotypes. The return value of these
-	 *  operators are not checked.
+	 *  operators are not checked. Because parents of all individuals are
+	 *  located when the mating scheme is created, \e ped should not be
+	 *  changed afterwards.
 	 */
 	PedigreeMating(const Pedigree & ped, const opList & ops,
-		const string & idField = "ind_id") :
-		m_ped(ped), m_transmitters(ops), m_idField(idField), m_gen(ped.ancestralGens() - 1)
-	{
-	}
+		const string & idField = "ind_id");
 
 
 	~PedigreeMating()
@@ -1658,6 +1661,11 @@ public:
 	bool parallelizable() const;
 
 private:
+	/// Locate individuals of the parental generation of pedigree generation
+	/// \e gen in \e pop, in the order of the pedigree. Return \c true if
+	/// \e pop has exactly the same order as the pedigree.
+	bool locateParents(Population & pop, size_t gen, vector<Individual *> & parents) const;
+
 	const Pedigree & m_ped;
 
 	opList m_transmitters;
@@ -1665,6 +1673,16 @@ private:
 	const string m_idField;
 
 	mutable ssize_t m_gen;
+
+	/// Indexes of father and mother (two entries per offspring) of each
+	/// generation, resolved against the order of individuals in its parental
+	/// generation of the pedigree. Indexes are saved as \c UINT to halve the
+	/// memory used for large pedigrees.
+	vector<vector<UINT> > m_parentIdx;
+
+	/// Whether or not all parents of a generation are found in its parental
+	/// generation of the pedigree.
+	vector<bool> m_resolved;
 };
 
 
@@ -91,6 +91,8 @@ void BaseMutator::fillContext(const Population & pop, IndAlleleIterator ptr, siz
 
 bool BaseMutator::apply(Population & pop) const
 {
+	// genotypes shared with other populations are copied before mutation
+	pop.detachGenotype();
 	DBG_DO(DBG_MUTATOR, cerr << "Mutate replicate " << pop.rep() << endl);
 
 #ifdef LINEAGE
@@ -501,6 +503,7 @@ Allele ContextMutator::mutate(Allele allele, size_t locus) const
 
 bool PointMutator::apply(Population & pop) const
 {
+	pop.detachGenotype();
 	subPopList subPops = applicableSubPops(pop);
 
 	subPopList::const_iterator sp = subPops.begin();
@@ -678,6 +681,7 @@ size_t FiniteSitesMutator::locateVacantLocus(Population & /* pop */, size_t beg,
 
 bool FiniteSitesMutator::apply(Population & pop) const
 {
+	pop.detachGenotype();
 	// FIXME:
 	//
 	const matrixi & ranges = m_ranges.elems();
@@ -841,6 +845,12 @@ bool MutSpaceRevertFixedSites::apply(Population & pop) const
 			out << '\t' << *beg;
 		out << endl;
 	}
+	// reverted sites are no longer occupied
+	MutantRegistry & mutants = pop.mutantRegistry();
+	std::set<Allele>::iterator mit = commonAlleles.begin();
+	for (; mit != commonAlleles.end(); ++mit)
+		mutants.remove(static_cast<size_t>(*mit));
+
 	it = pop.rawIndBegin();
 	vectora new_alleles(pop.totNumLoci());
 	for (; it != it_end; ++it) {
@@ -860,29 +870,19 @@ bool MutSpaceRevertFixedSites::apply(Population & pop) const
 }
 
 
-size_t MutSpaceMutator::locateVacantLocus(Population & /* pop */, size_t beg, size_t end, std::set<size_t> & mutants) const
+size_t MutSpaceMutator::locateVacantLocus(size_t beg, size_t end, const MutantRegistry & mutants) const
 {
 	size_t loc = getRNG().randInt(static_cast<ULONG>(end - beg)) + beg;
 
-	std::set<size_t>::iterator it = std::find(mutants.begin(), mutants.end(), loc);
-
-	if (it == mutants.end())
+	if (!mutants.contains(loc))
 		return loc;
 	// look forward and backward
-	size_t loc1 = loc + 1;
-	std::set<size_t>::iterator it1(it);
-	++it1;
-	for (; it1 != mutants.end() && loc1 != end; ++it1, ++loc1) {
-		if (*it1 != loc1)
+	for (size_t loc1 = loc + 1; loc1 < end; ++loc1)
+		if (!mutants.contains(loc1))
 			return loc1;
-	}
-	size_t loc2 = loc - 1;
-	std::set<size_t>::reverse_iterator it2(it);
-	--it2;
-	for (; it2 != mutants.rend() && loc2 != beg; --it2, --loc2) {
-		if (*it2 != loc2)
-			return loc2;
-	}
+	for (size_t loc2 = loc; loc2 > beg; --loc2)
+		if (!mutants.contains(loc2 - 1))
+			return loc2 - 1;
 	// still cannot find
 	return 0;
 }
@@ -890,6 +890,7 @@ size_t MutSpaceMutator::locateVacantLocus(Population & /* pop */, size_t beg, si
 
 bool MutSpaceMutator::apply(Population & pop) const
 {
+	pop.detachGenotype();
 	const matrixi & ranges = m_ranges.elems();
 	vectoru width(ranges.size());
 
@@ -904,8 +905,16 @@ bool MutSpaceMutator::apply(Population & pop) const
 	if (!noOutput())
 		out = &getOstream(pop.dict());
 
-	// build a set of existing mutants
-	std::set<size_t> mutants;
+	// Mutants are registered when they are introduced. Mutants that are lost
+	// are removed when the registry is synchronized with the population,
+	// which is done once a generation under the infinite-sites model (so that
+	// lost sites can be reused), and otherwise when the registry doubles
+	// its size.
+	MutantRegistry & mutants = pop.mutantRegistry();
+	long gen = static_cast<long>(pop.gen());
+	if (mutants.syncedGen() < 0 || (m_model == 2 && mutants.syncedGen() != gen) ||
+	    mutants.size() > 2 * mutants.syncedSize() + 100)
+		mutants.sync(pop.genoBegin(false), pop.genoEnd(false), gen);
 	bool saturated = false;
 
 	subPopList subPops = applicableSubPops(pop);
@@ -921,7 +930,7 @@ bool MutSpaceMutator::apply(Population & pop) const
 				loc += getRNG().randGeometric(m_rate);
 				if (loc > indWidth)
 					break;
-				Individual & ind = pop.individual(indIndex);
+				Individual & ind = pop.individual(indIndex, sp->subPop());
 				size_t p = (loc - 1) / ploidyWidth;
 				// chromosome and position on chromosome?
 				size_t mutLoc = (loc - 1) - p * ploidyWidth;
@@ -950,22 +959,8 @@ bool MutSpaceMutator::apply(Population & pop) const
 							        << "\t3\n";
 						continue;
 					}
-					bool ok = false;
-					// if the first time
-					if (mutants.empty()) {
-						// first try our luck...
-						ok = find(pop.genoBegin(false), pop.genoEnd(false), TO_ALLELE(mutLoc)) == pop.genoEnd(false);
-						if (!ok) {
-							std::set<size_t> existing(pop.genoBegin(false), pop.genoEnd(false));
-							mutants.swap(existing);
-							mutants.erase(0);
-							saturated = mutants.size() == ploidyWidth;
-							if (saturated)
-								cerr << "Failed to introduce new mutants at generation " << pop.gen() << " because all loci have existing mutants." << endl;
-						}
-					}
-					if (!ok && mutants.find(mutLoc) != mutants.end()) {
-						size_t newLoc = locateVacantLocus(pop, ranges[ch][0], ranges[ch][1], mutants);
+					if (mutants.contains(mutLoc)) {
+						size_t newLoc = locateVacantLocus(ranges[ch][0], ranges[ch][1], mutants);
 						// nothing is found
 						if (out)
 							(*out)	<< pop.gen() << '\t' << mutLoc << '\t' << indIndex
@@ -978,52 +973,45 @@ bool MutSpaceMutator::apply(Population & pop) const
 							saturated = true;
 							continue;
 						}
-						// if there is no existing mutant, new mutant is allowed
 					}
-					mutants.insert(mutLoc);
 				}
+				// mutants are kept sorted on each chromosome, followed by 0
 				GenoIterator geno = ind.genoBegin(p, ch);
 				size_t nLoci = pop.numLoci(ch);
-				if (*(geno + nLoci - 1) != 0u) {
-					// if the number of mutants at this individual exceeds reserved numbers
-					DBG_DO(DBG_MUTATOR, cerr << "Adding 10 loci to region " << ch << endl);
-					vectorf added(10);
-					for (size_t j = 0; j < 10; ++j)
+				size_t nMutants = std::find(geno, geno + nLoci, Allele(0)) - geno;
+				GenoIterator it = std::find(geno, geno + nMutants, TO_ALLELE(mutLoc));
+				if (it != geno + nMutants) {
+					// back mutation
+					std::copy(it + 1, geno + nMutants, it);
+					*(geno + nMutants - 1) = 0;
+					if (out)
+						(*out) << pop.gen() << '\t' << mutLoc << '\t' << indIndex << "\t1\n";
+					DBG_DO(DBG_MUTATOR, cerr << "Back mutation happens at generation " << pop.gen() << " on individual " << indIndex << endl);
+					continue;
+				}
+				if (nMutants + 1 >= nLoci) {
+					// if the number of mutants at this individual exceeds reserved
+					// numbers, double the number of loci to reduce re-allocation
+					size_t nAdded = std::max(nLoci, static_cast<size_t>(10));
+					DBG_DO(DBG_MUTATOR, cerr << "Adding " << nAdded << " loci to region " << ch << endl);
+					vectorf added(nAdded);
+					for (size_t j = 0; j < nAdded; ++j)
 						added[j] = static_cast<double>(nLoci + j + 1);
-					vectoru addedChrom(10, ch);
+					vectoru addedChrom(nAdded, ch);
 					pop.addLoci(addedChrom, added);
 					// individual might be shifted...
-					ind = pop.individual(indIndex);
-					geno = ind.genoBegin(p, ch);
-					nLoci += 10;
-				}
-				// find the first non-zero location
-				for (size_t j = 0; j < nLoci; ++j) {
-					if (*(geno + j) == 0u) {
-						// record mutation here
-						DBG_FAILIF(mutLoc >= ModuleMaxAllele, RuntimeError,
-							"Location can not be saved because it exceed max allowed allele.");
-						*(geno + j) = TO_ALLELE(mutLoc);
-						if (out)
-							(*out) << pop.gen() << '\t' << mutLoc << '\t' << indIndex << "\t0\n";
-						break;
-					} else if (static_cast<size_t>(*(geno + j)) == mutLoc) {
-						// back mutation
-						//  from A b c d 0
-						//  to   d b c d 0
-						//  to   d b c 0 0
-						for (size_t k = j + 1; k < nLoci; ++k)
-							if (*(geno + k) == 0u) {
-								*(geno + j) = *(geno + k - 1);
-								*(geno + k - 1) = 0;
-								if (out)
-									(*out) << pop.gen() << '\t' << mutLoc << '\t' << indIndex << "\t1\n";
-								break;
-							}
-						DBG_DO(DBG_MUTATOR, cerr << "Back mutation happens at generation " << pop.gen() << " on individual " << indIndex << endl);
-						break;
-					}
+					geno = pop.individual(indIndex, sp->subPop()).genoBegin(p, ch);
+					nLoci += nAdded;
 				}
+				// record mutation here
+				DBG_FAILIF(mutLoc >= ModuleMaxAllele, RuntimeError,
+					"Location can not be saved because it exceed max allowed allele.");
+				it = std::lower_bound(geno, geno + nMutants, TO_ALLELE(mutLoc));
+				std::copy_backward(it, geno + nMutants, geno + nMutants + 1);
+				*it = TO_ALLELE(mutLoc);
+				mutants.add(mutLoc, gen);
+				if (out)
+					(*out) << pop.gen() << '\t' << mutLoc << '\t' << indIndex << "\t0\n";
 			}   // while
 		}       // each individual
 	}           // each subpopulation
@@ -960,7 +960,7 @@ public:
 
 
 private:
-	size_t locateVacantLocus(Population & pop, size_t beg, size_t end, std::set<size_t> & mutants) const;
+	size_t locateVacantLocus(size_t beg, size_t end, const MutantRegistry & mutants) const;
 
 private:
 	const double m_rate;
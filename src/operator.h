@@ -236,6 +236,19 @@ public:
 		Individual * dad = NULL, Individual * mom = NULL) const;
 
 
+	/** CPPONLY called by a mating scheme before offspring from \e offBegin
+	 *  to \e offEnd of \e offPop are generated, possibly by several threads.
+	 */
+	virtual void prepareDuringMating(Population & pop, Population & offPop,
+		RawIndIterator offBegin, RawIndIterator offEnd) const
+	{
+		(void)pop;       // avoid warning about unused parameter
+		(void)offPop;
+		(void)offBegin;
+		(void)offEnd;
+	}
+
+
 	//@}
 	/** @name dealing with output separator, persistant files, $gen etc substitution.
 	 */
@@ -24,6 +24,11 @@
  */
 #include "outputer.h"
 
+#ifndef _WIN32
+#  include <pthread.h>
+#  include <deque>
+#endif
+
 namespace simuPOP {
 
 bool PyOutput::apply(Population & pop) const
@@ -44,6 +49,184 @@ string PyOutput::describe(bool /* format */) const
 }
 
 
+namespace {
+
+// append \e str to \e out, right-aligned in a field of \e width characters
+void appendAligned(string & out, const string & str, size_t width)
+{
+	if (str.size() < width)
+		out.append(width - str.size(), ' ');
+	out.append(str);
+}
+
+
+/* Format individuals as lines of index, sex, affection status, genotype and
+ * information fields. Names of alleles are aligned to the output width once
+ * so that a line is built by appending strings to a buffer, and blocks of
+ * individuals are formatted by different threads.
+ */
+class IndFormatter
+{
+public:
+	IndFormatter(const Population & pop, int width, const vectoru & loci, const vectoru & infoIdx) :
+		m_width(width > 0 ? width : 0), m_leadingSpaces(0), m_loci(), m_names(), m_numbers(),
+		m_missing(), m_infoIdx(infoIdx)
+	{
+		appendAligned(m_missing, "_", m_width);
+		// names of alleles without user-specified names
+		size_t numNames = 256;
+		if (ModuleMaxAllele < numNames)
+			numNames = ModuleMaxAllele + 1;
+		m_numbers.resize(numNames);
+		for (size_t a = 0; a < numNames; ++a)
+			appendAligned(m_numbers[a], (boost::format("%1%") % a).str(), m_width);
+		// loci are displayed chromosome by chromosome, followed by a space,
+		// unless a list of loci is given.
+		const matrixstr & allNames = pop.allAlleleNames();
+		map<size_t, size_t> nameTables;
+		if (loci.empty()) {
+			for (size_t ch = 0, chEnd = pop.numChrom(); ch < chEnd; ++ch) {
+				for (size_t j = 0, jEnd = pop.numLoci(ch); j < jEnd; ++j)
+					addLocus(allNames, nameTables, pop.chromBegin(ch) + j, ch, j);
+				if (m_loci.empty())
+					++m_leadingSpaces;
+				else
+					++m_loci.back().spaces;
+			}
+		} else {
+			for (vectoru::const_iterator loc = loci.begin(); loc != loci.end(); ++loc) {
+				pairu chIdx = pop.chromLocusPair(*loc);
+				addLocus(allNames, nameTables, *loc, chIdx.first, chIdx.second);
+			}
+			++m_loci.back().spaces;
+		}
+	}
+
+
+	// append formatted individuals \e indexes of \e pop to \e out
+	void write(const Population & pop, const vectoru & indexes, ostream & out) const
+	{
+		const size_t blockSize = 256;
+		const size_t numBlocks = (indexes.size() + blockSize - 1) / blockSize;
+		// a few blocks per thread are formatted before they are written in order
+		vectorstr buffers(numThreads() * 4);
+
+		for (size_t first = 0; first < numBlocks; first += buffers.size()) {
+			const ssize_t numBuffers = static_cast<ssize_t>(std::min(buffers.size(), numBlocks - first));
+#pragma omp parallel for if(numThreads() > 1)
+			for (ssize_t b = 0; b < numBuffers; ++b) {
+				string & buffer = buffers[b];
+				buffer.clear();
+				size_t i = (first + b) * blockSize;
+				size_t iEnd = std::min(i + blockSize, indexes.size());
+				for (; i < iEnd; ++i)
+					format(pop, indexes[i], buffer);
+			}
+			for (ssize_t b = 0; b < numBuffers; ++b)
+				out.write(buffers[b].data(), buffers[b].size());
+		}
+	}
+
+
+private:
+	void addLocus(const matrixstr & allNames, map<size_t, size_t> & nameTables,
+	              size_t locus, size_t chrom, size_t idx)
+	{
+		DisplayedLocus loc = { locus, chrom, idx, 0, 0 };
+
+		if (!allNames.empty()) {
+			// allele names of loci without names are those of the first locus
+			size_t nameIdx = locus < allNames.size() ? locus : 0;
+			map<size_t, size_t>::iterator it = nameTables.find(nameIdx);
+			if (it == nameTables.end()) {
+				m_names.push_back(vectorstr(allNames[nameIdx].size()));
+				for (size_t a = 0; a < allNames[nameIdx].size(); ++a)
+					appendAligned(m_names.back()[a], allNames[nameIdx][a], m_width);
+				it = nameTables.insert(std::make_pair(nameIdx, m_names.size())).first;
+			}
+			loc.names = it->second;
+		}
+		m_loci.push_back(loc);
+	}
+
+
+	void format(const Population & pop, size_t idx, string & out) const
+	{
+		const Individual & ind = *(pop.rawIndBegin() + idx);
+		char buf[48];
+
+		sprintf(buf, SIZE_T_FORMAT, idx);
+		appendAligned(out, buf, 4);
+		out.append(": ");
+		out.push_back(ind.sex() == MALE ? 'M' : 'F');
+		out.push_back(ind.affected() ? 'A' : 'U');
+		out.push_back(' ');
+
+		const size_t ply = ind.ploidy();
+		const size_t totNumLoci = ind.totNumLoci();
+		GenoIterator geno = ind.genoBegin();
+		for (size_t p = 0; p < ply; ++p) {
+			out.append(m_leadingSpaces, ' ');
+			for (vector<DisplayedLocus>::const_iterator loc = m_loci.begin(); loc != m_loci.end(); ++loc) {
+				if (!ind.validIndex(loc->idx, p, loc->chrom))
+					out.append(m_missing);
+				else {
+					ULONG allele = static_cast<ULONG>(DEREF_ALLELE(geno + loc->locus + p * totNumLoci));
+					if (loc->names != 0 && allele < m_names[loc->names - 1].size())
+						out.append(m_names[loc->names - 1][allele]);
+					else if (allele < m_numbers.size())
+						out.append(m_numbers[allele]);
+					else
+						appendAligned(out, (boost::format("%1%") % allele).str(), m_width);
+				}
+				out.append(loc->spaces, ' ');
+			}
+			if (p != ply - 1)
+				out.append("| ");
+		}
+		if (ind.infoSize() != 0) {
+			out.append("| ");
+			for (vectoru::const_iterator info = m_infoIdx.begin(); info != m_infoIdx.end(); ++info) {
+				// same as the default format of ostream
+				sprintf(buf, " %g", ind.info(*info));
+				out.append(buf);
+			}
+		}
+		out.push_back('\n');
+	}
+
+
+	struct DisplayedLocus
+	{
+		// absolute index of locus
+		size_t locus;
+		// chromosome and index of locus on chromosome
+		size_t chrom;
+		size_t idx;
+		// number of spaces after the allele
+		size_t spaces;
+		// index plus 1 of names of alleles in m_names, 0 if unnamed
+		size_t names;
+	};
+
+	const size_t m_width;
+
+	size_t m_leadingSpaces;
+
+	vector<DisplayedLocus> m_loci;
+
+	vector<vectorstr> m_names;
+
+	vectorstr m_numbers;
+
+	string m_missing;
+
+	const vectoru m_infoIdx;
+};
+
+}
+
+
 void Dumper::displayStructure(const Population & pop, ostream & out) const
 {
 	out << "Ploidy: " << pop.ploidy()
@@ -110,21 +293,23 @@ UINT Dumper::displayGenotype(const Population & pop, const subPopList & subPops,
 		for (size_t i = 0; i < infoSize(); ++i)
 			infoIdx.push_back(pop.infoIdx(infoField(i)));
 
-	for ( ; sp != spEnd; ++sp) {
+	IndFormatter formatter(pop, m_width, m_loci, infoIdx);
+	vectoru indexes;
+	for ( ; sp != spEnd && (m_max == 0 || count < m_max); ++sp) {
 		size_t spSize = pop.subPopSize(*sp);
 		out << "SubPopulation " << *sp << " (" << pop.subPopName(*sp) << "), "
 		    << spSize << " Individuals:" << endl;
 
+		// collect individuals to be displayed so that they can be formatted
+		// in parallel, without visiting individuals beyond m_max.
+		indexes.clear();
 		const_cast<Population &>(pop).activateVirtualSubPop(*sp);
 		IndIterator ind = const_cast<Population &>(pop).indIterator(sp->subPop());
-		for ( ; ind.valid(); ++ind, ++count) {
-			out << setw(4) << (&*ind - &*pop.rawIndBegin()) << ": ";
-			ind->display(out, m_width, m_loci, infoIdx);
-			out << endl;
-			if (m_max > 0 && count + 1 >= m_max && count < pop.popSize())
-				break;
-		}
+		for ( ; ind.valid() && (m_max == 0 || count < m_max); ++ind, ++count)
+			indexes.push_back(&*ind - &*pop.rawIndBegin());
 		const_cast<Population &>(pop).deactivateVirtualSubPop(sp->subPop());
+
+		formatter.write(pop, indexes, out);
 	}
 	return count;
 }
@@ -173,6 +358,123 @@ string SavePopulation::describe(bool /* format */) const
 }
 
 
+#ifndef _WIN32
+
+namespace {
+
+// a population that is being saved by a background thread
+struct BackgroundSave
+{
+	Population * pop;
+	string filename;
+	string error;
+	pthread_t thread;
+};
+
+
+void * saveInBackground(void * data)
+{
+	BackgroundSave * job = reinterpret_cast<BackgroundSave *>(data);
+
+	// the snapshot does not refer to any Python object so the GIL is not needed.
+	// Exceptions cannot cross thread boundaries and are recorded instead.
+	try {
+		job->pop->save(job->filename);
+	} catch (Exception & e) {
+		job->error = e.message();
+	} catch (std::exception & e) {
+		job->error = e.what();
+	} catch (...) {
+		job->error = "unknown error";
+	}
+	return NULL;
+}
+
+
+// Populations are copied, released and deleted only by the main thread so
+// that genotypic structures are never changed by background threads.
+class BackgroundSaves
+{
+public:
+	BackgroundSaves() : m_jobs()
+	{
+	}
+
+
+	// make sure that all files are complete when the module is unloaded.
+	// Populations are not released because genotypic structures might have
+	// been destroyed.
+	~BackgroundSaves()
+	{
+		for (size_t i = 0; i < m_jobs.size(); ++i)
+			pthread_join(m_jobs[i]->thread, NULL);
+	}
+
+
+	size_t size() const
+	{
+		return m_jobs.size();
+	}
+
+
+	void start(const Population & pop, const string & filename)
+	{
+		BackgroundSave * job = new BackgroundSave();
+
+		job->pop = pop.snapshot();
+		job->filename = filename;
+		if (pthread_create(&job->thread, NULL, saveInBackground, job) != 0) {
+			// save the population directly if no thread is available
+			delete job->pop;
+			delete job;
+			pop.save(filename);
+			return;
+		}
+		m_jobs.push_back(job);
+	}
+
+
+	// wait for the oldest job and return its error message, if any
+	string finishOldest()
+	{
+		BackgroundSave * job = m_jobs.front();
+
+		m_jobs.pop_front();
+		pthread_join(job->thread, NULL);
+		string error = job->error.empty() ? string() :
+		               "Failed to save population to " + job->filename + ": " + job->error;
+		delete job->pop;
+		delete job;
+		return error;
+	}
+
+
+private:
+	std::deque<BackgroundSave *> m_jobs;
+};
+
+BackgroundSaves g_backgroundSaves;
+
+}
+
+#endif
+
+void waitForBackgroundSaves()
+{
+#ifndef _WIN32
+	string error;
+
+	while (g_backgroundSaves.size() > 0) {
+		string msg = g_backgroundSaves.finishOldest();
+		if (error.empty())
+			error = msg;
+	}
+	if (!error.empty())
+		throw RuntimeError(error);
+#endif
+}
+
+
 bool SavePopulation::apply(Population & pop) const
 {
 	if (m_filename.empty())
@@ -188,6 +490,18 @@ bool SavePopulation::apply(Population & pop) const
 		filename = filenameParser.valueAsString();
 	}
 	DBG_DO(DBG_POPULATION, cerr << "Save to file " << filename << endl);
+#ifndef _WIN32
+	if (m_background > 0) {
+		// wait for earlier populations if too many are being saved
+		while (g_backgroundSaves.size() >= m_background) {
+			string error = g_backgroundSaves.finishOldest();
+			if (!error.empty())
+				throw RuntimeError(error);
+		}
+		g_backgroundSaves.start(pop, filename);
+		return true;
+	}
+#endif
 	pop.save(filename);
 	return true;
 }
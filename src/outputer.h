@@ -178,15 +178,23 @@ public:
 	 *  specifications (\c '', \c 'filename', \c 'filename' prefixed by one
 	 *  or more '>' characters, and \c '!expr') but output from different
 	 *  operators will always replace existing files (effectively ignore
-	 *  '>' specification). Parameter \e subPops is ignored. Please refer to
-	 *  class \c BaseOperator for a detailed description about common operator
-	 *  parameters such as \e stage and \e begin.
+	 *  '>' specification). If \e background is set to a positive number,
+	 *  this operator copies the population and saves the copy in a background
+	 *  thread so that the evolutionary process can continue while the
+	 *  population is being written. At most \e background populations can be
+	 *  saved at the same time (the operator waits for the oldest one if more
+	 *  are needed) and all of them are saved when function \c evolve returns.
+	 *  Background saving is not supported under windows. Parameter \e subPops
+	 *  is ignored. Please refer to class \c BaseOperator for a detailed
+	 *  description about common operator parameters such as \e stage and
+	 *  \e begin.
 	 */
 	SavePopulation(const stringFunc & output = "", int begin = 0, int end = -1,
 		int step = 1, const intList & at = vectori(), const intList & reps = intList(),
-		const subPopList & subPops = subPopList(), const stringList & infoFields = vectorstr()) :
+		const subPopList & subPops = subPopList(), const stringList & infoFields = vectorstr(),
+		size_t background = 0) :
 		BaseOperator("", begin, end, step, at, reps, subPops, infoFields),
-		m_filename(output.value())
+		m_filename(output.value()), m_background(background)
 	{
 		DBG_WARNIF(output.empty(), "An empty output string is passed to operator SavePopulation. No file will be saved.");
 	}
@@ -214,7 +222,17 @@ public:
 private:
 	/// filename,
 	const string m_filename;
+
+	/// maximum number of populations saved in background threads
+	const size_t m_background;
 };
 
+
+/** CPPONLY Wait for all populations that are being saved in background
+ *  threads by operator SavePopulation. A RuntimeError is raised if any of
+ *  them could not be saved.
+ */
+void waitForBackgroundSaves();
+
 }
 #endif
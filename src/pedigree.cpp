@@ -28,7 +28,10 @@
 using std::ifstream;
 using std::ofstream;
 
-#include <set>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/copy.hpp>
 
 namespace simuPOP {
 
@@ -119,18 +122,29 @@ Pedigree * Pedigree::clone() const
 
 
 void Pedigree::save(const string & filename, const stringList & fieldList,
-                    const lociList & lociList) const
+                    const lociList & lociList, const string & format) const
 {
-	ofstream file(filename.c_str());
-
-	if (!file)
-		throw RuntimeError("Cannot open file " + filename + " for write.");
+	PARAM_FAILIF(format != "text" && format != "binary" && format != "binary.gz", ValueError,
+		"Pedigree can only be saved in 'text', 'binary' or 'binary.gz' format.");
 
 	vectorstr fields = fieldList.allAvail() ? infoFields() : fieldList.elems();
 	vectoru indexes;
 	for (size_t i = 0; i < fields.size(); ++i)
 		indexes.push_back(infoIdx(fields[i]));
 
+	if (format != "text") {
+		vectoru loci = lociList.elems(this);
+		std::sort(loci.begin(), loci.end());
+		loci.erase(std::unique(loci.begin(), loci.end()), loci.end());
+		saveBinary(filename, fields, indexes, loci, format == "binary.gz");
+		return;
+	}
+
+	ofstream file(filename.c_str());
+
+	if (!file)
+		throw RuntimeError("Cannot open file " + filename + " for write.");
+
 	// out << .... is very slow compared to the sprintf implementation.
 	//
 	// three numbers (maximum 20 charameters) + M F, the buffer should be long enough
@@ -183,6 +197,168 @@ void Pedigree::save(const string & filename, const stringList & fieldList,
 }
 
 
+/// signature of binary pedigree files
+static const char PED_MAGIC[] = "SPPEDBIN";
+
+/// Append the binary representation of \e value to \e buf
+template<typename T>
+static void appendBinary(string & buf, T value)
+{
+	buf.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+
+/// Append a string, preceded by its length, to \e buf
+static void appendString(string & buf, const string & value)
+{
+	appendBinary<uint32_t>(buf, static_cast<uint32_t>(value.size()));
+	buf.append(value);
+}
+
+
+void Pedigree::saveBinary(const string & filename, const vectorstr & fields, const vectoru & indexes,
+                          const vectoru & loci, bool compress) const
+{
+	ofstream file(filename.c_str(), std::ios::binary);
+
+	if (!file)
+		throw RuntimeError("Cannot open file " + filename + " for write.");
+
+	size_t ply = ploidy();
+	size_t nLoci = loci.size();
+	size_t nGens = ancestralGens() + 1;
+	size_t curGen = curAncestralGen();
+	bool hasFather = m_fatherIdx != -1;
+	bool hasMother = m_motherIdx != -1;
+	// alleles are saved in bits if they are all 0 or 1, in bytes if they are
+	// all less than 256, in four bytes if they fit in 32 bits, and in eight
+	// bytes otherwise.
+	int width = 0;
+#ifndef BINARYALLELE
+	ULONG maxAllele = 0;
+	for (size_t gen = 0; gen < nGens; ++gen) {
+		const_cast<Pedigree *>(this)->useAncestralGen(gen);
+		for (ConstRawIndIterator it = rawIndBegin(); it != rawIndEnd(); ++it)
+			for (size_t p = 0; p < ply; ++p)
+				for (size_t i = 0; i < nLoci; ++i)
+					maxAllele = std::max(maxAllele, it->allele(loci[i], p));
+	}
+	width = maxAllele <= 1 ? 0 : (maxAllele < 256 ? 1 : (maxAllele <= 0xFFFFFFFFUL ? 4 : 8));
+#endif
+	//
+	// header
+	string header(PED_MAGIC, 8);
+	appendBinary<uint32_t>(header, 0x01020304);
+	appendBinary<uint32_t>(header, 1);
+	appendBinary<uint8_t>(header, compress ? 1 : 0);
+	appendBinary<uint8_t>(header, static_cast<uint8_t>(width));
+	appendBinary<float>(header, isHaplodiploid() ? static_cast<float>(HAPLODIPLOID) : static_cast<float>(ply));
+	// chromosomes of saved loci
+	vectoru chroms;
+	vectoru numLoci;
+	for (size_t i = 0; i < nLoci; ++i) {
+		size_t ch = chromLocusPair(loci[i]).first;
+		if (chroms.empty() || chroms.back() != ch) {
+			chroms.push_back(ch);
+			numLoci.push_back(0);
+		}
+		++numLoci.back();
+	}
+	appendBinary<uint32_t>(header, static_cast<uint32_t>(chroms.size()));
+	for (size_t i = 0; i < chroms.size(); ++i) {
+		appendBinary<uint32_t>(header, static_cast<uint32_t>(numLoci[i]));
+		appendBinary<int32_t>(header, static_cast<int32_t>(chromType(chroms[i])));
+		appendString(header, chromName(chroms[i]));
+	}
+	for (size_t i = 0; i < nLoci; ++i) {
+		appendBinary<double>(header, locusPos(loci[i]));
+		appendString(header, locusName(loci[i]));
+	}
+	appendString(header, m_idField);
+	appendString(header, hasFather ? m_fatherField : string());
+	appendString(header, hasMother ? m_motherField : string());
+	appendBinary<uint32_t>(header, static_cast<uint32_t>(fields.size()));
+	for (size_t i = 0; i < fields.size(); ++i)
+		appendString(header, fields[i]);
+	// size, location and length of each generation, from the top-most
+	// ancestral generation, are written after all generations are saved.
+	appendBinary<uint32_t>(header, static_cast<uint32_t>(nGens));
+	size_t tableStart = header.size();
+	header.resize(tableStart + nGens * 3 * sizeof(uint64_t));
+	file.write(header.data(), header.size());
+	vector<uint64_t> table;
+	uint64_t offset = header.size();
+	//
+	for (int gen = static_cast<int>(nGens) - 1; gen >= 0; --gen) {
+		const_cast<Pedigree *>(this)->useAncestralGen(gen);
+		size_t n = popSize();
+		string block;
+		ConstRawIndIterator it = rawIndBegin();
+		ConstRawIndIterator it_end = rawIndEnd();
+		for (; it != it_end; ++it)
+			appendBinary<uint64_t>(block, toID(it->info(m_idIdx)));
+		// parental IDs will be set to zero if the parent is not in the pedigree
+		for (int parent = 0; parent < 2; ++parent) {
+			int idx = parent == 0 ? m_fatherIdx : m_motherIdx;
+			if (idx == -1)
+				continue;
+			for (it = rawIndBegin(); it != it_end; ++it) {
+				size_t parentID = toID(it->info(idx));
+				if (parentID && m_idMap.find(parentID) == m_idMap.end())
+					parentID = 0;
+				appendBinary<uint64_t>(block, parentID);
+			}
+		}
+		for (it = rawIndBegin(); it != it_end; ++it)
+			appendBinary<uint8_t>(block, (it->sex() == FEMALE ? 1 : 0) | (it->affected() ? 2 : 0));
+		for (it = rawIndBegin(); it != it_end; ++it)
+			for (size_t i = 0; i < indexes.size(); ++i)
+				appendBinary<double>(block, it->info(indexes[i]));
+		if (width == 0) {
+			size_t genoBegin = block.size();
+			block.resize(genoBegin + (n * ply * nLoci + 7) / 8, '\0');
+			size_t bit = 0;
+			for (it = rawIndBegin(); it != it_end; ++it)
+				for (size_t p = 0; p < ply; ++p)
+					for (size_t i = 0; i < nLoci; ++i, ++bit)
+						if (it->allele(loci[i], p))
+							block[genoBegin + bit / 8] |= static_cast<char>(1 << (bit % 8));
+		} else {
+			for (it = rawIndBegin(); it != it_end; ++it)
+				for (size_t p = 0; p < ply; ++p)
+					for (size_t i = 0; i < nLoci; ++i)
+						if (width == 1)
+							appendBinary<uint8_t>(block, static_cast<uint8_t>(it->allele(loci[i], p)));
+						else if (width == 4)
+							appendBinary<uint32_t>(block, static_cast<uint32_t>(it->allele(loci[i], p)));
+						else
+							appendBinary<uint64_t>(block, static_cast<uint64_t>(it->allele(loci[i], p)));
+		}
+		if (compress) {
+			string compressed;
+			{
+				boost::iostreams::filtering_ostream out;
+				out.push(boost::iostreams::gzip_compressor());
+				out.push(boost::iostreams::back_inserter(compressed));
+				out.write(block.data(), block.size());
+			}
+			block.swap(compressed);
+		}
+		file.write(block.data(), block.size());
+		table.push_back(n);
+		table.push_back(offset);
+		table.push_back(block.size());
+		offset += block.size();
+	}
+	const_cast<Pedigree *>(this)->useAncestralGen(curGen);
+	file.seekp(tableStart);
+	file.write(reinterpret_cast<const char *>(&table[0]), table.size() * sizeof(uint64_t));
+	if (!file)
+		throw RuntimeError("Failed to write pedigree to file " + filename);
+	file.close();
+}
+
+
 size_t Pedigree::numParents() const
 {
 	return static_cast<size_t>(m_fatherIdx != -1) + static_cast<size_t>(m_motherIdx != -1);
@@ -1323,138 +1499,540 @@ void Pedigree::setSubPopByIndInfo(const string & field)
 }
 
 
-struct IndInfo
+/// An individual in a pedigree file, with fields and genotype stored in
+/// the buffers of the chunk of file in which it is read.
+struct PedRecord
 {
+	size_t id;
+	size_t parents[2];
+	size_t numParents;
 	Sex sex;
-	vectoru parents;
-	vectoru offspring;
-	bool affectionStatus;
+	bool affected;
+	size_t fieldBegin;
+	size_t numFields;
+	size_t genoBegin;
+	size_t numGeno;
+};
+
+
+/// Records read from a line-aligned chunk of a pedigree file
+struct PedChunk
+{
+	vector<PedRecord> records;
 	vectorf fields;
 	vectora genotype;
-	IndInfo() : sex(MALE), parents(), offspring(), affectionStatus(false), fields(), genotype() {}
-	IndInfo(size_t off) : sex(MALE), parents(), offspring(1, off), affectionStatus(false), fields(), genotype() {}
+	string error;
 };
 
 
-Pedigree loadPedigree(const string & file, const string & idField, const string & fatherField,
-                      const string & motherField, float ploidy, const uintList & _lociList, const uintList & chromTypes,
-                      const floatList & lociPos, const stringList & chromNames, const stringMatrix & alleleNames,
-                      const stringList & lociNames, const stringList & subPopNames, const stringList & fieldList)
+/// Parse an integer in the way of atoi, from a token [p, end)
+static long parsePedInt(const char * p, const char * end)
 {
-	initClock();
-	int pldy = ploidy == HAPLODIPLOID ? 2 : static_cast<int>(ploidy);
-	//
-	const vectorstr & infoFields = fieldList.elems();
+	while (p != end && isspace(*p))
+		++p;
+	bool negative = false;
+	if (p != end && (*p == '-' || *p == '+'))
+		negative = *p++ == '-';
+	long value = 0;
+	for (; p != end && *p >= '0' && *p <= '9'; ++p)
+		value = value * 10 + (*p - '0');
+	return negative ? -value : value;
+}
 
-	for (size_t i = 0; i < infoFields.size(); ++i) {
-		DBG_FAILIF(infoFields[i] == idField || infoFields[i] == fatherField || infoFields[i] == motherField,
-			ValueError, "Parameter infoFields can only specify additional fields other than idField, fatherField and motherField.");
+
+/// Parse a floating point number in the way of atof, from a token [p, end)
+static double parsePedFloat(const char * p, const char * end)
+{
+	char buf[64];
+	size_t len = end - p;
+
+	if (len < sizeof(buf)) {
+		memcpy(buf, p, len);
+		buf[len] = '\0';
+		return atof(buf);
 	}
-	vectoru loci = _lociList.elems();
-	size_t genoCols = accumulate(loci.begin(), loci.end(), size_t(0)) * pldy;
+	return atof(string(p, end).c_str());
+}
 
-	ifstream input(file.c_str());
-	if (!input)
-		throw RuntimeError("Cannot open specified pedigree file " + file);
-	//
-	size_t max_parents = 0;
-	string line;
-	// individual and their parents
-#if TR1_SUPPORT == 0
-	typedef std::map<size_t, IndInfo *> IdMap;
-#elif TR1_SUPPORT == 1
-	typedef std::unordered_map<size_t, IndInfo *> IdMap;
-#else
-	typedef std::tr1::unordered_map<size_t, IndInfo *> IdMap;
-#endif
-	IdMap individuals;
-	while (getline(input, line)) {
-		if (line.empty())
-			continue;
-		//
-		IndInfo * info = NULL;
-		size_t myID = 0;
+
+/** Parse lines in [p, end) of a pedigree file. Each line has an individual
+ *  ID, up to two parental IDs, an optional sex (M/F) and affection status
+ *  (A/U), \e nFields information fields, and genotypes. Tokens are
+ *  separated by spaces.
+ */
+static void parsePedChunk(const char * p, const char * end, size_t nFields, PedChunk & chunk)
+{
+	while (p < end) {
+		const char * lineEnd = static_cast<const char *>(memchr(p, '\n', end - p));
+		if (lineEnd == NULL)
+			lineEnd = end;
+		PedRecord rec;
+		rec.numParents = 0;
+		rec.sex = MALE;
+		rec.affected = false;
+		rec.fieldBegin = chunk.fields.size();
+		rec.genoBegin = chunk.genotype.size();
 		int part = 0;
-		char * p = strtok(const_cast<char *>(line.c_str()), " ");
-		// boost::tokenizer is proven to be too slow..... (5.5s vs. 1.5s)
-		while (p) {
-			char * q = p;
-			p = strtok(NULL, " ");
+		while (true) {
+			while (p < lineEnd && *p == ' ')
+				++p;
+			if (p == lineEnd)
+				break;
+			const char * q = p;
+			while (p < lineEnd && *p != ' ')
+				++p;
 			// collect self ID
 			if (part == 0) {
-				myID = atoi(q);
-				if (individuals.find(myID) != individuals.end())
-					throw ValueError((boost::format("Duplicate individual ID %1%") % myID).str());
-				info = (individuals.insert(IdMap::value_type(myID, new IndInfo())).first)->second;
+				rec.id = parsePedInt(q, p);
 				++part;
 				continue;
 				// parental ID and sex
 			} else if (part == 1) {
 				if (*q == 'M') {
-					info->sex = MALE;
+					rec.sex = MALE;
 					++part;
 					continue;
 				} else if (*q == 'F') {
-					info->sex = FEMALE;
+					rec.sex = FEMALE;
 					++part;
 					continue;
 				} else {
-					size_t id = atoi(q);
+					size_t id = parsePedInt(q, p);
 					if (id) {
-						info->parents.push_back(id);
-						IdMap::iterator it = individuals.find(id);
-						// this is a parent but we do not know if he or she has parent
-						if (it == individuals.end())
-							individuals[id] = new IndInfo(myID);
-						else
-							it->second->offspring.push_back(myID);
+						if (rec.numParents == 2) {
+							chunk.error = "At most two parental IDs are allowed before sex information";
+							return;
+						}
+						rec.parents[rec.numParents++] = id;
 					}
-					if (info->parents.size() > 2)
-						throw ValueError("At most two parental IDs are allowed before sex information");
 				}
 				// parental affection status, can be ignored
 			} else if (part == 2) {
 				if (*q == 'A')
-					info->affectionStatus = true;
+					rec.affected = true;
 				else if (*q == 'U')
-					info->affectionStatus = false;
+					rec.affected = false;
 				else
 					++part;
 			}
 
 			// information fields, can be ignored
 			if (part == 3) {
-				if (info->fields.size() == infoFields.size())
+				if (chunk.fields.size() - rec.fieldBegin == nFields)
 					++part;
 				else
-					info->fields.push_back(atof(q));
+					chunk.fields.push_back(parsePedFloat(q, p));
 			}
 
 			// genotype
 			if (part == 4)
-				info->genotype.push_back(TO_ALLELE(atoi(q)));
+				chunk.genotype.push_back(TO_ALLELE(parsePedInt(q, p)));
 		}
+		p = lineEnd + 1;
 		// if there is no valid input...
 		if (part == 0)
 			continue;
-		if (!info->genotype.empty()) {
-			if (loci.empty()) {
-				loci.push_back(info->genotype.size() / pldy);
-				genoCols = info->genotype.size();
-				if (loci.back() * pldy != genoCols)
-					throw ValueError("Incorrect number of genotype colmns for a diploid population.");
-			} else {
-				if (genoCols != info->genotype.size())
-					throw ValueError("Inconsistent number of columns of genotypes.");
+		rec.numFields = chunk.fields.size() - rec.fieldBegin;
+		rec.numGeno = chunk.genotype.size() - rec.genoBegin;
+		chunk.records.push_back(rec);
+	}
+}
+
+
+/// Set ID, parents, sex, affection status, information fields and genotype
+/// of individuals in \e pop from records of pedigree members.
+static void setPedInds(Population & pop, const vectoru & members, const vectoru & ids,
+                       const vector<const PedRecord *> & records, const vector<const PedChunk *> & chunks,
+                       size_t fieldIndex, size_t nFields, bool setParents)
+{
+	size_t nLoci = pop.totNumLoci();
+	size_t ploidy = pop.ploidy();
+	ssize_t popSize = static_cast<ssize_t>(pop.popSize());
+
+	// individuals are set in parallel unless genotypes of different individuals
+	// are stored in the same memory block (mutant) or word (binary)
+#if !defined(BINARYALLELE) && !defined(MUTANTALLELE)
+#  pragma omp parallel for if(numThreads() > 1)
+#endif
+	for (ssize_t i = 0; i < popSize; ++i) {
+		Individual & ind = *(pop.rawIndBegin() + i);
+		size_t m = members[i];
+		ind.setInfo(static_cast<double>(ids[m]), 0);
+		const PedRecord * rec = records[m];
+		// a parent that does not have its own record
+		if (rec == NULL) {
+			ind.setSex(MALE);
+			ind.setAffected(false);
+			continue;
+		}
+		if (setParents)
+			for (size_t p = 0; p < rec->numParents; ++p)
+				ind.setInfo(static_cast<double>(rec->parents[p]), 1 + p);
+		ind.setSex(rec->sex);
+		ind.setAffected(rec->affected);
+		const PedChunk * chunk = chunks[m];
+		for (size_t f = 0; f < nFields && f < rec->numFields; ++f)
+			ind.setInfo(chunk->fields[rec->fieldBegin + f], f + fieldIndex);
+		if (rec->numGeno == 0)
+			continue;
+		GenoIterator geno = ind.genoBegin();
+		vectora::const_iterator allele = chunk->genotype.begin() + rec->genoBegin;
+		for (size_t loc = 0; loc < nLoci; ++loc)
+			for (size_t p = 0; p < ploidy; ++p, ++allele)
+#ifdef MUTANTALLELE
+				(geno + loc + p * nLoci).assignIfDiffer(*allele);
+#else
+				*(geno + loc + p * nLoci) = *allele;
+#endif
+	}
+}
+
+
+/// Read values from part of a binary pedigree file
+class PedReader
+{
+public:
+	PedReader(const char * data, size_t size) : m_ptr(data), m_end(data + size)
+	{
+	}
+
+
+	template<typename T>
+	T read()
+	{
+		T value;
+
+		memcpy(&value, skip(sizeof(T)), sizeof(T));
+		return value;
+	}
+
+
+	string readString()
+	{
+		size_t len = read<uint32_t>();
+		const char * p = skip(len);
+
+		return string(p, p + len);
+	}
+
+
+	/// skip \e len bytes and return the beginning of skipped bytes
+	const char * skip(size_t len)
+	{
+		if (static_cast<size_t>(m_end - m_ptr) < len)
+			throw ValueError("Corrupted binary pedigree file.");
+		const char * p = m_ptr;
+		m_ptr += len;
+		return p;
+	}
+
+
+private:
+	const char * m_ptr;
+	const char * m_end;
+};
+
+
+/// Load a pedigree from a binary file mapped to [data, data + size)
+static Pedigree loadBinaryPedigree(const char * data, size_t size, const string & idField,
+                                   const string & fatherField, const string & motherField,
+                                   const stringMatrix & alleleNames, const stringList & subPopNames,
+                                   const vectorstr & infoFields, const uintList & ancGens)
+{
+	PedReader header(data, size);
+
+	header.skip(8);
+	if (header.read<uint32_t>() != 0x01020304)
+		throw ValueError("Binary pedigree file is saved on a platform with a different byte order.");
+	if (header.read<uint32_t>() != 1)
+		throw ValueError("Binary pedigree file is saved by a newer version of simuPOP.");
+	bool compress = header.read<uint8_t>() != 0;
+	int width = header.read<uint8_t>();
+	if (width != 0 && width != 1 && width != 4 && width != 8)
+		throw ValueError("Corrupted binary pedigree file.");
+	if (width == 8 && ModuleMaxAllele <= 0xFFFFFFFFUL)
+		throw ValueError("Binary pedigree file has alleles that are too large for this module.");
+	float ploidy = header.read<float>();
+	size_t pldy = ploidy == HAPLODIPLOID ? 2 : static_cast<size_t>(ploidy);
+	// genotypic structure
+	size_t nChrom = header.read<uint32_t>();
+	vectoru loci(nChrom);
+	vectoru chromTypes(nChrom);
+	vectorstr chromNames(nChrom);
+	for (size_t i = 0; i < nChrom; ++i) {
+		loci[i] = header.read<uint32_t>();
+		chromTypes[i] = header.read<int32_t>();
+		chromNames[i] = header.readString();
+	}
+	size_t nLoci = accumulate(loci.begin(), loci.end(), size_t(0));
+	vectorf lociPos(nLoci);
+	vectorstr lociNames(nLoci);
+	for (size_t i = 0; i < nLoci; ++i) {
+		lociPos[i] = header.read<double>();
+		lociNames[i] = header.readString();
+	}
+	header.readString();
+	// parents saved in the file, which are loaded only if requested
+	bool fileHasFather = !header.readString().empty();
+	bool fileHasMother = !header.readString().empty();
+	bool hasFather = fileHasFather && !fatherField.empty();
+	bool hasMother = fileHasMother && !motherField.empty();
+	size_t nFields = header.read<uint32_t>();
+	vectorstr fieldNames(nFields);
+	for (size_t i = 0; i < nFields; ++i)
+		fieldNames[i] = header.readString();
+	if (!infoFields.empty()) {
+		if (infoFields.size() != nFields)
+			throw ValueError((boost::format("%1% information fields are saved in the binary pedigree file.") % nFields).str());
+		fieldNames = infoFields;
+	}
+	size_t nGens = header.read<uint32_t>();
+	vector<uint64_t> table(nGens * 3);
+	for (size_t i = 0; i < table.size(); ++i)
+		table[i] = header.read<uint64_t>();
+	//
+	vectorstr fields(1, idField);
+	if (hasFather)
+		fields.push_back(fatherField);
+	if (hasMother)
+		fields.push_back(motherField);
+	size_t fieldIndex = fields.size();
+	fields.insert(fields.end(), fieldNames.begin(), fieldNames.end());
+	// generations to load, from the top-most ancestral generation
+	vectoru gens;
+	if (ancGens.allAvail()) {
+		for (size_t gen = 0; gen < nGens; ++gen)
+			gens.push_back(gen);
+	} else {
+		gens = ancGens.elems();
+		for (size_t i = 0; i < gens.size(); ++i)
+			if (gens[i] >= nGens)
+				throw IndexError((boost::format("Ancestral generation %1% does not exist in the binary pedigree file.") % gens[i]).str());
+		std::sort(gens.begin(), gens.end());
+		gens.erase(std::unique(gens.begin(), gens.end()), gens.end());
+	}
+	if (gens.empty())
+		return Population(0, ploidy, loci, chromTypes, lociPos,
+			-1, chromNames, alleleNames, lociNames, subPopNames, fields);
+	//
+	Population pop;
+	for (ssize_t g = static_cast<ssize_t>(gens.size()) - 1; g >= 0; --g) {
+		// generations are saved from the top-most ancestral generation
+		size_t idx = nGens - 1 - gens[g];
+		size_t n = table[idx * 3];
+		size_t offset = table[idx * 3 + 1];
+		size_t length = table[idx * 3 + 2];
+		if (offset > size || size - offset < length)
+			throw ValueError("Corrupted binary pedigree file.");
+		string buf;
+		const char * blockData = data + offset;
+		if (compress) {
+			boost::iostreams::filtering_istream in;
+			in.push(boost::iostreams::gzip_decompressor());
+			in.push(boost::iostreams::array_source(blockData, length));
+			boost::iostreams::copy(in, boost::iostreams::back_inserter(buf));
+			blockData = buf.data();
+			length = buf.size();
+		}
+		PedReader block(blockData, length);
+		const char * ids = block.skip(n * sizeof(uint64_t));
+		const char * fathers = fileHasFather ? block.skip(n * sizeof(uint64_t)) : NULL;
+		const char * mothers = fileHasMother ? block.skip(n * sizeof(uint64_t)) : NULL;
+		const char * status = block.skip(n);
+		const char * info = block.skip(n * nFields * sizeof(double));
+		size_t genoSize = n * pldy * nLoci;
+		const unsigned char * geno = reinterpret_cast<const unsigned char *>(
+			block.skip(width == 0 ? (genoSize + 7) / 8 : genoSize * width));
+
+		Population genPop(vectoru(1, n), ploidy, loci, chromTypes, lociPos,
+		                  g == static_cast<ssize_t>(gens.size()) - 1 ? -1 : 0,
+		                  chromNames, alleleNames, lociNames, subPopNames, fields);
+		size_t indSize = pldy * nLoci;
+		// individuals are set in parallel unless genotypes of different individuals
+		// are stored in the same memory block (mutant) or word (binary)
+#if !defined(BINARYALLELE) && !defined(MUTANTALLELE)
+#  pragma omp parallel for if(numThreads() > 1)
+#endif
+		for (ssize_t i = 0; i < static_cast<ssize_t>(n); ++i) {
+			Individual & ind = *(genPop.rawIndBegin() + i);
+			uint64_t id;
+			memcpy(&id, ids + i * sizeof(uint64_t), sizeof(uint64_t));
+			ind.setInfo(static_cast<double>(id), 0);
+			size_t fieldIdx = 1;
+			if (hasFather) {
+				memcpy(&id, fathers + i * sizeof(uint64_t), sizeof(uint64_t));
+				ind.setInfo(static_cast<double>(id), fieldIdx++);
+			}
+			if (hasMother) {
+				memcpy(&id, mothers + i * sizeof(uint64_t), sizeof(uint64_t));
+				ind.setInfo(static_cast<double>(id), fieldIdx);
+			}
+			ind.setSex(status[i] & 1 ? FEMALE : MALE);
+			ind.setAffected((status[i] & 2) != 0);
+			for (size_t f = 0; f < nFields; ++f) {
+				double value;
+				memcpy(&value, info + (i * nFields + f) * sizeof(double), sizeof(double));
+				ind.setInfo(value, fieldIndex + f);
+			}
+			GenoIterator ptr = ind.genoBegin();
+			for (size_t j = 0, k = i * indSize; j < indSize; ++j, ++k) {
+				ULONG allele = 0;
+				if (width == 0)
+					allele = (geno[k / 8] >> (k % 8)) & 1;
+				else if (width == 1)
+					allele = geno[k];
+				else if (width == 4) {
+					uint32_t value;
+					memcpy(&value, geno + k * 4, 4);
+					allele = value;
+				} else {
+					uint64_t value;
+					memcpy(&value, geno + k * 8, 8);
+					allele = static_cast<ULONG>(value);
+				}
+#ifdef MUTANTALLELE
+				if (allele != 0)
+					(ptr + j).assignIfDiffer(allele);
+#else
+				*(ptr + j) = TO_ALLELE(allele);
+#endif
 			}
 		}
-		//
-		if (max_parents < info->parents.size())
-			max_parents = info->parents.size();
+		if (g == static_cast<ssize_t>(gens.size()) - 1)
+			pop.swap(genPop);
+		else
+			pop.push(genPop);
 	}
+	return Pedigree(pop, lociList(), pop.infoFields(), uintList(),
+		idField, hasFather ? fatherField : string(),
+		hasMother ? motherField : string(), true);
+}
+
+
+Pedigree loadPedigree(const string & file, const string & idField, const string & fatherField,
+                      const string & motherField, float ploidy, const uintList & _lociList, const uintList & chromTypes,
+                      const floatList & lociPos, const stringList & chromNames, const stringMatrix & alleleNames,
+                      const stringList & lociNames, const stringList & subPopNames, const stringList & fieldList,
+                      const uintList & ancGens)
+{
+	initClock();
+	int pldy = ploidy == HAPLODIPLOID ? 2 : static_cast<int>(ploidy);
+	//
+	const vectorstr & infoFields = fieldList.elems();
+
+	for (size_t i = 0; i < infoFields.size(); ++i) {
+		DBG_FAILIF(infoFields[i] == idField || infoFields[i] == fatherField || infoFields[i] == motherField,
+			ValueError, "Parameter infoFields can only specify additional fields other than idField, fatherField and motherField.");
+	}
+	vectoru loci = _lociList.elems();
+	size_t genoCols = accumulate(loci.begin(), loci.end(), size_t(0)) * pldy;
+
+	ifstream input(file.c_str(), std::ios::binary | std::ios::ate);
+	if (!input)
+		throw RuntimeError("Cannot open specified pedigree file " + file);
+	size_t fileSize = static_cast<size_t>(input.tellg());
 	input.close();
+	//
+	// The file is mapped to memory and split into line-aligned chunks that
+	// are parsed in parallel.
+	boost::iostreams::mapped_file_source mapped;
+	const char * data = NULL;
+	if (fileSize > 0) {
+		try {
+			mapped.open(file);
+		} catch (const std::exception & e) {
+			throw RuntimeError("Cannot open specified pedigree file " + file + ": " + e.what());
+		}
+		data = mapped.data();
+		fileSize = mapped.size();
+		if (fileSize >= 8 && memcmp(data, PED_MAGIC, 8) == 0)
+			return loadBinaryPedigree(data, fileSize, idField, fatherField, motherField,
+				alleleNames, subPopNames, infoFields, ancGens);
+	}
+	size_t nChunks = std::min(static_cast<size_t>(numThreads()) * 4, fileSize / 1048576 + 1);
+	vectoru chunkBegin(nChunks + 1, fileSize);
+	chunkBegin[0] = 0;
+	for (size_t c = 1; c < nChunks; ++c) {
+		size_t pos = std::max(chunkBegin[c - 1], fileSize / nChunks * c);
+		const char * nl = pos < fileSize ? static_cast<const char *>(memchr(data + pos, '\n', fileSize - pos)) : NULL;
+		chunkBegin[c] = nl == NULL ? fileSize : nl - data + 1;
+	}
+	vector<PedChunk> chunks(nChunks);
+#pragma omp parallel for if(numThreads() > 1)
+	for (ssize_t c = 0; c < static_cast<ssize_t>(nChunks); ++c)
+		parsePedChunk(data + chunkBegin[c], data + chunkBegin[c + 1], infoFields.size(), chunks[c]);
+	mapped.close();
+	//
+	size_t max_parents = 0;
+	size_t nRecords = 0;
+	for (size_t c = 0; c < nChunks; ++c) {
+		if (!chunks[c].error.empty())
+			throw ValueError(chunks[c].error);
+		const vector<PedRecord> & records = chunks[c].records;
+		nRecords += records.size();
+		for (size_t r = 0; r < records.size(); ++r) {
+			const PedRecord & rec = records[r];
+			if (rec.numGeno != 0) {
+				if (loci.empty()) {
+					loci.push_back(rec.numGeno / pldy);
+					genoCols = rec.numGeno;
+					if (loci.back() * pldy != genoCols)
+						throw ValueError("Incorrect number of genotype colmns for a diploid population.");
+				} else {
+					if (genoCols != rec.numGeno)
+						throw ValueError("Inconsistent number of columns of genotypes.");
+				}
+			}
+			if (max_parents < rec.numParents)
+				max_parents = rec.numParents;
+		}
+	}
 	elapsedTime("Readfile");
-	DBG_DO(DBG_POPULATION, cerr << "Information about " << individuals.size() << " individuals are loaded." << endl);
+	//
+	// individuals (with or without their own records) are identified by
+	// their indexes in sorted IDs.
+	vectoru ids;
+	ids.reserve(nRecords * 2);
+	for (size_t c = 0; c < nChunks; ++c) {
+		const vector<PedRecord> & records = chunks[c].records;
+		for (size_t r = 0; r < records.size(); ++r) {
+			ids.push_back(records[r].id);
+			for (size_t p = 0; p < records[r].numParents; ++p)
+				ids.push_back(records[r].parents[p]);
+		}
+	}
+	std::sort(ids.begin(), ids.end());
+	ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+	size_t nInds = ids.size();
+	vector<const PedRecord *> indRecord(nInds, NULL);
+	vector<const PedChunk *> indChunk(nInds, NULL);
+	// number of offspring, and then the beginning of offspring of each individual
+	vectoru offBegin(nInds + 1, 0);
+	for (size_t c = 0; c < nChunks; ++c) {
+		const vector<PedRecord> & records = chunks[c].records;
+		for (size_t r = 0; r < records.size(); ++r) {
+			const PedRecord & rec = records[r];
+			size_t idx = std::lower_bound(ids.begin(), ids.end(), rec.id) - ids.begin();
+			if (indRecord[idx] != NULL)
+				throw ValueError((boost::format("Duplicate individual ID %1%") % rec.id).str());
+			indRecord[idx] = &rec;
+			indChunk[idx] = &chunks[c];
+			for (size_t p = 0; p < rec.numParents; ++p)
+				++offBegin[std::lower_bound(ids.begin(), ids.end(), rec.parents[p]) - ids.begin() + 1];
+		}
+	}
+	for (size_t i = 0; i < nInds; ++i)
+		offBegin[i + 1] += offBegin[i];
+	vectoru offspring(offBegin.back());
+	vectoru offEnd(offBegin.begin(), offBegin.end() - 1);
+	for (size_t i = 0; i < nInds; ++i) {
+		const PedRecord * rec = indRecord[i];
+		if (rec == NULL)
+			continue;
+		for (size_t p = 0; p < rec->numParents; ++p)
+			offspring[offEnd[std::lower_bound(ids.begin(), ids.end(), rec->parents[p]) - ids.begin()]++] = i;
+	}
+	DBG_DO(DBG_POPULATION, cerr << "Information about " << nInds << " individuals are loaded." << endl);
 	// create the top most ancestral generation
 	// find parents who do not have parents...
 	vectorstr fields(1, idField);
@@ -1468,92 +2046,60 @@ Pedigree loadPedigree(const string & file, const string & idField, const string
 	fields.insert(fields.end(), infoFields.begin(), infoFields.end());
 	DBG_DO(DBG_POPULATION, cerr << "Using information fields " << fields << endl);
 	//
-	if (individuals.empty()) {
+	if (nInds == 0) {
 		return Population(0, ploidy, loci, chromTypes, lociPos,
 			-1, chromNames, alleleNames, lociNames, subPopNames, fields);
 	}
 	//
-	typedef std::set<size_t> IdSet;
-	IdSet parents;
-	IdMap::iterator it = individuals.begin();
-	IdMap::iterator it_end = individuals.end();
-	for (; it != it_end; ++it)
-		if (it->second->parents.empty())
-			parents.insert(it->first);
+	vectoru parents;
+	for (size_t i = 0; i < nInds; ++i)
+		if (indRecord[i] == NULL || indRecord[i]->numParents == 0)
+			parents.push_back(i);
 	if (parents.empty())
 		throw ValueError("No parents in the top-most ancestral generation");
 	//
 	Population pop(vectoru(1, parents.size()), ploidy, loci, chromTypes, lociPos,
 	               -1, chromNames, alleleNames, lociNames, subPopNames, fields);
-	// set individual info
-	RawIndIterator ind = pop.rawIndBegin();
-	RawIndIterator ind_end = pop.rawIndEnd();
-	IdSet::iterator pit = parents.begin();
-	for (; ind != ind_end; ++ind, ++pit) {
-		ind->setInfo(static_cast<double>(*pit), 0);
-		const IndInfo * info = individuals.find(*pit)->second;
-		ind->setSex(info->sex);
-		ind->setAffected(info->affectionStatus);
-		for (size_t i = 0; i < infoFields.size() && i < info->fields.size(); ++i)
-			ind->setInfo(info->fields[i], i + fieldIndex);
-		for (size_t i = 0, k = 0; i < genoCols / pldy; ++i)
-			for (int j = 0; j < pldy; ++j, ++k)
-				ind->setAllele(info->genotype[k], i, j);
-	}
+	setPedInds(pop, parents, ids, indRecord, indChunk, fieldIndex, infoFields.size(), false);
 	DBG_DO(DBG_POPULATION, cerr << parents.size() << " individuals are located for the top-most ancestral generation" << endl);
 	//
-	while (true) {
-		if (parents.empty())
-			break;
-		//
-		IdSet offspring;
-		pit = parents.begin();
-		IdSet::iterator pit_end = parents.end();
-		for (; pit != pit_end; ++pit) {
-			const IdMap::const_iterator info = individuals.find(*pit);
-			const vectoru & off = info->second->offspring;
-			for (size_t i = 0; i < off.size(); ++i)
-				offspring.insert(off[i]);
+	// Each generation consists of offspring of the previous generation,
+	// so an individual with parents from different generations appears
+	// in more than one generation. The generation in which an individual
+	// is last added is used to avoid adding an individual twice to a
+	// generation.
+	vectoru addedGen(nInds, 0);
+	for (size_t gen = 1; ; ++gen) {
+		vectoru offIdx;
+		for (size_t i = 0; i < parents.size(); ++i) {
+			for (size_t j = offBegin[parents[i]]; j < offBegin[parents[i] + 1]; ++j) {
+				if (addedGen[offspring[j]] != gen) {
+					addedGen[offspring[j]] = gen;
+					offIdx.push_back(offspring[j]);
+				}
+			}
 		}
-		DBG_DO(DBG_POPULATION, cerr << offspring.size() << " individuals are located from "
-			                        << individuals.size() << " individuals for an ancestral generation" << endl);
+		DBG_DO(DBG_POPULATION, cerr << offIdx.size() << " individuals are located from "
+			                        << nInds << " individuals for an ancestral generation" << endl);
 
-		if (offspring.empty())
+		if (offIdx.empty())
 			break;
+		if (gen > nInds)
+			throw ValueError("Individuals in the pedigree are their own ancestors.");
+		std::sort(offIdx.begin(), offIdx.end());
 
-		Population off_pop(vectoru(1, offspring.size()), ploidy, loci, chromTypes, lociPos,
+		Population off_pop(vectoru(1, offIdx.size()), ploidy, loci, chromTypes, lociPos,
 		                   0, chromNames, alleleNames, lociNames, subPopNames, fields);
-		// set individual info
-		ind = off_pop.rawIndBegin();
-		ind_end = off_pop.rawIndEnd();
-		pit = offspring.begin();
-		for (; ind != ind_end; ++ind, ++pit) {
-			ind->setInfo(static_cast<double>(*pit), 0);
-			const IndInfo * info = individuals.find(*pit)->second;
-			for (size_t i = 0; i < info->parents.size(); ++i)
-				ind->setInfo(static_cast<double>(info->parents[i]), 1 + i);
-			ind->setSex(info->sex);
-			ind->setAffected(info->affectionStatus);
-			for (size_t i = 0; i < infoFields.size() && i < info->fields.size(); ++i)
-				ind->setInfo(info->fields[i], i + fieldIndex);
-			for (size_t i = 0, k = 0; i < genoCols / pldy; ++i)
-				for (int j = 0; j < pldy; ++j, ++k)
-					ind->setAllele(info->genotype[k], i, j);
-		}
+		setPedInds(off_pop, offIdx, ids, indRecord, indChunk, fieldIndex, infoFields.size(), true);
 		//
-		parents.swap(offspring);
+		parents.swap(offIdx);
 		pop.push(off_pop);
 	}
 	elapsedTime("Generation");
 	DBG_DO(DBG_POPULATION, cerr << "A pedigree with " << pop.ancestralGens()
 		                        << " ancestral generations are created." << endl);
 
-	it = individuals.begin();
-	it_end = individuals.end();
-	for (; it != it_end; ++it)
-		delete it->second;
-	// uintList means ALL_AVAIL
-	return Pedigree(pop, lociList(), pop.infoFields(), uintList(),
+	return Pedigree(pop, lociList(), pop.infoFields(), ancGens,
 		idField, max_parents > 0 ? fatherField : string(),
 		max_parents > 1 ? motherField : string(), true);
 }
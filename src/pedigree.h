@@ -88,6 +88,20 @@ public:
 	}
 
 
+	/// CPPONLY Index of the father field, -1 if the pedigree has no father.
+	int fatherIdx() const
+	{
+		return m_fatherIdx;
+	}
+
+
+	/// CPPONLY Index of the mother field, -1 if the pedigree has no mother.
+	int motherIdx() const
+	{
+		return m_motherIdx;
+	}
+
+
 	/// CPPONLY Return the ID of the father of individual id.
 	/// return 0 if id is zero or invalid, or father_idx is -1.
 	size_t fatherOf(size_t id) const
@@ -134,10 +148,22 @@ public:
 	 *  parental IDs will be set to zero if the parent is not in the pedigree
 	 *  object. Therefore, the parents of individuals in the top-most ancestral
 	 *  generation will always be zero.
+	 *
+	 *  If \e format is set to \c 'binary' (or \c 'binary.gz'), the pedigree
+	 *  is saved in a binary format with a header that describes the genotypic
+	 *  structure of saved loci, names of information fields, and the location
+	 *  of each generation in the file, followed by each generation with
+	 *  columns of IDs, parental IDs, sex and affection status, a matrix of
+	 *  information fields, and bit- or byte-packed genotypes at specified
+	 *  loci (saved in the order of loci indexes). Generations are compressed
+	 *  separately if \c 'binary.gz' is used. Binary files can be loaded using
+	 *  function \c loadPedigree, which reads the genotypic structure and names
+	 *  of information fields from the file, and can load selected generations
+	 *  without reading the rest of the file.
 	 *  <group>1-ped</group>
 	 */
 	void save(const string & filename, const stringList & infoFields = vectorstr(),
-		const lociList & loci = vectoru()) const;
+		const lociList & loci = vectoru(), const string & format = "text") const;
 
 	/** Return a reference to individual with \e id. An \c IndexError will be
 	 *  raised if no individual with \e id is found. An float \e id is
@@ -355,6 +381,10 @@ public:
 private:
 	void buildIDMap();
 
+	/// save pedigree in binary format
+	void saveBinary(const string & filename, const vectorstr & fields, const vectoru & indexes,
+		const vectoru & loci, bool compress) const;
+
 	bool acceptableSex(Sex mySex, Sex relSex, SexChoice choice);
 
 	bool acceptableAffectionStatus(bool affected, AffectionStatus choice);
@@ -436,6 +466,14 @@ private:
  *  \e chromTypes, \e lociPos, \e chromNames, \e alleleNames, \e lociNames
  *  could be used to specified the genotype structured of the loaded pedigree.
  *  Please refer to class \c Population for details about these parameters.
+ *
+ *  If the file is saved by function \c Pedigree.save in binary format,
+ *  generations are loaded as they are saved, and the genotypic structure and
+ *  names of information fields are read from the file. Parameter
+ *  \e infoFields can be used to rename all saved information fields. In
+ *  both cases, parameter \e ancGens can be used to load only specified
+ *  ancestral generations (default to all generations), and only these
+ *  generations are read from binary files.
  */
 Pedigree loadPedigree(const string & file,
 	const string & idField = "ind_id",
@@ -449,7 +487,8 @@ Pedigree loadPedigree(const string & file,
 	const stringMatrix & alleleNames = stringMatrix(),
 	const stringList & lociNames = vectorstr(),
 	const stringList & subPopNames = vectorstr(),
-	const stringList & infoFields = vectorstr());
+	const stringList & infoFields = vectorstr(),
+	const uintList & ancGens = uintList());
 
 }
 #endif
@@ -56,6 +56,9 @@ bool BasePenetrance::apply(Population & pop) const
 		pop.useAncestralGen(gens[genIdx]);
 
 		subPopList subPops = applicableSubPops(pop);
+		// so that a MlPenetrance can test individuals of virtual subpopulations
+		if (pop.virtualSplitter())
+			pop.virtualSplitter()->prepare(pop);
 
 		subPopList::const_iterator sp = subPops.begin();
 		subPopList::const_iterator spEnd = subPops.end();
@@ -62,8 +62,17 @@ Population::Population(const uintList & size,
 #endif
 	m_info(0),
 	m_inds(0),
+#ifdef LINEAGE
+	m_buffers(&m_genotype, &m_info, &m_lineage),
+#else
+	m_buffers(&m_genotype, &m_info),
+#endif
 	m_ancestralGens(ancGen),
 	m_vars(NULL, true),
+	m_genealogy(NULL),
+#ifdef LONGALLELE
+	m_mutantRegistry(),
+#endif
 	m_ancestralPops(0),
 	m_curAncestralGen(0),
 	m_indOrdered(true),
@@ -105,6 +114,9 @@ Population::~Population()
 	if (m_vspSplitter)
 		delete m_vspSplitter;
 
+	if (m_genealogy)
+		delete m_genealogy;
+
 	decGenoStruRef();
 }
 
@@ -122,8 +134,17 @@ Population::Population(const Population & rhs) :
 #endif
 	m_info(0),
 	m_inds(0),
+#ifdef LINEAGE
+	m_buffers(&m_genotype, &m_info, &m_lineage),
+#else
+	m_buffers(&m_genotype, &m_info),
+#endif
 	m_ancestralGens(rhs.m_ancestralGens),
 	m_vars(rhs.m_vars),                                                                     // variables will be copied
+	m_genealogy(rhs.m_genealogy ? rhs.m_genealogy->clone() : NULL),
+#ifdef LONGALLELE
+	m_mutantRegistry(rhs.m_mutantRegistry),
+#endif
 	m_curAncestralGen(rhs.m_curAncestralGen),
 	m_indOrdered(true),
 	m_gen(rhs.m_gen),
@@ -132,9 +153,13 @@ Population::Population(const Population & rhs) :
 	DBG_DO(DBG_POPULATION,
 		cerr << "Copy constructor of population is called" << endl);
 
+	// shared genotypes remain shared by the copy
+	bool shared = rhs.m_buffers.sharesGenotype();
+
 	try {
 		m_inds.resize(rhs.m_popSize);
-		m_genotype.resize(m_popSize * genoSize());
+		if (!shared)
+			m_genotype.resize(m_popSize * genoSize());
 		LINEAGE_EXPR(m_lineage.resize(m_popSize * genoSize()));
 		// have 0 length for mpi/non-head node
 		m_info.resize(rhs.m_popSize * infoSize());
@@ -151,57 +176,31 @@ Population::Population(const Population & rhs) :
 	setGenoStruIdx(rhs.genoStruIdx());
 	incGenoStruRef();   // inc ref to the new
 
-	// copy genotype one by one so Individual genoPtr will not
-	// point outside of subpopulation region.
-	InfoIterator infoPtr = m_info.begin();
-	size_t infoStep = infoSize();
-	size_t step = genoSize();
-	GenoIterator ptr = m_genotype.begin();
-#ifdef LINEAGE
-	LineageIterator lineagePtr = m_lineage.begin();
-	for (size_t i = 0; i < m_popSize; ++i, ptr += step, lineagePtr += step, infoPtr += infoStep) {
-		m_inds[i].setLineagePtr(lineagePtr);
-#else
-	for (size_t i = 0; i < m_popSize; ++i, ptr += step, infoPtr += infoStep) {
-#endif
-		m_inds[i].setGenoPtr(ptr);
-		m_inds[i].setInfoPtr(infoPtr);
-		m_inds[i].copyFrom(rhs.m_inds[i]);
+	size_t idx = m_buffers.index();
+	if (shared) {
+		// individuals keep their slots in the copied and shared buffers
+		m_buffers.shareGenotype(rhs.m_buffers.index());
+		LINEAGE_EXPR(copy(rhs.m_lineage.begin(), rhs.m_lineage.end(), m_lineage.begin()));
+		copy(rhs.m_info.begin(), rhs.m_info.end(), m_info.begin());
+		for (size_t i = 0; i < m_popSize; ++i) {
+			m_inds[i] = rhs.m_inds[i];
+			m_inds[i].setBufferIdx(idx);
+		}
+		m_indOrdered = rhs.m_indOrdered;
+	} else {
+		// copy genotype one by one so Individual genoPtr will not
+		// point outside of subpopulation region.
+		for (size_t i = 0; i < m_popSize; ++i) {
+			m_inds[i].setSlot(idx, i);
+			m_inds[i].copyFrom(rhs.m_inds[i]);
+		}
 	}
 
 	// copy ancestral populations
 	try {
-		// copy all. Individual will be shallow copied
+		// copy all. Individuals are shallow copied and refer to the
+		// copied buffers.
 		m_ancestralPops = rhs.m_ancestralPops;
-		// need to setGenoPtr
-		for (size_t ap = 0; ap < m_ancestralPops.size(); ++ap) {
-			popData & lp = m_ancestralPops[ap];
-			const popData & rp = rhs.m_ancestralPops[ap];
-
-			vector<Individual> & linds = lp.m_inds;
-			const vector<Individual> & rinds = rp.m_inds;
-			GenoIterator lg = lp.m_genotype.begin();
-#ifdef MUTANTALLELE
-			GenoIterator rg = const_cast<vectorm &>(rp.m_genotype).begin();
-#else
-			ConstGenoIterator rg = rp.m_genotype.begin();
-#endif
-#ifdef LINEAGE
-			LineageIterator llin = lp.m_lineage.begin();
-			ConstLineageIterator rlin = rp.m_lineage.begin();
-#endif
-
-			InfoIterator li = lp.m_info.begin();
-			ConstInfoIterator ri = rp.m_info.begin();
-
-			size_t ps = rinds.size();
-
-			for (size_t i = 0; i < ps; ++i) {
-				linds[i].setGenoPtr(lg + (rinds[i].genoPtr() - rg));
-				linds[i].setInfoPtr(li + (rinds[i].infoPtr() - ri));
-				LINEAGE_EXPR(linds[i].setLineagePtr(rinds[i].lineagePtr() - rlin + llin));
-			}
-		}
 	} catch (...) {
 		cerr	<< "Unable to copy ancestral populations. "
 		        << "The popolation size may be too big." << endl
@@ -215,30 +214,68 @@ Population::Population(const Population & rhs) :
 }
 
 
-void Population::popData::swap(Population & pop)
+Population::popData::popData() :
+	m_subPopSize(), m_subPopNames(), m_genotype(),
+#ifdef LINEAGE
+	m_lineage(),
+#endif
+	m_info(), m_inds(), m_indOrdered(true),
+#ifdef LINEAGE
+	m_buffers(&m_genotype, &m_info, &m_lineage)
+#else
+	m_buffers(&m_genotype, &m_info)
+#endif
 {
-#ifdef MUTANTALLELE
-	size_t genoSize = 0;
-	if (m_inds.size() != 0)
-		genoSize = m_genotype.size() / m_inds.size();
+}
+
+
+Population::popData::popData(const popData & rhs) :
+	m_subPopSize(rhs.m_subPopSize), m_subPopNames(rhs.m_subPopNames), m_genotype(rhs.m_genotype),
+#ifdef LINEAGE
+	m_lineage(rhs.m_lineage),
+#endif
+	m_info(rhs.m_info), m_inds(rhs.m_inds), m_indOrdered(rhs.m_indOrdered),
+#ifdef LINEAGE
+	m_buffers(&m_genotype, &m_info, &m_lineage)
+#else
+	m_buffers(&m_genotype, &m_info)
 #endif
+{
+	for (size_t i = 0; i < m_inds.size(); ++i)
+		m_inds[i].setBufferIdx(m_buffers.index());
+	if (rhs.m_buffers.sharesGenotype())
+		m_buffers.shareGenotype(rhs.m_buffers.index());
+}
+
 
+Population::popData & Population::popData::operator=(const popData & rhs)
+{
+	m_subPopSize = rhs.m_subPopSize;
+	m_subPopNames = rhs.m_subPopNames;
+	m_buffers.releaseGenotype();
+	m_genotype = rhs.m_genotype;
+	LINEAGE_EXPR(m_lineage = rhs.m_lineage);
+	m_info = rhs.m_info;
+	m_inds = rhs.m_inds;
+	m_indOrdered = rhs.m_indOrdered;
+	for (size_t i = 0; i < m_inds.size(); ++i)
+		m_inds[i].setBufferIdx(m_buffers.index());
+	if (rhs.m_buffers.sharesGenotype())
+		m_buffers.shareGenotype(rhs.m_buffers.index());
+	return *this;
+}
+
+
+void Population::popData::swap(Population & pop)
+{
 	pop.m_subPopSize.swap(m_subPopSize);
 	pop.m_subPopNames.swap(m_subPopNames);
 	pop.m_genotype.swap(m_genotype);
 	LINEAGE_EXPR(pop.m_lineage.swap(m_lineage));
 	pop.m_info.swap(m_info);
 	pop.m_inds.swap(m_inds);
+	pop.m_buffers.swap(m_buffers);
 	std::swap(pop.m_indOrdered, m_indOrdered);
-#ifdef MUTANTALLELE
-	// vectorm must be setGenoPtr after swap
-	GenoIterator ptr = pop.m_genotype.begin();
-	for (size_t i = 0; i < pop.m_inds.size(); ++i, ptr += genoSize)
-		pop.m_inds[i].setGenoPtr(ptr);
-	ptr = m_genotype.begin();
-	for (size_t i = 0; i < m_inds.size(); ++i, ptr += pop.genoSize())
-		m_inds[i].setGenoPtr(ptr);
-#endif
 }
 
 
@@ -248,6 +285,39 @@ Population * Population::clone() const
 }
 
 
+Population * Population::snapshot() const
+{
+	Population * pop = new Population(*this);
+
+	pop->m_savedVars = varsAsString(true);
+	// release the copied dictionary so that the snapshot does not refer to
+	// any Python object
+	SharedVariables vars;
+	pop->m_vars.swap(vars);
+	return pop;
+}
+
+
+Population * Population::cloneSharingGenotype() const
+{
+	IndBuffers::makeGenotypeShared(m_buffers.index());
+	for (std::deque<popData>::const_iterator it = m_ancestralPops.begin();
+	     it != m_ancestralPops.end(); ++it)
+		IndBuffers::makeGenotypeShared(it->m_buffers.index());
+	// the copy constructor shares genotypes that are already shared
+	return new Population(*this);
+}
+
+
+void Population::detachGenotype() const
+{
+	m_buffers.detachGenotype();
+	for (std::deque<popData>::const_iterator it = m_ancestralPops.begin();
+	     it != m_ancestralPops.end(); ++it)
+		it->m_buffers.detachGenotype();
+}
+
+
 size_t Population::subPopByName(const string & name) const
 {
 	vectorstr::const_iterator it = find(m_subPopNames.begin(), m_subPopNames.end(), name);
@@ -446,11 +516,13 @@ pyIndIterator Population::individuals(vspID subPopID)
 	size_t vspID = subPop.virtualSubPop();
 	CHECKRANGEVIRTUALSUBPOP(vspID);
 #endif
-	if (subPop.isVirtual())
+	if (subPop.isVirtual()) {
+		// the splitter should be ready to test individuals before iteration
+		m_vspSplitter->prepare(*this);
 		return pyIndIterator(m_inds.begin() + subPopBegin(spID),
 			m_inds.begin() + subPopEnd(spID), false,
 			vspFunctor(*this, m_vspSplitter, subPop));
-	else
+	} else
 		return pyIndIterator(m_inds.begin() + subPopBegin(spID),
 			m_inds.begin() + subPopEnd(spID), true, vspFunctor());
 }
@@ -533,6 +605,7 @@ const Individual & Population::ancestor(double fidx, ssize_t gen, vspID vsp) con
 
 IndAlleleIterator Population::alleleIterator(size_t locus)
 {
+	detachGenotype();
 	CHECKRANGEABSLOCUS(locus);
 
 	// if there is virtual subpop, use Individual based iterator
@@ -554,6 +627,7 @@ IndAlleleIterator Population::alleleIterator(size_t locus)
 /// CPPONLY allele begin, for given subPop
 IndAlleleIterator Population::alleleIterator(size_t locus, size_t subPop)
 {
+	detachGenotype();
 	CHECKRANGEABSLOCUS(locus);
 	CHECKRANGESUBPOP(subPop);
 
@@ -574,6 +648,7 @@ IndAlleleIterator Population::alleleIterator(size_t locus, size_t subPop)
 
 ConstIndAlleleIterator Population::alleleIterator(size_t locus) const
 {
+	detachGenotype();
 	CHECKRANGEABSLOCUS(locus);
 
 	// if there is virtual subpop, use Individual based iterator
@@ -595,6 +670,7 @@ ConstIndAlleleIterator Population::alleleIterator(size_t locus) const
 /// CPPONLY allele begin, for given subPop
 ConstIndAlleleIterator Population::alleleIterator(size_t locus, size_t subPop) const
 {
+	detachGenotype();
 	CHECKRANGEABSLOCUS(locus);
 	CHECKRANGESUBPOP(subPop);
 
@@ -696,6 +772,7 @@ PyObject * Population::lineage(vspID subPopID)
 
 PyObject * Population::genotype(vspID subPopID)
 {
+	detachGenotype();
 
 	DBG_WARNIF(true, "The returned object of function Population.genotype() is a special "
 		             "carray object that reflects the underlying genotype of a "
@@ -725,6 +802,7 @@ PyObject * Population::genotype(vspID subPopID)
 
 pyMutantIterator Population::mutants(vspID subPopID)
 {
+	detachGenotype();
 	vspID vsp = subPopID.resolve(*this);
 
 	DBG_FAILIF(vsp.isVirtual(), ValueError,
@@ -746,6 +824,7 @@ pyMutantIterator Population::mutants(vspID subPopID)
 
 void Population::setGenotype(const uintList & genoList, vspID subPopID)
 {
+	detachGenotype();
 	const vectoru & geno = genoList.elems();
 
 	vspID subPop = subPopID.resolve(*this);
@@ -842,19 +921,21 @@ void Population::validate(const string & msg) const
 #else
 	DBG_ASSERT(m_info.size() == m_popSize * infoSize(), SystemError,
 		msg + "Wrong information size");
-	DBG_ASSERT(m_genotype.size() == m_popSize * genoSize(), SystemError,
+	// genotypes may be shared with other populations
+	IndBuffers::GenoBuffer & genotype = *IndBuffers::buffers(m_buffers.index()).geno;
+	DBG_ASSERT(genotype.size() == m_popSize * genoSize(), SystemError,
 		msg + "Wrong genotype size for this population");
 	ConstInfoIterator ib = m_info.begin();
 	ConstInfoIterator ie = m_info.end();
 #  ifdef MUTANTALLELE
 	// there are trouble with comprison between const and non-const
 	// genotype iterator in mutant modules...
-	m_genotype.validate();
-	GenoIterator gb = const_cast<vectorm &>(m_genotype).begin();
-	GenoIterator ge = const_cast<vectorm &>(m_genotype).end();
+	genotype.validate();
+	GenoIterator gb = genotype.begin();
+	GenoIterator ge = genotype.end();
 #  else
-	ConstGenoIterator gb = m_genotype.begin();
-	ConstGenoIterator ge = m_genotype.end();
+	ConstGenoIterator gb = genotype.begin();
+	ConstGenoIterator ge = genotype.end();
 #  endif
 
 	if (genoSize() > 0) {
@@ -876,14 +957,21 @@ void Population::validate(const string & msg) const
 void Population::fitSubPopStru(const vectoru & newSubPopSizes,
                                const vectorstr & newSubPopNames)
 {
+	detachGenotype();
 	size_t newSize = accumulate(newSubPopSizes.begin(), newSubPopSizes.end(), size_t(0));
 
 	bool needsResize = m_popSize != newSize;
+	bool cleared = false;
 
 	if (needsResize) {
 		size_t is = infoSize();
 		size_t step = genoSize();
 		m_popSize = newSize;
+		// capacity of buffers, used to tell if new buffers are allocated
+		size_t infoCapacity = m_info.capacity();
+#ifndef MUTANTALLELE
+		size_t genoCapacity = m_genotype.capacity();
+#endif
 		try {
 			if (step != 0 && m_popSize > MaxIndexSize / step)
 				throw RuntimeError("Population size times number of loci exceed maximum index size.");
@@ -906,24 +994,25 @@ void Population::fitSubPopStru(const vectoru & newSubPopSizes,
 #endif
 				                ).str());
 		}
-		// reset individual pointers
-		InfoIterator infoPtr = m_info.begin();
-		GenoIterator ptr = m_genotype.begin();
-#ifdef LINEAGE
-		LineageIterator lineagePtr = m_lineage.begin();
-		for (size_t i = 0; i < m_popSize; ++i, ptr += step, infoPtr += is, lineagePtr += step) {
-			m_inds[i].setLineagePtr(lineagePtr);
-#else
-		for (size_t i = 0; i < m_popSize; ++i, ptr += step, infoPtr += is) {
-#endif
-			m_inds[i].setGenoPtr(ptr);
-			m_inds[i].setInfoPtr(infoPtr);
+		// reset individual positions
+		size_t idx = m_buffers.index();
+		for (size_t i = 0; i < m_popSize; ++i) {
+			m_inds[i].setSlot(idx, i);
 			m_inds[i].setGenoStruIdx(genoStruIdx());
 		}
 		setIndOrdered(true);
+		// new buffers have been touched (copied and initialized) by this
+		// thread so their pages are placed on the NUMA node of this thread.
+		bool allocated = m_info.capacity() != infoCapacity;
+#ifndef MUTANTALLELE
+		allocated = allocated || m_genotype.capacity() != genoCapacity;
+#endif
+		if (allocated && firstTouch() && numThreads() > 1)
+			cleared = placeBuffers(newSubPopSizes);
 	}
 	// help clear confusing
-	std::fill(m_info.begin(), m_info.end(), 0.);
+	if (!cleared)
+		std::fill(m_info.begin(), m_info.end(), 0.);
 
 	if (newSubPopNames.empty() || newSubPopNames.size() == newSubPopSizes.size())
 		setSubPopStru(newSubPopSizes, newSubPopNames);
@@ -937,6 +1026,7 @@ void Population::fitSubPopStru(const vectoru & newSubPopSizes,
 
 void Population::fitGenoStru(size_t stru)
 {
+	detachGenotype();
 	// set genotypic structure to a population.
 	// This function will try not to change population size.
 	size_t oldSize = genoSize();
@@ -957,18 +1047,10 @@ void Population::fitGenoStru(size_t stru)
 		if (oldInfoSize != newInfoSize)
 			m_info.resize(newInfoSize * popSize());
 		// reset structure
-		InfoIterator infoPtr = m_info.begin();
-		GenoIterator ptr = m_genotype.begin();
-#ifdef LINEAGE
-		LineageIterator lineagePtr = m_lineage.begin();
-		for (size_t i = 0; i < m_popSize; ++i, ptr += newSize, infoPtr += newInfoSize, lineagePtr += newSize) {
-			m_inds[i].setLineagePtr(lineagePtr);
-#else
-		for (size_t i = 0; i < m_popSize; ++i, ptr += newSize, infoPtr += newInfoSize) {
-#endif
+		size_t idx = m_buffers.index();
+		for (size_t i = 0; i < m_popSize; ++i) {
 			m_inds[i].setGenoStruIdx(stru);
-			m_inds[i].setGenoPtr(ptr);
-			m_inds[i].setInfoPtr(infoPtr);
+			m_inds[i].setSlot(idx, i);
 		}
 	}
 }
@@ -1133,6 +1215,7 @@ void Population::sortIndividuals(const stringList & infoList, bool reverse)
 
 void Population::setSubPopByIndInfo(const string & field)
 {
+	detachGenotype();
 	DBG_FAILIF(hasActivatedVirtualSubPop(), ValueError,
 		"This operation is not allowed when there is an activated virtual subpopulation");
 
@@ -1168,25 +1251,19 @@ void Population::setSubPopByIndInfo(const string & field)
 #else
 		vectora newGenotype(genoSize() * newPopSize);
 #endif
-		LINEAGE_EXPR(vectori newLineage(genoSize() * newPopSize));
 		vectorf newInfo(newPopSize * infoSize());
 		vector<Individual> newInds(newPopSize);
-
-		// assign genotype location and set structure information for individuals
-		InfoIterator infoPtr = newInfo.begin();
-		size_t step = genoSize();
-		size_t infoStep = infoSize();
-		GenoIterator ptr = newGenotype.begin();
 #ifdef LINEAGE
-		LineageIterator lineagePtr = newLineage.begin();
-		for (size_t i = 0; i < newPopSize; ++i, ptr += step, ++it, lineagePtr += step, infoPtr += infoStep) {
-			newInds[i].setLineagePtr(lineagePtr);
+		vectori newLineage(genoSize() * newPopSize);
+		IndBuffers newBuffers(&newGenotype, &newInfo, &newLineage);
 #else
-		for (size_t i = 0; i < newPopSize; ++i, ptr += step, ++it, infoPtr += infoStep) {
+		IndBuffers newBuffers(&newGenotype, &newInfo);
 #endif
+
+		// assign genotype location and set structure information for individuals
+		for (size_t i = 0; i < newPopSize; ++i, ++it) {
 			newInds[i].setGenoStruIdx(genoStruIdx());
-			newInds[i].setGenoPtr(ptr);
-			newInds[i].setInfoPtr(infoPtr);
+			newInds[i].setSlot(newBuffers.index(), i);
 			newInds[i].copyFrom(*it);                         // copy everything, with info value
 		}
 		// now, switch!
@@ -1194,15 +1271,9 @@ void Population::setSubPopByIndInfo(const string & field)
 		m_info.swap(newInfo);
 		m_inds.swap(newInds);
 		LINEAGE_EXPR(m_lineage.swap(newLineage));
+		m_buffers.swap(newBuffers);
 		m_popSize = newPopSize;
 		setIndOrdered(true);
-#ifdef MUTANTALLELE
-		// vectorm must be setGenoPtr after swap
-		ptr = m_genotype.begin();
-		for (size_t i = 0; i < m_popSize; ++i, ptr += genoSize())
-			m_inds[i].setGenoPtr(ptr);
-
-#endif
 	}
 
 	if (m_inds.empty()) {
@@ -1282,6 +1353,7 @@ vectoru Population::splitSubPop(size_t subPop, const vectorf & sizes, const vect
 
 void Population::removeSubPops(const subPopList & subPops)
 {
+	detachGenotype();
 	syncIndPointers();
 	vectoru new_size;
 	vectorstr new_spNames;
@@ -1407,104 +1479,97 @@ void Population::removeSubPops(const subPopList & subPops)
 	m_popSize = std::accumulate(new_size.begin(), new_size.end(), size_t(0));
 	setSubPopStru(new_size, new_spNames);
 	//
-	InfoIterator infoPtr = m_info.begin();
-	GenoIterator ptr = m_genotype.begin();
-#ifdef LINEAGE
-	LineageIterator lineagePtr = m_lineage.begin();
-	for (size_t i = 0; i < m_popSize; ++i, ptr += step, infoPtr += infoStep, lineagePtr += step) {
-		m_inds[i].setLineagePtr(lineagePtr);
-#else
-	for (size_t i = 0; i < m_popSize; ++i, ptr += step, infoPtr += infoStep) {
+	size_t idx = m_buffers.index();
+	for (size_t i = 0; i < m_popSize; ++i)
+		m_inds[i].setSlot(idx, i);
+}
+
+
+void Population::moveIndividuals(size_t from, size_t to, size_t n)
+{
+	const size_t step = genoSize();
+	const size_t infoStep = infoSize();
+
+	copy(m_inds.begin() + from, m_inds.begin() + from + n, m_inds.begin() + to);
+#ifndef MUTANTALLELE
+	copy(m_genotype.begin() + from * step, m_genotype.begin() + (from + n) * step,
+		m_genotype.begin() + to * step);
 #endif
-		m_inds[i].setGenoPtr(ptr);
-		m_inds[i].setInfoPtr(infoPtr);
-	}
+	copy(m_info.begin() + from * infoStep, m_info.begin() + (from + n) * infoStep,
+		m_info.begin() + to * infoStep);
+	LINEAGE_EXPR(copy(m_lineage.begin() + from * step, m_lineage.begin() + (from + n) * step,
+			m_lineage.begin() + to * step));
 }
 
 
 void Population::removeMarkedIndividuals()
 {
+	detachGenotype();
 	syncIndPointers();
+
 	vectoru new_size(numSubPop(), 0);
+	for (size_t sp = 0; sp < numSubPop(); ++sp) {
+		const ssize_t spEnd = static_cast<ssize_t>(subPopEnd(sp));
+		size_t cnt = 0;
+#pragma omp parallel for reduction(+ : cnt) if(numThreads() > 1)
+		for (ssize_t i = static_cast<ssize_t>(subPopBegin(sp)); i < spEnd; ++i)
+			if (!m_inds[i].marked())
+				++cnt;
+		new_size[sp] = cnt;
+	}
 
-	size_t step = genoSize();
-	size_t infoStep = infoSize();
-	RawIndIterator oldInd = m_inds.begin();
-	RawIndIterator newInd = m_inds.begin();
-	InfoIterator oldInfoPtr = m_info.begin();
-	InfoIterator newInfoPtr = m_info.begin();
-	GenoIterator oldPtr = m_genotype.begin();
+	const size_t step = genoSize();
 #ifdef MUTANTALLELE
 	vectorm new_genotype;
-#else
-	GenoIterator newPtr = m_genotype.begin();
-#endif
-
-#ifdef LINEAGE
-	LineageIterator oldLineagePtr = m_lineage.begin();
-	LineageIterator newLineagePtr = m_lineage.begin();
-#endif
-	//
-	for (size_t sp = 0; sp < numSubPop(); ++sp) {
-		size_t newSize = 0;
-		size_t spSize = subPopSize(sp);
-		for (size_t i = 0; i < spSize; ++i) {
-			// will be kept
-			if (!oldInd->marked()) {
-				++newSize;
-#ifdef MUTANTALLELE
-				if (oldInd != newInd) {
-					*newInd = *oldInd;
-					copy(oldInfoPtr, oldInfoPtr + infoStep, newInfoPtr);
-					LINEAGE_EXPR(copy(oldLineagePtr, oldLineagePtr + step, newLineagePtr));
-				}
-				new_genotype.insert(new_genotype.end(), oldPtr, oldPtr + step);
-#else
-				if (oldInd != newInd) {
-					*newInd = *oldInd;
-					copy(oldPtr, oldPtr + step, newPtr);
-					copy(oldInfoPtr, oldInfoPtr + infoStep, newInfoPtr);
-					LINEAGE_EXPR(copy(oldLineagePtr, oldLineagePtr + step, newLineagePtr));
-				}
+	for (size_t i = 0; i < m_popSize; ++i)
+		if (!m_inds[i].marked())
+			new_genotype.insert(new_genotype.end(), m_genotype.begin() + i * step,
+				m_genotype.begin() + (i + 1) * step);
 #endif
-				++newInd;
-#ifndef MUTANTALLELE
-				newPtr += step;
+	// individuals that are kept are moved to the beginning of blocks of
+	// individuals in parallel, and the blocks are then moved down in order.
+	// Because individuals are only moved downward, the population is
+	// compacted in place.
+	const ssize_t numBlocks = numThreads();
+	vectoru blockSize(numBlocks, 0);
+	// genotypes of the binary module cannot be written in parallel
+#ifndef BINARYALLELE
+#  pragma omp parallel for if(numThreads() > 1)
 #endif
-				newInfoPtr += infoStep;
-				LINEAGE_EXPR(newLineagePtr += step);
-			}
-			++oldInd;
-			oldPtr += step;
-			oldInfoPtr += infoStep;
-			LINEAGE_EXPR(oldLineagePtr += step);
+	for (ssize_t b = 0; b < numBlocks; ++b) {
+		size_t begin = m_popSize * b / numBlocks;
+		size_t k = begin;
+		for (size_t i = begin, iEnd = m_popSize * (b + 1) / numBlocks; i < iEnd; ++i) {
+			if (m_inds[i].marked())
+				continue;
+			if (i != k)
+				moveIndividuals(i, k, 1);
+			++k;
 		}
-		new_size[sp] = newSize;
+		blockSize[b] = k - begin;
+	}
+	size_t size = blockSize[0];
+	for (ssize_t b = 1; b < numBlocks; ++b) {
+		size_t begin = m_popSize * b / numBlocks;
+		if (begin != size)
+			moveIndividuals(begin, size, blockSize[b]);
+		size += blockSize[b];
 	}
 	//
-	m_inds.erase(newInd, m_inds.end());
+	m_inds.erase(m_inds.begin() + size, m_inds.end());
 #ifdef MUTANTALLELE
 	m_genotype.swap(new_genotype);
 #else
-	m_genotype.erase(newPtr, m_genotype.end());
+	m_genotype.erase(m_genotype.begin() + size * step, m_genotype.end());
 #endif
-	m_info.erase(newInfoPtr, m_info.end());
-	LINEAGE_EXPR(m_lineage.erase(newLineagePtr, m_lineage.end()));
-	m_popSize = std::accumulate(new_size.begin(), new_size.end(), size_t(0));
+	m_info.erase(m_info.begin() + size * infoSize(), m_info.end());
+	LINEAGE_EXPR(m_lineage.erase(m_lineage.begin() + size * step, m_lineage.end()));
+	const size_t idx = m_buffers.index();
+#pragma omp parallel for if(numThreads() > 1)
+	for (ssize_t i = 0; i < static_cast<ssize_t>(size); ++i)
+		m_inds[i].setSlot(idx, i);
+	m_popSize = size;
 	setSubPopStru(new_size, m_subPopNames);
-	//
-	InfoIterator infoPtr = m_info.begin();
-	GenoIterator ptr = m_genotype.begin();
-	for (size_t i = 0; i < m_popSize; ++i, ptr += step, infoPtr += infoStep) {
-		m_inds[i].setGenoPtr(ptr);
-		m_inds[i].setInfoPtr(infoPtr);
-	}
-#ifdef LINEAGE
-	LineageIterator lineagePtr = m_lineage.begin();
-	for (size_t i = 0; i < m_popSize; ++i, lineagePtr += step) {
-		m_inds[i].setLineagePtr(lineagePtr);
-	}
-#endif
 }
 
 
@@ -1594,6 +1659,7 @@ void Population::removeIndividuals(const uintList & indexList, const floatList &
 
 size_t Population::mergeSubPops(const uintList & subPops, const string & name, int toSubPop)
 {
+	detachGenotype();
 	if (!name.empty() && m_subPopNames.empty())
 		m_subPopNames.resize(numSubPop(), UnnamedSubPop);
 
@@ -1718,28 +1784,23 @@ size_t Population::mergeSubPops(const uintList & subPops, const string & name, i
 	LINEAGE_EXPR(m_lineage.swap(new_lineage));
 	setSubPopStru(new_size, new_names);
 	//
-	InfoIterator infoPtr = m_info.begin();
-	GenoIterator ptr = m_genotype.begin();
-	for (size_t i = 0; i < m_popSize; ++i, ptr += step, infoPtr += infoStep) {
-		m_inds[i].setGenoPtr(ptr);
-		m_inds[i].setInfoPtr(infoPtr);
-	}
-#ifdef LINEAGE
-	LineageIterator lineagePtr = m_lineage.begin();
-	for (size_t i = 0; i < m_popSize; ++i, lineagePtr += step) {
-		m_inds[i].setLineagePtr(lineagePtr);
-	}
-#endif
+	size_t idx = m_buffers.index();
+	for (size_t i = 0; i < m_popSize; ++i)
+		m_inds[i].setSlot(idx, i);
 	return merged_idx;
 }
 
 
 void Population::addChromFrom(const Population & pop)
 {
+	detachGenotype();
+	pop.detachGenotype();
 	size_t numLoci1 = totNumLoci();
 	size_t numLoci2 = pop.totNumLoci();
+	size_t oldGenoSize = genoSize();
 
-	// obtain new genotype structure and set it
+	// obtain new genotype structure and set it. Because the old structure
+	// might be replaced, existing genotypes are located with the old size.
 	setGenoStructure(gsAddChromFromStru(pop.genoStruIdx()));
 	//
 	DBG_FAILIF(ancestralGens() != pop.ancestralGens(), ValueError,
@@ -1765,16 +1826,14 @@ void Population::addChromFrom(const Population & pop)
 
 		size_t pEnd = ploidy();
 		for (size_t i = 0; i < m_popSize; ++i) {
-			// set new geno structure
-			m_inds[i].setGenoStruIdx(genoStruIdx());
-			GenoIterator ptr1 = m_inds[i].genoPtr();
+			GenoIterator ptr1 = m_genotype.begin() + m_inds[i].genoSlot() * oldGenoSize;
 			ConstGenoIterator ptr2 = pop.m_inds[i].genoPtr();
-			m_inds[i].setGenoPtr(ptr);
 #ifdef LINEAGE
-			LineageIterator linPtr1 = m_inds[i].lineagePtr();
+			LineageIterator linPtr1 = m_lineage.begin() + m_inds[i].genoSlot() * oldGenoSize;
 			LineageIterator linPtr2 = pop.m_inds[i].lineagePtr();
-			m_inds[i].setLineagePtr(lineagePtr);
 #endif
+			m_inds[i].setGenoStruIdx(genoStruIdx());
+			m_inds[i].setGenoSlot(i);
 			for (size_t p = 0; p < pEnd; ++p) {
 				for (size_t j = 0; j < numLoci1; ++j) {
 #ifdef MUTANTALLELE
@@ -1801,12 +1860,6 @@ void Population::addChromFrom(const Population & pop)
 		}
 		m_genotype.swap(newGenotype);
 		LINEAGE_EXPR(m_lineage.swap(newLineage));
-#ifdef MUTANTALLELE
-		// vectorm must be setGenoPtr after swap
-		ptr = m_genotype.begin();
-		for (size_t i = 0; i < m_popSize; ++i, ptr += genoSize())
-			m_inds[i].setGenoPtr(ptr);
-#endif
 	}
 	if (!indOrdered())
 		// sort information only
@@ -1816,6 +1869,8 @@ void Population::addChromFrom(const Population & pop)
 
 void Population::addIndFrom(const Population & pop)
 {
+	detachGenotype();
+	pop.detachGenotype();
 	DBG_FAILIF(genoStruIdx() != pop.genoStruIdx(), ValueError,
 		"Cannot add Individual from a population with different genotypic structure.");
 	DBG_FAILIF(ancestralGens() != pop.ancestralGens(), ValueError,
@@ -1836,23 +1891,12 @@ void Population::addIndFrom(const Population & pop)
 		m_genotype.insert(m_genotype.end(), pop.m_genotype.begin(), pop.m_genotype.end());
 		m_info.insert(m_info.end(), pop.m_info.begin(), pop.m_info.end());
 		LINEAGE_EXPR(m_lineage.insert(m_lineage.end(), pop.m_lineage.begin(), pop.m_lineage.end()));
-		// iterators ready
-		InfoIterator infoPtr = m_info.begin();
-		size_t step = genoSize();
-		size_t infoStep = infoSize();
-		GenoIterator ptr = m_genotype.begin();
-		// set pointers
-		for (size_t i = 0; i < m_popSize; ++i, ptr += step, infoPtr += infoStep) {
+		// set positions
+		size_t idx = m_buffers.index();
+		for (size_t i = 0; i < m_popSize; ++i) {
 			m_inds[i].setGenoStruIdx(genoStruIdx());
-			m_inds[i].setGenoPtr(ptr);
-			m_inds[i].setInfoPtr(infoPtr);
+			m_inds[i].setSlot(idx, i);
 		}
-#ifdef LINEAGE
-		LineageIterator lineagePtr = m_lineage.begin();
-		for (size_t i = 0; i < m_popSize; ++i, lineagePtr += step) {
-			m_inds[i].setLineagePtr(lineagePtr);
-		}
-#endif
 		// rebuild index
 		m_subPopIndex.resize(numSubPop() + 1);
 		size_t j = 1;
@@ -1877,12 +1921,16 @@ void Population::addIndFrom(const Population & pop)
 
 void Population::addLociFrom(const Population & pop, bool byName)
 {
+	detachGenotype();
+	pop.detachGenotype();
 	DBG_FAILIF(ancestralGens() != pop.ancestralGens(), ValueError,
 		"Can not add chromosomes from a population with different number of ancestral generations");
 
 	size_t size1 = totNumLoci();
 	size_t size2 = pop.totNumLoci();
-	// obtain new genotype structure and set it
+	size_t oldGenoSize = genoSize();
+	// obtain new genotype structure and set it. Because the old structure
+	// might be replaced, existing genotypes are located with the old size.
 	vectoru indexes1;
 	vectoru indexes2;
 	if (byName)
@@ -1913,17 +1961,15 @@ void Population::addLociFrom(const Population & pop, bool byName)
 		size_t pEnd = ploidy();
 		size_t newSize = totNumLoci();
 		for (size_t i = 0; i < m_popSize; ++i) {
-			// set new geno structure
-			m_inds[i].setGenoStruIdx(genoStruIdx());
-			GenoIterator ptr1 = m_inds[i].genoPtr();
+			GenoIterator ptr1 = m_genotype.begin() + m_inds[i].genoSlot() * oldGenoSize;
 			ConstGenoIterator ptr2 = pop.m_inds[i].genoPtr();
-			// new genotype
-			m_inds[i].setGenoPtr(ptr);
 #ifdef LINEAGE
-			LineageIterator lineagePtr1 = m_inds[i].lineagePtr();
+			LineageIterator lineagePtr1 = m_lineage.begin() + m_inds[i].genoSlot() * oldGenoSize;
 			ConstLineageIterator lineagePtr2 = pop.m_inds[i].lineagePtr();
-			m_inds[i].setLineagePtr(lineagePtr);
 #endif
+			m_inds[i].setGenoStruIdx(genoStruIdx());
+			// new genotype
+			m_inds[i].setGenoSlot(i);
 			// copy each allele
 			for (size_t p = 0; p < pEnd; ++p) {
 				for (size_t i = 0; i < size1; ++i, ++ptr1) {
@@ -1940,12 +1986,6 @@ void Population::addLociFrom(const Population & pop, bool byName)
 		}
 		m_genotype.swap(newGenotype);
 		LINEAGE_EXPR(m_lineage.swap(newLineage));
-#ifdef MUTANTALLELE
-		// vectorm must be setGenoPtr after swap
-		ptr = m_genotype.begin();
-		for (size_t i = 0; i < m_popSize; ++i, ptr += genoSize())
-			m_inds[i].setGenoPtr(ptr);
-#endif
 	}
 
 	// sort information only
@@ -1970,52 +2010,14 @@ void Population::addChrom(const floatList & lociPosList, const stringList & loci
 	DBG_ASSERT(totNumLoci() - oldNumLoci == lociPos.size(), SystemError,
 		"Failed to add chromosome.");
 
+	// the new chromosome is appended after existing loci
+	vectoru loci(oldNumLoci);
+	for (size_t i = 0; i < oldNumLoci; ++i)
+		loci[i] = i;
+
 	for (int depth = ancestralGens(); depth >= 0; --depth) {
 		useAncestralGen(depth);
-		size_t newPopGenoSize = genoSize() * m_popSize;
-#ifdef MUTANTALLELE
-		vectorm newGenotype(newPopGenoSize);
-#else
-		vectora newGenotype(newPopGenoSize, 0);
-#endif
-
-		// copy data over
-		GenoIterator newPtr = newGenotype.begin();
-#ifdef LINEAGE
-		vectori newLineage(newPopGenoSize, 0);
-		LineageIterator newLineagePtr = newLineage.begin();
-#endif
-
-		size_t pEnd = ploidy();
-		size_t gap = totNumLoci() - oldNumLoci;
-		for (size_t i = 0; i < m_popSize; ++i) {
-			// set new geno structure
-			m_inds[i].setGenoStruIdx(genoStruIdx());
-
-			GenoIterator oldPtr = m_inds[i].genoPtr();
-			// new genotype
-			m_inds[i].setGenoPtr(newPtr);
-			LINEAGE_EXPR(LineageIterator oldLineagePtr = m_inds[i].lineagePtr());
-			LINEAGE_EXPR(m_inds[i].setLineagePtr(newLineagePtr));
-			// copy each chromosome
-			for (size_t p = 0; p < pEnd; ++p) {
-				for (size_t i = 0; i < oldNumLoci; ++i, ++newPtr, ++oldPtr) {
-					REF_ASSIGN_ALLELE(newPtr, DEREF_ALLELE(oldPtr));
-					LINEAGE_EXPR(*(newLineagePtr++) = *(oldLineagePtr++));
-				}
-				newPtr += gap;
-				LINEAGE_EXPR(newLineagePtr += gap);
-			}
-		}
-		m_genotype.swap(newGenotype);
-		LINEAGE_EXPR(m_lineage.swap(newLineage));
-#ifdef MUTANTALLELE
-		// vectorm must be setGenoPtr after swap
-		GenoIterator ptr = m_genotype.begin();
-		for (size_t i = 0; i < m_popSize; ++i, ptr += genoSize())
-			m_inds[i].setGenoPtr(ptr);
-#endif
-
+		expandGenotype(loci);
 	}
 	// if indOrdered is false:
 	//   individual genotype is now sorted. If we do not do
@@ -2042,10 +2044,12 @@ vectoru Population::addLoci(const uintList & chromList, const floatList & posLis
 	vectoru loci(totNumLoci());
 	// obtain new genotype structure and set it
 	setGenoStructure(gsAddLoci(chrom, pos, lociNames, alleleNames, newIndex));
-	DBG_DO(DBG_POPULATION, cerr << "Indexes of inserted loci " << newIndex << endl);
 	// loci at newIndex should have zero alleles...
+	vector<bool> isNew(totNumLoci(), false);
+	for (size_t i = 0; i < newIndex.size(); ++i)
+		isNew[newIndex[i]] = true;
 	for (size_t i = 0, j = 0; j < totNumLoci(); ++j) {
-		if (find(newIndex.begin(), newIndex.end(), j) == newIndex.end())
+		if (!isNew[j])
 			loci[i++] = j;
 	}
 	DBG_DO(DBG_POPULATION, cerr << "Indexes of inserted loci " << newIndex
@@ -2053,47 +2057,7 @@ vectoru Population::addLoci(const uintList & chromList, const floatList & posLis
 
 	for (int depth = ancestralGens(); depth >= 0; --depth) {
 		useAncestralGen(depth);
-		//
-		size_t newPopGenoSize = genoSize() * m_popSize;
-#ifdef MUTANTALLELE
-		vectorm newGenotype(newPopGenoSize);
-#else
-		vectora newGenotype(newPopGenoSize, 0);
-#endif
-		// copy data over
-		GenoIterator newPtr = newGenotype.begin();
-#ifdef LINEAGE
-		vectori newLineage(newPopGenoSize, 0);
-		LineageIterator newLineagePtr = newLineage.begin();
-#endif
-		size_t pEnd = ploidy();
-		for (size_t i = 0; i < m_popSize; ++i) {
-			// set new geno structure
-			m_inds[i].setGenoStruIdx(genoStruIdx());
-			GenoIterator oldPtr = m_inds[i].genoPtr();
-			// new genotype
-			m_inds[i].setGenoPtr(newPtr);
-			LINEAGE_EXPR(LineageIterator oldLineagePtr = m_inds[i].lineagePtr());
-			LINEAGE_EXPR(m_inds[i].setLineagePtr(newLineagePtr));
-			// copy each chromosome
-			for (size_t p = 0; p < pEnd; ++p) {
-				vectoru::iterator loc = loci.begin();
-				for (; loc != loci.end(); ++loc, ++oldPtr) {
-					REF_ASSIGN_ALLELE(newPtr + *loc, DEREF_ALLELE(oldPtr));
-					LINEAGE_EXPR(newLineagePtr[*loc] = *(oldLineagePtr++));
-				}
-				newPtr += totNumLoci();
-				LINEAGE_EXPR(newLineagePtr += totNumLoci());
-			}
-		}
-		m_genotype.swap(newGenotype);
-		LINEAGE_EXPR(m_lineage.swap(newLineage));
-#ifdef MUTANTALLELE
-		// vectorm must be setGenoPtr after swap
-		GenoIterator ptr = m_genotype.begin();
-		for (size_t i = 0; i < m_popSize; ++i, ptr += genoSize())
-			m_inds[i].setGenoPtr(ptr);
-#endif
+		expandGenotype(loci);
 	}
 	// if indOrdered is false:
 	//   individual genotype is now sorted. If we do not do
@@ -2104,43 +2068,233 @@ vectoru Population::addLoci(const uintList & chromList, const floatList & posLis
 }
 
 
-void Population::resize(const uintList & sizeList, bool propagate)
+bool Population::placeBuffers(const vectoru & subPopSizes)
 {
-	const vectoru & newSubPopSizes = sizeList.elems();
-
-	DBG_FAILIF(newSubPopSizes.size() != numSubPop(), ValueError,
-		"Resize should give subpopulation size for each subpopulation");
-
-	size_t newPopSize = accumulate(newSubPopSizes.begin(), newSubPopSizes.end(), size_t(0));
-
-	// prepare new Population
-	vector<Individual> newInds(newPopSize);
-	vectorf newInfo(newPopSize * infoSize());
-	// iterators ready
-	InfoIterator infoPtr = newInfo.begin();
+	detachGenotype();
+#ifdef _OPENMP
+#  if !defined(BINARYALLELE) && !defined(MUTANTALLELE)
 	size_t step = genoSize();
-	size_t infoStep = infoSize();
-#ifdef MUTANTALLELE
-	vectorm newGenotype(genoSize() * newPopSize);
-#else
-	vectora newGenotype(genoSize() * newPopSize);
-#endif
-	GenoIterator ptr = newGenotype.begin();
-	for (size_t i = 0; i < newPopSize; ++i, ptr += step, infoPtr += infoStep) {
-		newInds[i].setGenoStruIdx(genoStruIdx());
-		newInds[i].setGenoPtr(ptr);
-		// set pointers
-		newInds[i].setInfoPtr(infoPtr);
-	}
-#ifdef LINEAGE
-	vectori newLineage(genoSize() * newPopSize);
-	LineageIterator lineagePtr = newLineage.begin();
-	for (size_t i = 0; i < newPopSize; ++i, lineagePtr += step) {
-		newInds[i].setLineagePtr(lineagePtr);
+#  endif
+	size_t is = infoSize();
+
+#  if !defined(BINARYALLELE) && !defined(MUTANTALLELE)
+	if (!m_genotype.empty() && !releasePages(&m_genotype[0], m_genotype.size() * sizeof(Allele)))
+		return false;
+#  endif
+#  ifdef LINEAGE
+	if (!m_lineage.empty() && !releasePages(&m_lineage[0], m_lineage.size() * sizeof(long)))
+		return false;
+#  endif
+	if (!m_info.empty() && !releasePages(&m_info[0], m_info.size() * sizeof(double)))
+		return false;
+
+	// HomoMating::mateSubPop assigns consecutive blocks of offspring in each
+	// subpopulation to threads statically, so each thread clears the part of
+	// each subpopulation that it will write offspring into.
+#  pragma omp parallel
+	{
+		size_t nThreads = omp_get_num_threads();
+		size_t id = omp_get_thread_num();
+		size_t spBegin = 0;
+		for (size_t sp = 0; sp < subPopSizes.size(); ++sp) {
+			size_t begin = spBegin + subPopSizes[sp] * id / nThreads;
+			size_t end = spBegin + subPopSizes[sp] * (id + 1) / nThreads;
+#  if !defined(BINARYALLELE) && !defined(MUTANTALLELE)
+			std::fill(m_genotype.begin() + begin * step, m_genotype.begin() + end * step, Allele(0));
+#  endif
+			LINEAGE_EXPR(std::fill(m_lineage.begin() + begin * step, m_lineage.begin() + end * step, 0L));
+			std::fill(m_info.begin() + begin * is, m_info.begin() + end * is, 0.);
+			spBegin += subPopSizes[sp];
+		}
 	}
+	return true;
+#else
+	(void)subPopSizes;
+	return false;
 #endif
-	// copy stuff over
-	size_t startSP = 0;
+}
+
+
+void Population::expandGenotype(const vectoru & loci)
+{
+	detachGenotype();
+	size_t oldNumLoci = loci.size();
+	size_t newNumLoci = totNumLoci();
+	size_t pEnd = ploidy();
+	size_t oldGenoSize = oldNumLoci * pEnd;
+	size_t newGenoSize = genoSize();
+
+#ifndef MUTANTALLELE
+	// If genotypes are stored in the order of individuals, which is the
+	// case unless individuals have been sorted, expand the genotype buffer
+	// and move genotypes of each individual backward, block by block. This
+	// avoids the allocation of another genotype buffer, and copies each
+	// block of existing loci only once.
+	bool inPlace = true;
+	for (size_t i = 0; i < m_popSize && inPlace; ++i)
+		inPlace = m_inds[i].genoSlot() == i;
+	if (inPlace) {
+		// blocks of consecutive existing loci, in the form of
+		// (old position, new position, length)
+		vectoru blockFrom;
+		vectoru blockTo;
+		vectoru blockSize;
+		for (size_t i = 0; i < oldNumLoci; ++i) {
+			if (i > 0 && loci[i] == loci[i - 1] + 1)
+				++blockSize.back();
+			else {
+				blockFrom.push_back(i);
+				blockTo.push_back(loci[i]);
+				blockSize.push_back(1);
+			}
+		}
+		// new loci
+		vectoru added;
+		for (size_t i = 0, j = 0; j < newNumLoci; ++j) {
+			if (i < oldNumLoci && loci[i] == j)
+				++i;
+			else
+				added.push_back(j);
+		}
+
+		size_t newSize = newGenoSize * m_popSize;
+		// grow geometrically so that repeated addition of loci does not
+		// reallocate the genotype buffer each time
+		if (m_genotype.capacity() < newSize)
+			m_genotype.reserve(std::max(newSize, m_genotype.capacity() + m_genotype.capacity() / 2));
+		m_genotype.resize(newSize);
+		GenoIterator geno = m_genotype.begin();
+#  ifdef LINEAGE
+		if (m_lineage.capacity() < newSize)
+			m_lineage.reserve(std::max(newSize, m_lineage.capacity() + m_lineage.capacity() / 2));
+		m_lineage.resize(newSize);
+		LineageIterator lineage = m_lineage.begin();
+#  endif
+		// because new positions are never before old positions, genotypes
+		// can be moved from the last to the first block without overwriting
+		// genotypes that are not yet moved.
+		for (size_t i = m_popSize; i > 0; --i) {
+			for (size_t p = pEnd; p > 0; --p) {
+				size_t oldBegin = (i - 1) * oldGenoSize + (p - 1) * oldNumLoci;
+				size_t newBegin = (i - 1) * newGenoSize + (p - 1) * newNumLoci;
+				for (size_t b = blockFrom.size(); b > 0; --b) {
+					size_t from = oldBegin + blockFrom[b - 1];
+					size_t to = newBegin + blockTo[b - 1];
+					if (from == to)
+						continue;
+					std::copy_backward(geno + from, geno + from + blockSize[b - 1],
+						geno + to + blockSize[b - 1]);
+					LINEAGE_EXPR(std::copy_backward(lineage + from, lineage + from + blockSize[b - 1],
+							lineage + to + blockSize[b - 1]));
+				}
+				for (size_t j = 0; j < added.size(); ++j) {
+					*(geno + newBegin + added[j]) = 0;
+					LINEAGE_EXPR(*(lineage + newBegin + added[j]) = 0);
+				}
+			}
+		}
+		for (size_t i = 0; i < m_popSize; ++i) {
+			m_inds[i].setGenoStruIdx(genoStruIdx());
+			m_inds[i].setGenoSlot(i);
+		}
+		return;
+	}
+#endif
+
+	size_t newPopGenoSize = newGenoSize * m_popSize;
+#ifdef MUTANTALLELE
+	vectorm newGenotype(newPopGenoSize);
+#else
+	vectora newGenotype(newPopGenoSize, 0);
+#endif
+	// copy data over
+	GenoIterator newPtr = newGenotype.begin();
+#ifdef LINEAGE
+	vectori newLineage(newPopGenoSize, 0);
+	LineageIterator newLineagePtr = newLineage.begin();
+#endif
+	for (size_t i = 0; i < m_popSize; ++i) {
+		// existing genotypes are located with the old size because the old
+		// structure might have been replaced
+		GenoIterator oldPtr = m_genotype.begin() + m_inds[i].genoSlot() * oldGenoSize;
+		LINEAGE_EXPR(LineageIterator oldLineagePtr = m_lineage.begin() + m_inds[i].genoSlot() * oldGenoSize);
+		m_inds[i].setGenoStruIdx(genoStruIdx());
+		// new genotype
+		m_inds[i].setGenoSlot(i);
+		// copy each chromosome
+		for (size_t p = 0; p < pEnd; ++p) {
+			vectoru::const_iterator loc = loci.begin();
+			for (; loc != loci.end(); ++loc, ++oldPtr) {
+				REF_ASSIGN_ALLELE(newPtr + *loc, DEREF_ALLELE(oldPtr));
+				LINEAGE_EXPR(newLineagePtr[*loc] = *(oldLineagePtr++));
+			}
+			newPtr += newNumLoci;
+			LINEAGE_EXPR(newLineagePtr += newNumLoci);
+		}
+	}
+	m_genotype.swap(newGenotype);
+	LINEAGE_EXPR(m_lineage.swap(newLineage));
+}
+
+
+#ifndef MUTANTALLELE
+// release the spare capacity of buffer v
+template<class T>
+static void shrinkBuffer(T & v)
+{
+	if (v.capacity() > v.size())
+		T(v).swap(v);
+}
+
+
+#endif
+
+void Population::shrinkGenotype() const
+{
+#ifndef MUTANTALLELE
+	Population * pop = const_cast<Population *>(this);
+	shrinkBuffer(pop->m_genotype);
+	LINEAGE_EXPR(shrinkBuffer(pop->m_lineage));
+	std::deque<popData>::iterator it = pop->m_ancestralPops.begin();
+	std::deque<popData>::iterator it_end = pop->m_ancestralPops.end();
+	for (; it != it_end; ++it) {
+		shrinkBuffer(it->m_genotype);
+		LINEAGE_EXPR(shrinkBuffer(it->m_lineage));
+	}
+#endif
+}
+
+
+void Population::resize(const uintList & sizeList, bool propagate)
+{
+	detachGenotype();
+	const vectoru & newSubPopSizes = sizeList.elems();
+
+	DBG_FAILIF(newSubPopSizes.size() != numSubPop(), ValueError,
+		"Resize should give subpopulation size for each subpopulation");
+
+	size_t newPopSize = accumulate(newSubPopSizes.begin(), newSubPopSizes.end(), size_t(0));
+
+	// prepare new Population
+	vector<Individual> newInds(newPopSize);
+	vectorf newInfo(newPopSize * infoSize());
+#ifdef MUTANTALLELE
+	vectorm newGenotype(genoSize() * newPopSize);
+#else
+	vectora newGenotype(genoSize() * newPopSize);
+#endif
+#ifdef LINEAGE
+	vectori newLineage(genoSize() * newPopSize);
+	IndBuffers newBuffers(&newGenotype, &newInfo, &newLineage);
+#else
+	IndBuffers newBuffers(&newGenotype, &newInfo);
+#endif
+	for (size_t i = 0; i < newPopSize; ++i) {
+		newInds[i].setGenoStruIdx(genoStruIdx());
+		newInds[i].setSlot(newBuffers.index(), i);
+	}
+	// copy stuff over
+	size_t startSP = 0;
 	for (size_t sp = 0; sp < numSubPop(); ++sp) {
 		size_t spSize = subPopSize(sp);
 		for (size_t i = 0, j = 0; i < newSubPopSizes[sp]; ++j, ++i) {
@@ -2157,16 +2311,11 @@ void Population::resize(const uintList & sizeList, bool propagate)
 	m_info.swap(newInfo);
 	m_inds.swap(newInds);
 	LINEAGE_EXPR(m_lineage.swap(newLineage));
+	m_buffers.swap(newBuffers);
 	m_popSize = newPopSize;
 	setIndOrdered(true);
 	m_subPopSize = newSubPopSizes;
 
-#ifdef MUTANTALLELE
-	// vectorm must be setGenoPtr after swap
-	ptr = m_genotype.begin();
-	for (size_t i = 0; i < m_popSize; ++i, ptr += genoSize())
-		m_inds[i].setGenoPtr(ptr);
-#endif
 	// rebuild index
 	size_t idx = 1;
 	for (m_subPopIndex[0] = 0; idx <= numSubPop(); ++idx)
@@ -2176,6 +2325,7 @@ void Population::resize(const uintList & sizeList, bool propagate)
 
 Population & Population::extractSubPops(const subPopList & subPops, bool rearrange) const
 {
+	detachGenotype();
 #ifndef OPTIMIZED
 	subPopList::const_iterator it = subPops.begin();
 	subPopList::const_iterator itEnd = subPops.end();
@@ -2354,24 +2504,16 @@ Population & Population::extractSubPops(const subPopList & subPops, bool rearran
 	pop.m_popSize = sz;
 	pop.setSubPopStru(new_size, new_spNames);
 	//
-	InfoIterator infoPtr = pop.m_info.begin();
-	GenoIterator ptr = pop.m_genotype.begin();
-	for (size_t i = 0; i < pop.m_popSize; ++i, ptr += step, infoPtr += infoStep) {
-		pop.m_inds[i].setGenoPtr(ptr);
-		pop.m_inds[i].setInfoPtr(infoPtr);
-	}
-#ifdef LINEAGE
-	LineageIterator lineagePtr = pop.m_lineage.begin();
-	for (size_t i = 0; i < pop.m_popSize; ++i, lineagePtr += step) {
-		pop.m_inds[i].setLineagePtr(lineagePtr);
-	}
-#endif
+	size_t idx = pop.m_buffers.index();
+	for (size_t i = 0; i < pop.m_popSize; ++i)
+		pop.m_inds[i].setSlot(idx, i);
 	return pop;
 }
 
 
 Population & Population::extractMarkedIndividuals() const
 {
+	detachGenotype();
 	Population & pop = *new Population();
 
 	pop.setGenoStruIdx(genoStruIdx());
@@ -2444,18 +2586,9 @@ Population & Population::extractMarkedIndividuals() const
 	pop.m_popSize = std::accumulate(new_size.begin(), new_size.end(), size_t(0));
 	pop.setSubPopStru(new_size, m_subPopNames);
 	//
-	InfoIterator infoPtr = pop.m_info.begin();
-	GenoIterator ptr = pop.m_genotype.begin();
-	for (size_t i = 0; i < pop.m_popSize; ++i, ptr += step, infoPtr += infoStep) {
-		pop.m_inds[i].setGenoPtr(ptr);
-		pop.m_inds[i].setInfoPtr(infoPtr);
-	}
-#ifdef LINEAGE
-	LineageIterator lineagePtr = pop.m_lineage.begin();
-	for (size_t i = 0; i < pop.m_popSize; ++i, lineagePtr += step) {
-		pop.m_inds[i].setLineagePtr(lineagePtr);
-	}
-#endif
+	size_t idx = pop.m_buffers.index();
+	for (size_t i = 0; i < pop.m_popSize; ++i)
+		pop.m_inds[i].setSlot(idx, i);
 	return pop;
 }
 
@@ -2560,9 +2693,72 @@ Population & Population::extractIndividuals(const uintList & indexList,
 }
 
 
+// runs of consecutive loci, as pairs of the first locus and the number of
+// loci, of sorted loci.
+typedef vector<std::pair<size_t, size_t> > LociRuns;
+
+static LociRuns lociRuns(const vectoru & loci)
+{
+	LociRuns runs;
+
+	for (size_t i = 0; i < loci.size(); ++i) {
+		if (!runs.empty() && runs.back().first + runs.back().second == loci[i])
+			++runs.back().second;
+		else
+			runs.push_back(std::make_pair(loci[i], static_cast<size_t>(1)));
+	}
+	return runs;
+}
+
+
+// copy alleles at loci runs from ploidy homologous copies of numLoci alleles
+// starting at from, to consecutive alleles starting at to.
+static void copyLociRuns(GenoIterator from, GenoIterator to, size_t ploidy,
+                         size_t numLoci, const LociRuns & runs)
+{
+	for (size_t p = 0; p < ploidy; ++p, from += numLoci) {
+		LociRuns::const_iterator it = runs.begin();
+		LociRuns::const_iterator itEnd = runs.end();
+		for (; it != itEnd; ++it) {
+#ifdef BINARYALLELE
+			copyGenotype(from + it->first, to, it->second);
+#else
+#  ifdef MUTANTALLELE
+			copyGenotype(from + it->first, from + it->first + it->second, to);
+#  else
+			if (it->second == 1)
+				*to = *(from + it->first);
+			else
+				copy(from + it->first, from + it->first + it->second, to);
+#  endif
+#endif
+			to += it->second;
+		}
+	}
+}
+
+
+#ifdef LINEAGE
+static void copyLociRuns(LineageIterator from, LineageIterator to, size_t ploidy,
+                         size_t numLoci, const LociRuns & runs)
+{
+	for (size_t p = 0; p < ploidy; ++p, from += numLoci) {
+		LociRuns::const_iterator it = runs.begin();
+		LociRuns::const_iterator itEnd = runs.end();
+		for (; it != itEnd; ++it) {
+			copy(from + it->first, from + it->first + it->second, to);
+			to += it->second;
+		}
+	}
+}
+
+
+#endif
+
 Population & Population::extract(const lociList & extractedLoci, const stringList & infoFieldList,
                                  const subPopList & _subPops, const uintList & ancGens) const
 {
+	detachGenotype();
 	Population & pop = *new Population();
 
 	// the usual whole population, easy case.
@@ -2638,19 +2834,14 @@ Population & Population::extract(const lociList & extractedLoci, const stringLis
 	}
 	size_t step = pop.genoSize();
 	size_t infoStep = pop.infoSize();
-	// will be used to copy from *this
-	size_t pStep = totNumLoci();
-	size_t pEnd = ploidy() * totNumLoci();
-	vectoru::iterator lociPtr = new_loci.begin();
-	vectoru::iterator lociEnd = new_loci.end();
+	// extracted loci are copied run by run from each homologous copy
+	LociRuns runs = lociRuns(new_loci);
 	//
 	vectoru infoList;
 	vectorstr::const_iterator iit = keptInfoFields.begin();
 	vectorstr::const_iterator iit_end = keptInfoFields.end();
 	for (; iit != iit_end; ++iit)
 		infoList.push_back(infoIdx(*iit));
-	vectoru::iterator infoPtr = infoList.begin();
-	vectoru::iterator infoEnd = infoList.end();
 	//
 	vectoru gens = ancGens.elems();
 	if (ancGens.allAvail())
@@ -2668,7 +2859,7 @@ Population & Population::extract(const lociList & extractedLoci, const stringLis
 		syncIndPointers();
 		// determine the number of individuals
 		vectoru spSizes(numSubPop());
-		vector<vectoru> indIdx(numSubPop());
+		vectoru indIdx;
 		size_t size;
 		if (!removeInd) {
 			spSizes = subPopSizes();
@@ -2686,105 +2877,79 @@ Population & Population::extract(const lociList & extractedLoci, const stringLis
 					if (!m_inds[i + subPopBegin(sp)].marked())
 						continue;
 					++spSizes[sp];
-					indIdx[sp].push_back(spBegin + i);
+					indIdx.push_back(spBegin + i);
 				}
 			}
-			size = accumulate(spSizes.begin(), spSizes.end(), size_t(0));
+			size = indIdx.size();
 			DBG_DO(DBG_POPULATION, cerr << "New subpopulation size " << spSizes << endl);
 		}
 
 		vector<Individual> new_inds;
 #ifdef MUTANTALLELE
-		size_t newIdx = 0;
 		vectorm new_genotype;
-		// this function uses push_back to insert mutants, which does not
-		// change the size of vectorm... a resize is needed.
-		if (removeLoci)
-			new_genotype.resize(size * step);
 #else
 		vectora new_genotype;
-		new_genotype.reserve(size * step);
 #endif
 #ifdef LINEAGE
 		vectori new_lineage;
-		new_lineage.reserve(size * step);
 #endif
 		vectorf new_info;
 
 		new_inds.reserve(size);
-		new_info.reserve(size * infoStep);
 		// copy genotype and info...
-		if (!removeInd) {
+		if (!removeInd)
 			new_inds.insert(new_inds.end(), m_inds.begin(), m_inds.end());
-			// handle genotype
-			if (!removeLoci) {
-				new_genotype.insert(new_genotype.end(), m_genotype.begin(), m_genotype.end());
-				LINEAGE_EXPR(new_lineage.insert(new_lineage.end(), m_lineage.begin(), m_lineage.end()));
-			} else {
-				ConstRawIndIterator it = rawIndBegin();
-				ConstRawIndIterator it_end = rawIndEnd();
-				for (; it != it_end; ++it) {
-					GenoIterator ptr = it->genoBegin();
-					LINEAGE_EXPR(LineageIterator lineagePtr = it->lineageBegin());
-					for (size_t p = 0; p < pEnd; p += pStep) {
-						for (lociPtr = new_loci.begin(); lociPtr != lociEnd; ++lociPtr) {
-#ifdef MUTANTALLELE
-							new_genotype.push_back(newIdx++, (ptr + *lociPtr + p).value());
-#else
-							new_genotype.push_back(*(ptr + *lociPtr + p));
+		else {
+			for (size_t i = 0; i < size; ++i)
+				new_inds.push_back(m_inds[indIdx[i]]);
+		}
+		// genotypes of whole individuals are copied in blocks
+		if (!removeLoci && !removeInd) {
+			new_genotype.insert(new_genotype.end(), m_genotype.begin(), m_genotype.end());
+			LINEAGE_EXPR(new_lineage.insert(new_lineage.end(), m_lineage.begin(), m_lineage.end()));
+		} else if (!removeLoci) {
+#ifndef MUTANTALLELE
+			new_genotype.reserve(size * step);
 #endif
-							LINEAGE_EXPR(new_lineage.push_back(*(lineagePtr + *lociPtr + p)));
-						}
-					}
-				}
-			}
-			// handle information fields
-			if (!removeInfo)
-				new_info.insert(new_info.end(), m_info.begin(), m_info.end());
-			else {
-				ConstRawIndIterator it = rawIndBegin();
-				ConstRawIndIterator it_end = rawIndEnd();
-				for (; it != it_end; ++it) {
-					InfoIterator iPtr = it->infoBegin();
-					for (infoPtr = infoList.begin(); infoPtr != infoEnd; ++infoPtr)
-						new_info.push_back(*(iPtr + *infoPtr));
-				}
+			LINEAGE_EXPR(new_lineage.reserve(size * step));
+			for (size_t i = 0; i < size; ++i) {
+				new_genotype.insert(new_genotype.end(), indGenoBegin(indIdx[i]), indGenoEnd(indIdx[i]));
+				LINEAGE_EXPR(new_lineage.insert(new_lineage.end(),
+						indLineageBegin(indIdx[i]), indLineageEnd(indIdx[i])));
 			}
 		} else {
-			// remove individual
-			for (size_t sp = 0; sp < indIdx.size(); ++sp) {
-				vectoru & idx = indIdx[sp];
-				if (idx.empty())
-					continue;
-				vectoru::iterator it = idx.begin();
-				vectoru::iterator it_end = idx.end();
-				for (; it != it_end; ++it) {
-					new_inds.push_back(m_inds[*it]);
-					if (!removeLoci) {
-						new_genotype.insert(new_genotype.end(), indGenoBegin(*it), indGenoEnd(*it));
-						LINEAGE_EXPR(new_lineage.insert(new_lineage.end(),
-								indLineageBegin(*it), indLineageEnd(*it)));
-					} else {
-						GenoIterator ptr = indGenoBegin(*it);
-						LINEAGE_EXPR(LineageIterator lineagePtr = indLineageBegin(*it));
-						for (size_t p = 0; p < pEnd; p += pStep) {
-							for (lociPtr = new_loci.begin(); lociPtr != lociEnd; ++lociPtr)
-#ifdef MUTANTALLELE
-								new_genotype.push_back(newIdx++, (ptr + *lociPtr + p).value());
-#else
-								new_genotype.push_back(*(ptr + *lociPtr + p));
+			new_genotype.resize(size * step);
+			LINEAGE_EXPR(new_lineage.resize(size * step));
+		}
+		if (!removeInfo && !removeInd)
+			new_info.insert(new_info.end(), m_info.begin(), m_info.end());
+		else if (!removeInfo) {
+			new_info.reserve(size * infoStep);
+			for (size_t i = 0; i < size; ++i)
+				new_info.insert(new_info.end(), m_inds[indIdx[i]].infoBegin(),
+					m_inds[indIdx[i]].infoEnd());
+		} else
+			new_info.resize(size * infoStep);
+		// extracted loci and information fields are gathered for each
+		// individual in a single pass.
+		if (removeLoci || removeInfo) {
+			size_t ply = ploidy();
+			size_t numLoci = totNumLoci();
+			// genotypes of the binary and mutant modules cannot be written in parallel
+#if !defined(BINARYALLELE) && !defined(MUTANTALLELE)
+#  pragma omp parallel for if(numThreads() > 1)
 #endif
-							LINEAGE_EXPR(new_lineage.push_back(*(lineagePtr + *lociPtr + p)));
-						}
-					}
-					if (!removeInfo)
-						new_info.insert(new_info.end(), m_inds[*it].infoBegin(),
-							m_inds[*it].infoEnd());
-					else {
-						InfoIterator iPtr = m_inds[*it].infoBegin();
-						for (infoPtr = infoList.begin(); infoPtr != infoEnd; ++infoPtr)
-							new_info.push_back(*(iPtr + *infoPtr));
-					}
+			for (ssize_t i = 0; i < static_cast<ssize_t>(size); ++i) {
+				const Individual & ind = m_inds[removeInd ? indIdx[i] : i];
+				if (removeLoci) {
+					copyLociRuns(ind.genoBegin(), new_genotype.begin() + i * step, ply, numLoci, runs);
+					LINEAGE_EXPR(copyLociRuns(ind.lineageBegin(), new_lineage.begin() + i * step, ply, numLoci, runs));
+				}
+				if (removeInfo) {
+					InfoIterator iPtr = ind.infoBegin();
+					vectorf::iterator newInfoPtr = new_info.begin() + i * infoStep;
+					for (size_t j = 0; j < infoList.size(); ++j)
+						newInfoPtr[j] = iPtr[infoList[j]];
 				}
 			}
 		}
@@ -2793,24 +2958,8 @@ Population & Population::extract(const lociList & extractedLoci, const stringLis
 			pop.setSubPopStru(spSizes, vectorstr());
 		else
 			pop.setSubPopStru(spSizes, m_subPopNames);
-		// set pointer
-		vectorf::iterator infoPtr = new_info.begin();
-#ifdef MUTANTALLELE
-		vectorm::iterator ptr = new_genotype.begin();
-#else
-		vectora::iterator ptr = new_genotype.begin();
-#endif
-		for (size_t i = 0; i < size; ++i, ptr += step, infoPtr += infoStep) {
+		for (size_t i = 0; i < size; ++i)
 			new_inds[i].setGenoStruIdx(pop.genoStruIdx());
-			new_inds[i].setGenoPtr(ptr);
-			new_inds[i].setInfoPtr(infoPtr);
-		}
-#ifdef LINEAGE
-		vectori::iterator lineagePtr = new_lineage.begin();
-		for (size_t i = 0; i < size; ++i, lineagePtr += step) {
-			new_inds[i].setLineagePtr(lineagePtr);
-		}
-#endif
 		// the arrays are ready, are they?
 		DBG_ASSERT(new_inds.size() == size && (new_genotype.size() == size * step)
 			&& (new_info.size() == size * infoStep), SystemError,
@@ -2823,12 +2972,9 @@ Population & Population::extract(const lociList & extractedLoci, const stringLis
 			pop.m_genotype.swap(new_genotype);
 			pop.m_info.swap(new_info);
 			LINEAGE_EXPR(pop.m_lineage.swap(new_lineage));
-#ifdef MUTANTALLELE
-			// vectorm must be setGenoPtr after swap
-			GenoIterator ptr = pop.m_genotype.begin();
-			for (size_t i = 0; i < pop.m_inds.size(); ++i, ptr += step)
-				pop.m_inds[i].setGenoPtr(ptr);
-#endif
+			size_t idx = pop.m_buffers.index();
+			for (size_t i = 0; i < size; ++i)
+				pop.m_inds[i].setSlot(idx, i);
 		} else {
 			pop.m_ancestralPops.push_front(popData());
 			popData & pd = pop.m_ancestralPops.front();
@@ -2837,12 +2983,9 @@ Population & Population::extract(const lociList & extractedLoci, const stringLis
 			pd.m_info.swap(new_info);
 			LINEAGE_EXPR(pd.m_lineage.swap(new_lineage));
 			pd.m_inds.swap(new_inds);
-#ifdef MUTANTALLELE
-			// vectorm must be setGenoPtr after swap
-			GenoIterator ptr = pd.m_genotype.begin();
-			for (size_t i = 0; i < pd.m_inds.size(); ++i, ptr += step)
-				pd.m_inds[i].setGenoPtr(ptr);
-#endif
+			size_t idx = pd.m_buffers.index();
+			for (size_t i = 0; i < size; ++i)
+				pd.m_inds[i].setSlot(idx, i);
 		}
 	}
 	pop.m_curAncestralGen = 0;
@@ -2859,6 +3002,7 @@ Population & Population::extract(const lociList & extractedLoci, const stringLis
 
 void Population::removeLoci(const lociList & removeList, const lociList & keepList)
 {
+	detachGenotype();
 	if (removeList.unspecified() && keepList.unspecified())
 		return;
 
@@ -2878,67 +3022,164 @@ void Population::removeLoci(const lociList & removeList, const lociList & keepLi
 		if (removeList.allAvail())
 			kept.clear();
 		else {
-			vectoru loci = removeList.elems(this);
+			const vectoru & loci = removeList.elems(this);
+			vector<bool> removed(totNumLoci(), false);
+			for (size_t i = 0; i < loci.size(); ++i)
+				if (loci[i] < removed.size())
+					removed[loci[i]] = true;
 			for (size_t loc = 0; loc < totNumLoci(); ++loc) {
-				if (find(loci.begin(), loci.end(), loc) == loci.end())
+				if (!removed[loc])
 					kept.push_back(loc);
 			}
 		}
 	}
 	size_t oldTotNumLoci = totNumLoci();
+	// existing genotypes are located with the old size because the old
+	// structure might be replaced by the new one
+	size_t oldGenoSize = genoSize();
+	// kept loci are copied run by run from each homologous copy
+	LociRuns runs = lociRuns(kept);
 
 	setGenoStructure(gsRemoveLoci(kept));
 
 	for (int depth = ancestralGens(); depth >= 0; --depth) {
 		useAncestralGen(depth);
 		//
+		size_t step = genoSize();
 #ifdef MUTANTALLELE
-		vectorm newGenotype(genoSize() * m_popSize);
+		vectorm newGenotype(step * m_popSize);
 #else
-		vectora newGenotype(genoSize() * m_popSize);
+		vectora newGenotype(step * m_popSize);
 #endif
-		// copy data over
-		GenoIterator newPtr = newGenotype.begin();
 #ifdef LINEAGE
-		vectori newLineage(genoSize() * m_popSize);
-		LineageIterator newLineagePtr = newLineage.begin();
+		vectori newLineage(step * m_popSize);
 #endif
-		size_t pEnd = ploidy();
-		for (size_t i = 0; i < m_popSize; ++i) {
-			// set new geno structure
+		size_t ply = ploidy();
+		// genotypes of the binary and mutant modules cannot be written in parallel
+#if !defined(BINARYALLELE) && !defined(MUTANTALLELE)
+#  pragma omp parallel for if(numThreads() > 1)
+#endif
+		for (ssize_t i = 0; i < static_cast<ssize_t>(m_popSize); ++i) {
+			size_t oldBegin = m_inds[i].genoSlot() * oldGenoSize;
+			copyLociRuns(m_genotype.begin() + oldBegin, newGenotype.begin() + i * step, ply, oldTotNumLoci, runs);
+			LINEAGE_EXPR(copyLociRuns(m_lineage.begin() + oldBegin, newLineage.begin() + i * step, ply, oldTotNumLoci, runs));
 			m_inds[i].setGenoStruIdx(genoStruIdx());
-			GenoIterator oldPtr = m_inds[i].genoPtr();
-			LINEAGE_EXPR(LineageIterator oldLineagePtr = m_inds[i].lineagePtr());
-			// new genotype
-			m_inds[i].setGenoPtr(newPtr);
-			LINEAGE_EXPR(m_inds[i].setLineagePtr(newLineagePtr));
-			for (size_t p = 0; p < pEnd; ++p) {
-				vectoru::iterator loc = kept.begin();
-				for (; loc != kept.end(); ++loc, ++newPtr) {
-					// this line needs ordered kept array
-					REF_ASSIGN_ALLELE(newPtr, DEREF_ALLELE(oldPtr + *loc)); //assignGenotype
-					LINEAGE_EXPR(*(newLineagePtr++) = oldLineagePtr[*loc]); //assignLineage
-				}
-				oldPtr += oldTotNumLoci;
-				LINEAGE_EXPR(oldLineagePtr += oldTotNumLoci);
-			}
+			m_inds[i].setGenoSlot(i);
 		}
 		m_genotype.swap(newGenotype);
 		LINEAGE_EXPR(m_lineage.swap(newLineage));
-#ifdef MUTANTALLELE
-		// vectorm must be setGenoPtr after swap
-		GenoIterator ptr = m_genotype.begin();
-		for (size_t i = 0; i < m_popSize; ++i, ptr += genoSize())
-			m_inds[i].setGenoPtr(ptr);
-#endif
 	}
 	setIndOrdered(true);
 }
 
 
+// largest allele at loci[first:last] of genotypes in [begin, end), which
+// consists of blocks of numLoci alleles.
+static size_t maxAlleleAtLoci(GenoIterator begin, GenoIterator end, size_t numLoci,
+                              const vectoru & loci, size_t first, size_t last)
+{
+	ssize_t blocks = (end - begin) / numLoci;
+	vectoru maxAllele(numThreads(), 0);
+
+#pragma omp parallel for if(numThreads() > 1)
+	for (ssize_t b = 0; b < blocks; ++b) {
+		GenoIterator ptr = begin + b * numLoci;
+		size_t m = 0;
+		for (size_t i = first; i < last; ++i)
+			m = std::max(m, static_cast<size_t>(DEREF_ALLELE(ptr + loci[i])));
+#ifdef _OPENMP
+		size_t & threadMax = maxAllele[omp_get_thread_num()];
+#else
+		size_t & threadMax = maxAllele[0];
+#endif
+		threadMax = std::max(threadMax, m);
+	}
+	return *max_element(maxAllele.begin(), maxAllele.end());
+}
+
+
+// mark existing alleles at loci[first:last] of genotypes in [begin, end) in
+// seen, which has a table of tableSize alleles for each locus if perLocus is
+// true, and a single table otherwise.
+static void markAllelesAtLoci(GenoIterator begin, GenoIterator end, size_t numLoci,
+                              const vectoru & loci, size_t first, size_t last,
+                              vector<char> & seen, size_t tableSize, bool perLocus)
+{
+	ssize_t blocks = (end - begin) / numLoci;
+	vector<vector<char> > threadSeen(numThreads());
+
+#pragma omp parallel if(numThreads() > 1)
+	{
+#ifdef _OPENMP
+		vector<char> & mySeen = threadSeen[omp_get_thread_num()];
+#else
+		vector<char> & mySeen = threadSeen[0];
+#endif
+		mySeen.resize(seen.size(), 0);
+#pragma omp for
+		for (ssize_t b = 0; b < blocks; ++b) {
+			GenoIterator ptr = begin + b * numLoci;
+			for (size_t i = first; i < last; ++i)
+				mySeen[(perLocus ? (i - first) * tableSize : 0) + static_cast<size_t>(DEREF_ALLELE(ptr + loci[i]))] = 1;
+		}
+	}
+	for (size_t t = 0; t < threadSeen.size(); ++t)
+		for (size_t j = 0; j < threadSeen[t].size(); ++j)
+			seen[j] |= threadSeen[t][j];
+}
+
+
+// recode alleles at loci[first:last] of genotypes in [begin, end) using
+// table, which has tableSize alleles for each locus if perLocus is true,
+// and a single table otherwise. allLoci indicates that loci[first:last]
+// are all loci. Alleles outside of the table are not recoded. Return the
+// number of such alleles.
+static size_t recodeAllelesAtLoci(GenoIterator begin, GenoIterator end, size_t numLoci,
+                                  const vectoru & loci, size_t first, size_t last, bool allLoci,
+                                  const vector<Allele> & table, size_t tableSize, bool perLocus)
+{
+	size_t unrecoded = 0;
+
+	// recode all alleles with a single table
+	if (allLoci && !perLocus) {
+		ssize_t size = end - begin;
+		// genotypes of the binary and mutant modules cannot be written in parallel
+#if !defined(BINARYALLELE) && !defined(MUTANTALLELE)
+#  pragma omp parallel for reduction(+ : unrecoded) if(numThreads() > 1)
+#endif
+		for (ssize_t j = 0; j < size; ++j) {
+			size_t a = static_cast<size_t>(DEREF_ALLELE(begin + j));
+			if (a >= tableSize)
+				++unrecoded;
+			else
+				REF_ASSIGN_ALLELE(begin + j, table[a]);
+		}
+		return unrecoded;
+	}
+
+	ssize_t blocks = (end - begin) / numLoci;
+#if !defined(BINARYALLELE) && !defined(MUTANTALLELE)
+#  pragma omp parallel for reduction(+ : unrecoded) if(numThreads() > 1)
+#endif
+	for (ssize_t b = 0; b < blocks; ++b) {
+		GenoIterator ptr = begin + b * numLoci;
+		for (size_t i = first; i < last; ++i) {
+			size_t a = static_cast<size_t>(DEREF_ALLELE(ptr + loci[i]));
+			if (a >= tableSize) {
+				++unrecoded;
+				continue;
+			}
+			REF_ASSIGN_ALLELE(ptr + loci[i], table[(perLocus ? (i - first) * tableSize : 0) + a]);
+		}
+	}
+	return unrecoded;
+}
+
+
 void Population::recodeAlleles(const uintListFunc & newAlleles, const lociList & loci_,
                                const stringMatrix & alleleNamesMatrix)
 {
+	detachGenotype();
 	DBG_FAILIF(newAlleles.empty() && !newAlleles.func().isValid(), ValueError,
 		"Please specify new alleles or a conversion function");
 
@@ -2965,126 +3206,121 @@ void Population::recodeAlleles(const uintListFunc & newAlleles, const lociList &
 		}
 	}
 
-	//
-	// unordered map does not appear to work here, perhaps std::pair<Allele, size_t>
-	// is not hashable.
-	//
-	typedef std::map<Allele, Allele> AlleleMap;
-	typedef std::map<std::pair<Allele, size_t>, Allele> AlleleLocusMap;
-
-	AlleleMap alleleMap;
-	AlleleLocusMap alleleLocusMap;
+	size_t numLoci = totNumLoci();
+	if (numLoci == 0)
+		return;
+	vectoru recodedLoci;
+	if (loci_.allAvail()) {
+		for (size_t i = 0; i < numLoci; ++i)
+			recodedLoci.push_back(i);
+	} else {
+		for (size_t i = 0; i < loci.size(); ++i) {
+			DBG_FAILIF(loci[i] >= numLoci, IndexError, "Loci index out of range");
+		}
+		recodedLoci = loci;
+	}
 
+	// Alleles are recoded through lookup tables indexed by existing alleles,
+	// with a single table for all loci unless the new alleles depend on locus.
 	size_t oldGen = curAncestralGen();
+	if (!newAlleles.empty()) {
+		const vectoru & map = newAlleles.elems();
+		vector<Allele> table(map.size());
+		for (size_t a = 0; a < map.size(); ++a)
+			table[a] = TO_ALLELE(map[a]);
+		size_t unrecoded = 0;
+		for (int depth = ancestralGens(); depth >= 0; --depth) {
+			useAncestralGen(depth);
+			unrecoded += recodeAllelesAtLoci(m_genotype.begin(), m_genotype.end(), numLoci,
+				recodedLoci, 0, recodedLoci.size(), loci_.allAvail(), table, map.size(), false);
+		}
+		useAncestralGen(oldGen);
+		DBG_WARNIF(loci_.allAvail() && unrecoded > 0,
+			(boost::format("%1% alleles can not be recoded") % unrecoded).str());
+		DBG_FAILIF(!loci_.allAvail() && unrecoded > 0, ValueError,
+			(boost::format("%1% alleles can not be recoded") % unrecoded).str());
+		return;
+	}
+
+	pyFunc func = newAlleles.func();
+	size_t alleleIndex = InvalidValue;
+	size_t locusIndex = InvalidValue;
+	for (size_t i = 0; i < func.numArgs(); ++i) {
+		const string & arg = func.arg(i);
+		if (arg == "allele")
+			alleleIndex = i;
+		else if (arg == "locus")
+			locusIndex = i;
+		else {
+			DBG_FAILIF(true, ValueError,
+				"Only parameters 'allele' and 'locus' are acceptable in a user-provided recode function.");
+		}
+	}
+	bool perLocus = locusIndex != InvalidValue;
+
+	size_t maxAllele = 0;
 	for (int depth = ancestralGens(); depth >= 0; --depth) {
 		useAncestralGen(depth);
-
-		GenoIterator ptr = m_genotype.begin();
-		GenoIterator ptrEnd = m_genotype.end();
-
-		if (!newAlleles.empty()) {
-			const vectoru & map = newAlleles.elems();
-			if (loci_.allAvail()) {
-				for (; ptr != ptrEnd; ++ptr) {
-					size_t a = static_cast<size_t>(DEREF_ALLELE(ptr));
-					if (a >= map.size()) {
-						DBG_WARNIF(true, (boost::format("Allele %1% can not be recoded") % a).str());
-						continue;
-					}
-					REF_ASSIGN_ALLELE(ptr, TO_ALLELE(map[DEREF_ALLELE(ptr)]));
-				}
-			} else {
-				size_t numLoci = totNumLoci();
-				size_t iEnd = loci.size();
-				for (; ptr != ptrEnd; ptr += numLoci) {
-					for (size_t i = 0; i < iEnd; ++i) {
-						DBG_FAILIF(loci[i] >= numLoci, IndexError, "Loci index out of range");
-						GenoIterator allele = ptr + loci[i];
-						DBG_FAILIF(static_cast<size_t>(DEREF_ALLELE(allele)) >= map.size(),
-							ValueError, (boost::format("Allele %1% can not be recoded") %
-							             static_cast<size_t>(DEREF_ALLELE(allele))).str());
-						REF_ASSIGN_ALLELE(allele, TO_ALLELE(map[DEREF_ALLELE(allele)]));
-					}
-				}
-			}
-		} else {
-			pyFunc func = newAlleles.func();
-			PyObject * args = PyTuple_New(func.numArgs());
-			size_t alleleIndex = InvalidValue;
-			size_t locusIndex = InvalidValue;
-			for (size_t i = 0; i < func.numArgs(); ++i) {
-				const string & arg = func.arg(i);
-				if (arg == "allele")
-					alleleIndex = i;
-				else if (arg == "locus")
-					locusIndex = i;
-				else {
-					DBG_FAILIF(true, ValueError,
-						"Only parameters 'allele' and 'locus' are acceptable in a user-provided recode function.");
-				}
-			}
-			size_t numLoci = totNumLoci();
-			size_t iEnd = loci.size();
+		maxAllele = std::max(maxAllele, maxAlleleAtLoci(m_genotype.begin(), m_genotype.end(),
+				numLoci, recodedLoci, 0, recodedLoci.size()));
+	}
+	size_t tableSize = maxAllele + 1;
+	size_t numTables = perLocus ? recodedLoci.size() : 1;
+	// Dense lookup tables, one for each locus if the new alleles depend on
+	// locus, are limited to about 16M entries in total.
+	size_t maxTableSize = 1 << 24;
+	if (tableSize > maxTableSize / numTables) {
+		// alleles are too large or loci are too many for dense lookup tables,
+		// use a cache of existing alleles (at each locus) instead.
+		std::map<std::pair<size_t, size_t>, Allele> alleleMap;
+		for (int depth = ancestralGens(); depth >= 0; --depth) {
+			useAncestralGen(depth);
+			GenoIterator ptr = m_genotype.begin();
+			GenoIterator ptrEnd = m_genotype.end();
 			for (; ptr != ptrEnd; ptr += numLoci) {
-				if (loci_.allAvail()) {
-					for (size_t i = 0; i < numLoci; ++i) {
-						if (alleleIndex != InvalidValue)
-							PyTuple_SET_ITEM(args, alleleIndex, PyInt_FromLong(static_cast<int>(DEREF_ALLELE(ptr + i))));
-						if (locusIndex != InvalidValue)
-							PyTuple_SET_ITEM(args, locusIndex, PyInt_FromLong(static_cast<int>(i)));
-						if (locusIndex != InvalidValue) {
-							std::pair<Allele, size_t> key(DEREF_ALLELE(ptr + i), i);
-							AlleleLocusMap::iterator it = alleleLocusMap.find(key);
-							if (it != alleleLocusMap.end())
-								REF_ASSIGN_ALLELE(ptr + i, it->second);
-							else {
-								Allele a = TO_ALLELE(func(PyObj_As_Int, args));
-								REF_ASSIGN_ALLELE(ptr + i, a);
-								alleleLocusMap[key] = a;
-							}
-						} else {
-							AlleleMap::iterator it = alleleMap.find(DEREF_ALLELE(ptr + i));
-							if (it != alleleMap.end())
-								REF_ASSIGN_ALLELE(ptr + i, it->second);
-							else {
-								Allele na = TO_ALLELE(func(PyObj_As_Int, args));
-								Allele oldAllele = DEREF_ALLELE(ptr + i);
-								REF_ASSIGN_ALLELE(ptr + i, na);
-								alleleMap[oldAllele] = na;
-							}
-						}
-					}
-				} else {
-					for (size_t i = 0; i < iEnd; ++i) {
-						DBG_FAILIF(loci[i] >= numLoci, IndexError, "Loci index out of range");
+				for (size_t i = 0; i < recodedLoci.size(); ++i) {
+					size_t a = static_cast<size_t>(DEREF_ALLELE(ptr + recodedLoci[i]));
+					std::pair<size_t, size_t> key(a, perLocus ? recodedLoci[i] : 0);
+					std::map<std::pair<size_t, size_t>, Allele>::iterator it = alleleMap.find(key);
+					if (it == alleleMap.end()) {
+						PyObject * args = PyTuple_New(func.numArgs());
 						if (alleleIndex != InvalidValue)
-							PyTuple_SET_ITEM(args, alleleIndex, PyInt_FromLong(static_cast<int>(DEREF_ALLELE(ptr + loci[i]))));
+							PyTuple_SET_ITEM(args, alleleIndex, PyInt_FromLong(static_cast<long>(a)));
 						if (locusIndex != InvalidValue)
-							PyTuple_SET_ITEM(args, locusIndex, PyInt_FromLong(static_cast<int>(loci[i])));
-						if (locusIndex != InvalidValue) {
-							std::pair<Allele, size_t> key(DEREF_ALLELE(ptr + loci[i]), loci[i]);
-							AlleleLocusMap::iterator it = alleleLocusMap.find(key);
-							if (it != alleleLocusMap.end())
-								REF_ASSIGN_ALLELE(ptr + loci[i], it->second);
-							else {
-								REF_ASSIGN_ALLELE(ptr + loci[i], TO_ALLELE(func(PyObj_As_Int, args)));
-								alleleLocusMap[key] = DEREF_ALLELE(ptr + loci[i]);
-							}
-						} else {
-							AlleleMap::iterator it = alleleMap.find(DEREF_ALLELE(ptr + loci[i]));
-							if (it != alleleMap.end())
-								REF_ASSIGN_ALLELE(ptr + loci[i], it->second);
-							else {
-								Allele oldAllele = DEREF_ALLELE(ptr + loci[i]);
-								REF_ASSIGN_ALLELE(ptr + loci[i], TO_ALLELE(func(PyObj_As_Int, args)));
-								alleleMap[oldAllele] = DEREF_ALLELE(ptr + loci[i]);
-							}
-						}
+							PyTuple_SET_ITEM(args, locusIndex, PyInt_FromLong(static_cast<long>(recodedLoci[i])));
+						it = alleleMap.insert(std::make_pair(key, TO_ALLELE(func(PyObj_As_Int, args)))).first;
+						Py_DECREF(args);
 					}
+					REF_ASSIGN_ALLELE(ptr + recodedLoci[i], it->second);
 				}
 			}
-			Py_DECREF(args);
 		}
+		useAncestralGen(oldGen);
+		return;
+	}
+	// call the function only once for each existing allele (at each locus)
+	vector<char> seen(numTables * tableSize, 0);
+	for (int depth = ancestralGens(); depth >= 0; --depth) {
+		useAncestralGen(depth);
+		markAllelesAtLoci(m_genotype.begin(), m_genotype.end(), numLoci,
+			recodedLoci, 0, recodedLoci.size(), seen, tableSize, perLocus);
+	}
+	vector<Allele> table(seen.size());
+	for (size_t j = 0; j < seen.size(); ++j) {
+		if (!seen[j])
+			continue;
+		PyObject * args = PyTuple_New(func.numArgs());
+		if (alleleIndex != InvalidValue)
+			PyTuple_SET_ITEM(args, alleleIndex, PyInt_FromLong(static_cast<long>(j % tableSize)));
+		if (locusIndex != InvalidValue)
+			PyTuple_SET_ITEM(args, locusIndex, PyInt_FromLong(static_cast<long>(recodedLoci[j / tableSize])));
+		table[j] = TO_ALLELE(func(PyObj_As_Int, args));
+		Py_DECREF(args);
+	}
+	for (int depth = ancestralGens(); depth >= 0; --depth) {
+		useAncestralGen(depth);
+		recodeAllelesAtLoci(m_genotype.begin(), m_genotype.end(), numLoci,
+			recodedLoci, 0, recodedLoci.size(), loci_.allAvail(), table, tableSize, perLocus);
 	}
 	useAncestralGen(oldGen);
 }
@@ -3116,6 +3352,18 @@ void Population::push(Population & rhs)
 		// swap with real data
 		// current population may *not* be in order
 		pd.swap(*this);
+		// ancestral generations do not grow so their spare capacity is released
+#ifndef MUTANTALLELE
+		shrinkBuffer(pd.m_genotype);
+		LINEAGE_EXPR(shrinkBuffer(pd.m_lineage));
+#endif
+	}
+
+	// discarded genotypes that are shared are not copied, but rhs is given
+	// a vector of its own to write to.
+	if (m_ancestralGens == 0 && m_buffers.sharesGenotype()) {
+		m_buffers.releaseGenotype();
+		m_genotype.resize(m_popSize * genoSize());
 	}
 
 	// then swap out data
@@ -3129,18 +3377,9 @@ void Population::push(Population & rhs)
 	LINEAGE_EXPR(m_lineage.swap(rhs.m_lineage));
 	m_info.swap(rhs.m_info);
 	m_inds.swap(rhs.m_inds);
+	m_buffers.swap(rhs.m_buffers);
 	std::swap(m_indOrdered, rhs.m_indOrdered);
 
-#ifdef MUTANTALLELE
-	// vectorm must be setGenoPtr after swap
-	GenoIterator ptr = m_genotype.begin();
-	for (size_t i = 0; i < m_inds.size(); ++i, ptr += genoSize())
-		m_inds[i].setGenoPtr(ptr);
-	ptr = rhs.m_genotype.begin();
-	for (size_t i = 0; i < rhs.m_inds.size(); ++i, ptr += genoSize())
-		rhs.m_inds[i].setGenoPtr(ptr);
-#endif
-
 	// current population should be working well
 	// (with all datamember copied form rhs
 	// rhs may not be working well since m_genotype etc
@@ -3163,6 +3402,18 @@ vectorf Population::indInfo(const uintString & field, vspID subPopID)
 	vspID subPop = subPopID.resolve(*this);
 	size_t idx = field.empty() ? field.value() : infoIdx(field.name());
 	vectorf ret;
+	if (indOrdered() && !subPop.isVirtual() && !hasActivatedVirtualSubPop()) {
+		// copy a column of the ordered information fields
+		const size_t is = infoSize();
+		const size_t begin = subPop.valid() ? subPopBegin(subPop.subPop()) : 0;
+		const ssize_t size = static_cast<ssize_t>(subPop.valid() ? subPopSize(subPop.subPop()) : popSize());
+		ret.resize(size);
+		vectorf::const_iterator info = m_info.begin() + begin * is + idx;
+#pragma omp parallel for if(numThreads() > 1)
+		for (ssize_t i = 0; i < size; ++i)
+			ret[i] = *(info + i * is);
+		return ret;
+	}
 	if (subPop.valid()) {
 		activateVirtualSubPop(subPop);
 		IndInfoIterator it = infoBegin(idx, subPop);
@@ -3224,11 +3475,15 @@ void Population::addInfoFields(const stringList & fieldList, double init)
 			vectorf newInfo(is * popSize(), 0.);
 			// copy the old stuff in
 			InfoIterator ptr = newInfo.begin();
-			for (IndIterator ind = indIterator(); ind.valid(); ++ind) {
-				copy(ind->infoBegin(), ind->infoBegin() + os, ptr);
-				ind->setInfoPtr(ptr);
+			size_t slot = 0;
+			for (IndIterator ind = indIterator(); ind.valid(); ++ind, ++slot) {
+				// the old structure might have been replaced so existing
+				// information fields are located with the old size
+				InfoIterator oldPtr = m_info.begin() + ind->infoSlot() * os;
+				copy(oldPtr, oldPtr + os, ptr);
+				ind->setInfoSlot(slot);
 				ind->setGenoStruIdx(genoStruIdx());
-				fill(ind->infoBegin() + os, ind->infoEnd(), init);
+				fill(ptr + os, ptr + is, init);
 				ptr += is;
 			}
 			m_info.swap(newInfo);
@@ -3249,9 +3504,9 @@ void Population::setInfoFields(const stringList & fieldList, double init)
 	for (size_t anc = 0; anc <= m_ancestralPops.size(); anc++) {
 		useAncestralGen(anc);
 		vectorf newInfo(is * popSize(), init);
-		InfoIterator ptr = newInfo.begin();
-		for (IndIterator ind = indIterator(); ind.valid(); ++ind, ptr += is) {
-			ind->setInfoPtr(ptr);
+		size_t slot = 0;
+		for (IndIterator ind = indIterator(); ind.valid(); ++ind, ++slot) {
+			ind->setInfoSlot(slot);
 			ind->setGenoStruIdx(genoStruIdx());
 		}
 		m_info.swap(newInfo);
@@ -3280,6 +3535,7 @@ void Population::removeInfoFields(const stringList & fieldList)
 		}
 	}
 
+	size_t os = infoSize();
 	setGenoStructure(gsSetInfoFields(newfields));
 
 	int oldAncPop = m_curAncestralGen;
@@ -3290,9 +3546,10 @@ void Population::removeInfoFields(const stringList & fieldList)
 		// copy the old stuff in
 		InfoIterator ptr = newInfo.begin();
 
-		for (IndIterator ind = indIterator(); ind.valid(); ++ind) {
-			InfoIterator oldptr = ind->infoPtr();
-			ind->setInfoPtr(ptr);
+		size_t slot = 0;
+		for (IndIterator ind = indIterator(); ind.valid(); ++ind, ++slot) {
+			InfoIterator oldptr = m_info.begin() + ind->infoSlot() * os;
+			ind->setInfoSlot(slot);
 			ind->setGenoStruIdx(genoStruIdx());
 			for (size_t i = 0; i < sz; ++i)
 				*(ptr++) = *(oldptr + oldIdx[i]);
@@ -3348,6 +3605,17 @@ void Population::setIndInfo(const floatList & valueList, const uintString &
 	CHECKRANGEINFO(idx);
 	const vectorf & values = valueList.elems();
 	size_t valueSize = values.size();
+	if (indOrdered() && !subPop.isVirtual() && !hasActivatedVirtualSubPop()) {
+		// fill a column of the ordered information fields
+		const size_t is = infoSize();
+		const size_t begin = subPop.valid() ? subPopBegin(subPop.subPop()) : 0;
+		const ssize_t size = static_cast<ssize_t>(subPop.valid() ? subPopSize(subPop.subPop()) : popSize());
+		vectorf::iterator info = m_info.begin() + begin * is + idx;
+#pragma omp parallel for if(numThreads() > 1)
+		for (ssize_t i = 0; i < size; ++i)
+			*(info + i * is) = values[i % valueSize];
+		return;
+	}
 	if (subPop.valid()) {
 		activateVirtualSubPop(subPop);
 		IndInfoIterator ptr = infoBegin(idx, subPop);
@@ -3398,6 +3666,7 @@ void Population::setAncestralDepth(int depth)
 
 void Population::keepAncestralGens(const uintList & ancGens)
 {
+	detachGenotype();
 	if (ancGens.allAvail())
 		return;
 
@@ -3427,15 +3696,8 @@ void Population::keepAncestralGens(const uintList & ancGens)
 				LINEAGE_EXPR(pd1.m_lineage.swap(pd.m_lineage));
 				pd1.m_info.swap(pd.m_info);
 				pd1.m_inds.swap(pd.m_inds);
+				pd1.m_buffers.swap(pd.m_buffers);
 				std::swap(pd1.m_indOrdered, pd.m_indOrdered);
-#ifdef MUTANTALLELE
-				GenoIterator ptr = pd1.m_genotype.begin();
-				for (size_t i = 0; i < pd1.m_inds.size(); ++i, ptr += pd1.m_genotype.size() / pd1.m_inds.size())
-					pd1.m_inds[i].setGenoPtr(ptr);
-				ptr = pd.m_genotype.begin();
-				for (size_t i = 0; i < pd.m_inds.size(); ++i, ptr += pd.m_genotype.size() / pd.m_inds.size())
-					pd.m_inds[i].setGenoPtr(ptr);
-#endif
 			}
 		}
 	}
@@ -3445,6 +3707,33 @@ void Population::keepAncestralGens(const uintList & ancGens)
 }
 
 
+void Population::recordGenealogy(const string & idField, UINT simplifyInterval)
+{
+	DBG_FAILIF(hasActivatedVirtualSubPop(), ValueError,
+		"This operation is not allowed when there is an activated virtual subpopulation");
+
+	Genealogy * genealogy = new Genealogy(idField, simplifyInterval);
+	try {
+		genealogy->addNodes(*this);
+	} catch (...) {
+		delete genealogy;
+		throw;
+	}
+	if (m_genealogy)
+		delete m_genealogy;
+	m_genealogy = genealogy;
+}
+
+
+Genealogy & Population::genealogy()
+{
+	if (m_genealogy == NULL)
+		throw ValueError("The genealogy of this population is not recorded. Please call "
+			"Population.recordGenealogy() to start recording.");
+	return *m_genealogy;
+}
+
+
 void Population::useAncestralGen(ssize_t idx)
 {
 	DBG_FAILIF(hasActivatedVirtualSubPop(), RuntimeError, "Can not switch ancestral generation with an activated virtual subpopulation");
@@ -3481,10 +3770,50 @@ void Population::useAncestralGen(ssize_t idx)
 }
 
 
+#ifdef LINEAGE
+/* Run-length encode \e lineage as pairs of lineage and number of alleles in
+ * \e runs. Return false, with incomplete \e runs, if the encoded lineage
+ * would not be shorter than \e lineage.
+ */
+bool encodeLineage(const vectori & lineage, vectori & runs)
+{
+	runs.clear();
+	size_t i = 0;
+	while (i < lineage.size()) {
+		if (runs.size() + 2 >= lineage.size())
+			return false;
+		size_t j = i + 1;
+		while (j < lineage.size() && lineage[j] == lineage[i])
+			++j;
+		runs.push_back(lineage[i]);
+		runs.push_back(static_cast<long>(j - i));
+		i = j;
+	}
+	return true;
+}
+
+
+/* Expand lineage encoded by encodeLineage to \e size alleles. */
+void decodeLineage(const vectori & runs, size_t size, vectori & lineage)
+{
+	lineage.clear();
+	lineage.reserve(size);
+	for (size_t i = 0; i + 1 < runs.size(); i += 2)
+		lineage.insert(lineage.end(), static_cast<size_t>(runs[i + 1]), runs[i]);
+	DBG_FAILIF(lineage.size() != size, ValueError,
+		"Run-length encoded lineage does not match genotype.");
+}
+
+
+#endif
+
 void Population::save(boost::archive::text_oarchive & ar, const unsigned int version) const
 {
+	detachGenotype();
 	// deep adjustment: everyone in order
 	const_cast<Population *>(this)->syncIndPointers();
+	// do not keep capacity reserved for added loci after the population is saved
+	shrinkGenotype();
 
 	DBG_DO(DBG_POPULATION, cerr << "Handling geno structure" << endl);
 	// GenoStructure genoStru = this->genoStru();
@@ -3575,17 +3904,16 @@ void Population::save(boost::archive::text_oarchive & ar, const unsigned int ver
 #ifdef LINEAGE
 	DBG_DO(DBG_POPULATION, cerr << "Handling lineage" << endl);
 	if (!m_lineage.empty()) {
-		int has_lineage = 1;
-		long single_lineage = m_lineage[0];
-		for (size_t i = 1; i < m_lineage.size(); ++i) {
-			if (m_lineage[i] != single_lineage) {
-				has_lineage = 2;
-				break;
-			}
-		}
+		// lineage is saved as a single value (1), as it is (2), or
+		// run-length encoded (3) if it is shorter.
+		vectori runs;
+		int has_lineage = encodeLineage(m_lineage, runs) ? (runs.size() == 2 ? 1 : 3) : 2;
 		ar & has_lineage;
-		if (has_lineage == 1)
+		if (has_lineage == 1) {
+			long single_lineage = runs[0];
 			ar & single_lineage;
+		} else if (has_lineage == 3)
+			ar & runs;
 		else
 			ar & m_lineage;
 	} else {
@@ -3690,17 +4018,16 @@ void Population::save(boost::archive::text_oarchive & ar, const unsigned int ver
 
 #ifdef LINEAGE
 		if (!m_lineage.empty()) {
-			int has_lineage = 1;
-			long single_lineage = m_lineage[0];
-			for (size_t i = 1; i < m_lineage.size(); ++i) {
-				if (m_lineage[i] != single_lineage) {
-					has_lineage = 2;
-					break;
-				}
-			}
+			// lineage is saved as a single value (1), as it is (2), or
+			// run-length encoded (3) if it is shorter.
+			vectori runs;
+			int has_lineage = encodeLineage(m_lineage, runs) ? (runs.size() == 2 ? 1 : 3) : 2;
 			ar & has_lineage;
-			if (has_lineage == 1)
+			if (has_lineage == 1) {
+				long single_lineage = runs[0];
 				ar & single_lineage;
+			} else if (has_lineage == 3)
+				ar & runs;
 			else
 				ar & m_lineage;
 		} else {
@@ -3721,13 +4048,14 @@ void Population::save(boost::archive::text_oarchive & ar, const unsigned int ver
 	// note that many format are not supported.
 	DBG_DO(DBG_POPULATION, cerr << "Handling shared variables" << endl);
 
-	string vars = varsAsString(version >= 3);
+	string vars = m_savedVars.empty() ? varsAsString(version >= 3) : m_savedVars;
 	ar & vars;
 }
 
 
 void Population::load(boost::archive::text_iarchive & ar, const unsigned int version)
 {
+	detachGenotype();
 	size_t ma;
 
 	if (version == 0)
@@ -3882,6 +4210,10 @@ void Population::load(boost::archive::text_iarchive & ar, const unsigned int ver
 		if (has_lineage == 2) {
 			DBG_DO(DBG_POPULATION, cerr << "Handling lineage" << endl);
 			ar & m_lineage;
+		} else if (has_lineage == 3) {
+			vectori runs;
+			ar & runs;
+			decodeLineage(runs, m_genotype.size(), m_lineage);
 		} else if (has_lineage == 1) {
 			long lin_value = 0;
 			ar & lin_value;
@@ -3892,7 +4224,7 @@ void Population::load(boost::archive::text_iarchive & ar, const unsigned int ver
 			m_lineage.resize(m_genotype.size(), 0);
 		}
 #else
-		if (has_lineage == 2) {
+		if (has_lineage == 2 || has_lineage == 3) {
 			vectori lineage;
 			ar & lineage;
 		} else if (has_lineage == 1) {
@@ -3932,24 +4264,11 @@ void Population::load(boost::archive::text_iarchive & ar, const unsigned int ver
 		m_subPopIndex[i] = m_subPopIndex[i - 1] + m_subPopSize[i - 1];
 
 	// assign genotype location and set structure information for individuals
-
-	InfoIterator infoPtr = m_info.begin();
-	size_t infoStep = infoSize();
-	size_t step = genoSize();
-	GenoIterator ptr = m_genotype.begin();
-	for (size_t i = 0; i < m_popSize; ++i, ptr += step, infoPtr += infoStep) {
+	for (size_t i = 0; i < m_popSize; ++i) {
 		m_inds[i].setGenoStruIdx(genoStruIdx());
-		m_inds[i].setGenoPtr(ptr);
-		m_inds[i].setInfoPtr(infoPtr);
+		m_inds[i].setSlot(m_buffers.index(), i);
 	}
 
-#ifdef LINEAGE
-	LineageIterator lineagePtr = m_lineage.begin();
-	for (size_t i = 0; i < m_popSize; ++i, lineagePtr += step) {
-		m_inds[i].setLineagePtr(lineagePtr);
-	}
-#endif
-
 	m_ancestralGens = 0;
 	m_ancestralPops.clear();
 
@@ -4034,7 +4353,7 @@ void Population::load(boost::archive::text_iarchive & ar, const unsigned int ver
 				size_t size;
 				ar & size;
 				pd.m_genotype.resize(size);
-				ptr = pd.m_genotype.begin();
+				GenoIterator ptr = pd.m_genotype.begin();
 				WORDTYPE data = 0;
 				for (size_t i = 0; i < size; ++i) {
 					if (i % 32 == 0)
@@ -4079,7 +4398,7 @@ void Population::load(boost::archive::text_iarchive & ar, const unsigned int ver
 				size_t size;
 				ar & size;
 				pd.m_genotype.resize(size);
-				ptr = pd.m_genotype.begin();
+				GenoIterator ptr = pd.m_genotype.begin();
 				WORDTYPE data = 0;
 				for (size_t i = 0; i < size; ++i) {
 					if (i % 32 == 0)
@@ -4100,6 +4419,10 @@ void Population::load(boost::archive::text_iarchive & ar, const unsigned int ver
 			if (has_lineage == 2) {
 				DBG_DO(DBG_POPULATION, cerr << "Handling lineage" << endl);
 				ar & pd.m_lineage;
+			} else if (has_lineage == 3) {
+				vectori runs;
+				ar & runs;
+				decodeLineage(runs, pd.m_genotype.size(), pd.m_lineage);
 			} else if (has_lineage == 1) {
 				long lin_value = 0;
 				ar & lin_value;
@@ -4110,7 +4433,7 @@ void Population::load(boost::archive::text_iarchive & ar, const unsigned int ver
 				pd.m_lineage.resize(pd.m_genotype.size(), 0);
 			}
 #else
-			if (has_lineage == 2) {
+			if (has_lineage == 2 || has_lineage == 3) {
 				vectori lineage;
 				ar & lineage;
 			} else if (has_lineage == 1) {
@@ -4126,27 +4449,15 @@ void Population::load(boost::archive::text_iarchive & ar, const unsigned int ver
 		}
 		ar & pd.m_info;
 		ar & pd.m_inds;
-		// set pointer after copy this thing again (push_back)
+		// set positions after copy this thing again (push_back)
 		m_ancestralPops.push_back(pd);
-		// now set pointers
 		popData & p = m_ancestralPops.back();
-		// set pointers
 		vector<Individual> & inds = p.m_inds;
-		size_t ps = inds.size();
-		infoPtr = p.m_info.begin();
-		ptr = p.m_genotype.begin();
-		for (size_t i = 0; i < ps; ++i, ptr += step, infoPtr += infoStep) {
-			inds[i].setGenoPtr(ptr);
-			inds[i].setInfoPtr(infoPtr);
+		for (size_t i = 0; i < inds.size(); ++i) {
 			// set new genoStructure
 			inds[i].setGenoStruIdx(genoStruIdx());
+			inds[i].setSlot(p.m_buffers.index(), i);
 		}
-#ifdef LINEAGE
-		lineagePtr = p.m_lineage.begin();
-		for (size_t i = 0; i < ps; ++i, lineagePtr += step) {
-			inds[i].setLineagePtr(lineagePtr);
-		}
-#endif
 	}
 
 	// load vars from string
@@ -4284,9 +4595,9 @@ void Population::syncIndPointers(bool infoOnly) const
 		vectorf::iterator infoPtr = tmpInfo.begin();
 
 		IndIterator ind = const_cast<Population *>(this)->indIterator();
-		for (; ind.valid(); ++ind) {
+		for (size_t slot = 0; ind.valid(); ++ind, ++slot) {
 			copy(ind->infoBegin(), ind->infoEnd(), infoPtr);
-			ind->setInfoPtr(infoPtr);
+			ind->setInfoSlot(slot);
 			infoPtr += is;
 		}
 		const_cast<Population *>(this)->m_info.swap(tmpInfo);
@@ -4311,7 +4622,7 @@ void Population::syncIndPointers(bool infoOnly) const
 		vectorf::iterator infoPtr = tmpInfo.begin();
 
 		IndIterator ind = const_cast<Population *>(this)->indIterator();
-		for (; ind.valid(); ++ind) {
+		for (size_t slot = 0; ind.valid(); ++ind, ++slot) {
 #ifdef BINARYALLELE
 			copyGenotype(ind->genoBegin(), it, sz);
 #else
@@ -4322,15 +4633,14 @@ void Population::syncIndPointers(bool infoOnly) const
 #  endif
 #endif
 			LINEAGE_EXPR(copy(ind->lineageBegin(), ind->lineageEnd(), lineagePtr));
-			ind->setGenoPtr(it);
-			LINEAGE_EXPR(ind->setLineagePtr(lineagePtr));
 			it += sz;
 			LINEAGE_EXPR(lineagePtr += sz);
 			copy(ind->infoBegin(), ind->infoEnd(), infoPtr);
-			ind->setInfoPtr(infoPtr);
+			ind->setSlot(m_buffers.index(), slot);
 			infoPtr += is;
 		}
-		// discard original genotype
+		// discard original genotype, which is not copied if shared
+		const_cast<Population *>(this)->m_buffers.releaseGenotype();
 		const_cast<Population *>(this)->m_genotype.swap(tmpGenotype);
 		const_cast<Population *>(this)->m_info.swap(tmpInfo);
 		LINEAGE_EXPR(const_cast<Population *>(this)->m_lineage.swap(tmpLineage));
@@ -49,6 +49,7 @@ using std::deque;
 #include "boost_pch.hpp"
 #include "individual.h"
 #include "virtualSubPop.h"
+#include "genealogy.h"
 
 
 namespace simuPOP {
@@ -265,6 +266,26 @@ public:
 	 */
 	Population * clone() const;
 
+	/** CPPONLY Create a copy of the population that can be saved without
+	 *  accessing Python, for example from a background thread. Shared
+	 *  variables are pickled into the copy so that the copy does not hold
+	 *  any Python object.
+	 */
+	Population * snapshot() const;
+
+	/** CPPONLY Create a copy of the population that shares the genotypes of
+	 *  all generations with this population. Shared genotypes are copied
+	 *  by \c detachGenotype before either population changes them.
+	 */
+	Population * cloneSharingGenotype() const;
+
+	/** CPPONLY Copy genotypes of all generations that are shared with other
+	 *  populations so that they can be changed. This function is called by
+	 *  member functions that access the genotypes of a population and has to
+	 *  be called before genotypes of its individuals are changed directly.
+	 */
+	void detachGenotype() const;
+
 	/** Swap the content of two population objects, which can be handy in some
 	 *  particular circumstances. For example, you could swap out a population
 	 *  in a simulator.
@@ -284,23 +305,19 @@ public:
 #endif
 		m_info.swap(rhs.m_info);
 		m_inds.swap(rhs.m_inds);
+		m_buffers.swap(rhs.m_buffers);
 		std::swap(m_ancestralGens, rhs.m_ancestralGens);
 		m_vars.swap(rhs.m_vars);
 		m_ancestralPops.swap(rhs.m_ancestralPops);
 		std::swap(m_curAncestralGen, rhs.m_curAncestralGen);
 		std::swap(m_indOrdered, rhs.m_indOrdered);
 		std::swap(m_vspSplitter, rhs.m_vspSplitter);
+		std::swap(m_genealogy, rhs.m_genealogy);
+#ifdef LONGALLELE
+		m_mutantRegistry.swap(rhs.m_mutantRegistry);
+#endif
 		std::swap(rhs.m_gen, m_gen);
 		std::swap(rhs.m_rep, m_rep);
-#ifdef MUTANTALLELE
-		// vectorm must be setGenoPtr after swap
-		GenoIterator ptr = m_genotype.begin();
-		for (size_t i = 0; i < m_inds.size(); ++i, ptr += genoSize())
-			m_inds[i].setGenoPtr(ptr);
-		ptr = rhs.m_genotype.begin();
-		for (size_t i = 0; i < rhs.m_inds.size(); ++i, ptr += rhs.genoSize())
-			rhs.m_inds[i].setGenoPtr(ptr);
-#endif
 	}
 
 
@@ -857,6 +874,7 @@ public:
 		if (order && !indOrdered())
 			syncIndPointers();
 
+		detachGenotype();
 		return m_genotype.begin();
 	}
 
@@ -869,6 +887,7 @@ public:
 		if (order && !indOrdered())
 			syncIndPointers();
 
+		detachGenotype();
 		return m_genotype.end();
 	}
 
@@ -919,6 +938,7 @@ public:
 
 		syncIndPointers(order);
 
+		detachGenotype();
 		return m_genotype.begin() + m_subPopIndex[subPop] * genoSize();
 	}
 
@@ -931,6 +951,7 @@ public:
 		CHECKRANGESUBPOP(subPop);
 		syncIndPointers(order);
 
+		detachGenotype();
 		return m_genotype.begin() + m_subPopIndex[subPop + 1] * genoSize();
 	}
 
@@ -1526,6 +1547,49 @@ public:
 	/// CPPONLY remove certain ancestral generations
 	void keepAncestralGens(const uintList & ancGens);
 
+	/** Start recording the genealogy of this population during evolution.
+	 *  Individuals in the present generation are added as founder nodes,
+	 *  and genotype transmitters will record how offspring inherit segments
+	 *  of parental chromosomes in subsequent generations. Individuals are
+	 *  identified by information field \e idField (default to \c ind_id),
+	 *  which should hold unique IDs for all individuals (e.g. assigned by
+	 *  an \c IdTagger during mating). If a positive \e simplifyInterval is
+	 *  given, the genealogy will be simplified every \e simplifyInterval
+	 *  generations so that only the ancestry of the present generation is
+	 *  kept. Existing records are discarded if this function is called
+	 *  again. Please refer to class \c Genealogy for details.
+	 *  <group>6-ancestral</group>
+	 */
+	void recordGenealogy(const string & idField = "ind_id", UINT simplifyInterval = 0);
+
+	/** Return the genealogy that is being recorded for this population. A
+	 *  \c ValueError will be raised if the genealogy of this population is
+	 *  not recorded. Note that the genealogy is not saved with the
+	 *  population.
+	 *  <group>6-ancestral</group>
+	 */
+	Genealogy & genealogy();
+
+	/** CPPONLY Return the genealogy that is being recorded, or \c NULL if
+	 *  the genealogy of this population is not recorded.
+	 */
+	Genealogy * genealogyRecorder() const
+	{
+		return m_genealogy;
+	}
+
+#ifdef LONGALLELE
+	/** CPPONLY Return the registry of mutants that is shared by operators
+	 *  in mutational space.
+	 */
+	MutantRegistry & mutantRegistry()
+	{
+		return m_mutantRegistry;
+	}
+
+
+#endif
+
 	/** Making ancestral generation \e idx (\c 0 for current generation, \c 1
 	 *  for parental generation, \c 2 for grand-parental generation, etc) the
 	 *  current generation. This is an efficient way to access Population
@@ -1638,6 +1702,32 @@ private:
 
 	BOOST_SERIALIZATION_SPLIT_MEMBER();
 
+	/** Expand the genotype of individuals in the current generation to the
+	 *  current genotypic structure, with the \e i-th existing locus moved to
+	 *  locus \c loci[i] and new loci filled with allele 0.
+	 */
+	void expandGenotype(const vectoru & loci);
+
+	/** Release the spare capacity that \c expandGenotype reserves in the
+	 *  genotype and lineage buffers of all generations. This function is
+	 *  const because the population is not changed conceptually.
+	 */
+	void shrinkGenotype() const;
+
+	/** Move \e n individuals starting at \e from, with their genotypes,
+	 *  lineage and information fields, to \e to, which should not be larger
+	 *  than \e from. Genotypes are not moved in the mutant module.
+	 */
+	void moveIndividuals(size_t from, size_t to, size_t n);
+
+	/** Release the pages of newly allocated genotype, lineage and information
+	 *  field buffers and clear them by the threads that will generate
+	 *  offspring into subpopulations of sizes \e subPopSizes during mating,
+	 *  so that the pages are placed on the NUMA nodes of these threads.
+	 *  Return \c false if the pages could not be released.
+	 */
+	bool placeBuffers(const vectoru & subPopSizes);
+
 private:
 	/// population size: number of individual
 	size_t m_popSize;
@@ -1673,15 +1763,36 @@ private:
 	/// only in head node?
 	vector<Individual> m_inds;
 
+	/// registered genotype, lineage and info vectors, referred to by m_inds
+	IndBuffers m_buffers;
+
 	int m_ancestralGens;
 
 	/// shared variables for this population
 	mutable SharedVariables m_vars;
 
+	/// pickled shared variables of a snapshot, empty for regular populations
+	string m_savedVars;
+
+	/// genealogy being recorded, NULL if not recorded
+	Genealogy * m_genealogy;
+
+#ifdef LONGALLELE
+	/// mutants in mutational space
+	MutantRegistry m_mutantRegistry;
+#endif
+
 	/// store previous populations
 	/// need to store: subPopSize, genotype and m_inds
 	struct popData
 	{
+		popData();
+
+		// individuals of the copy refer to its own vectors
+		popData(const popData & rhs);
+
+		popData & operator=(const popData & rhs);
+
 		vectoru m_subPopSize;
 		vectorstr m_subPopNames;
 #ifdef MUTANTALLELE
@@ -1698,6 +1809,8 @@ private:
 		vector<Individual> m_inds;
 		bool m_indOrdered;
 
+		IndBuffers m_buffers;
+
 		// swap between a popData and existing data.
 		void swap(Population & pop);
 
@@ -1768,7 +1881,8 @@ Population & loadPopulation(const string & file);
 // version 1: with lineage information for lineage-aware modules
 // version 2: for memory-efficient save/load
 // version 3: use pickle to save load population variables
-BOOST_CLASS_VERSION(simuPOP::Population, 3)
+// version 4: run-length encoded lineage
+BOOST_CLASS_VERSION(simuPOP::Population, 4)
 #  endif
 #endif
 #endif
@@ -58,11 +58,26 @@ bool BaseQuanTrait::apply(Population & pop) const
 			if (sp->isVirtual())
 				pop.activateVirtualSubPop(*sp);
 
-			IndIterator ind = pop.indIterator(sp->subPop());
-			for (; ind.valid(); ++ind) {
-				qtrait(&*ind, pop.gen(), traits);
-				for (size_t i = 0; i < infoSize(); ++i)
-					ind->setInfo(traits[i], infoIdx[i]);
+			if (numThreads() > 1 && parallelizable()) {
+#pragma omp parallel
+				{
+#ifdef _OPENMP
+					vectorf traits(infoSize());
+					IndIterator ind = pop.indIterator(sp->subPop(), omp_get_thread_num());
+					for (; ind.valid(); ++ind) {
+						qtrait(&*ind, pop.gen(), traits);
+						for (size_t i = 0; i < infoSize(); ++i)
+							ind->setInfo(traits[i], infoIdx[i]);
+					}
+#endif
+				}
+			} else {
+				IndIterator ind = pop.indIterator(sp->subPop());
+				for (; ind.valid(); ++ind) {
+					qtrait(&*ind, pop.gen(), traits);
+					for (size_t i = 0; i < infoSize(); ++i)
+						ind->setInfo(traits[i], infoIdx[i]);
+				}
 			}
 
 			if (sp->isVirtual())
@@ -139,4 +154,157 @@ void PyQuanTrait::qtrait(Individual * ind, size_t gen, vectorf & traits) const
 }
 
 
+AdditiveQuanTrait::AdditiveQuanTrait(const lociList & loci, const floatMatrix & effects,
+	const floatList & dominance, double envVar, const uintList & ancGens, int begin, int end, int step,
+	const intList & at, const intList & reps, const subPopList & subPops, const stringList & infoFields) :
+	BaseQuanTrait(ancGens, begin, end, step, at, reps, subPops, infoFields),
+	m_loci(loci), m_effects(), m_effectIdx(1, 0), m_dominance(dominance.elems()), m_envVar(envVar)
+{
+	const matrixf & eff = effects.elems();
+
+	if (eff.empty())
+		throw ValueError("Please specify effects of alleles.");
+	if (infoSize() != 1)
+		throw ValueError("Please specify exactly one trait field.");
+	if (m_envVar < 0)
+		throw ValueError("Environmental variance should be non-negative.");
+	// flatten effects so that effects of all loci are stored contiguously
+	for (size_t i = 0; i < eff.size(); ++i) {
+		m_effects.insert(m_effects.end(), eff[i].begin(), eff[i].end());
+		m_effectIdx.push_back(m_effects.size());
+	}
+}
+
+
+string AdditiveQuanTrait::describe(bool /* format */) const
+{
+	return "<simuPOP.AdditiveQuanTrait> additive quantitative trait model" ;
+}
+
+
+void AdditiveQuanTrait::resolveLoci(const Population & pop) const
+{
+	// loci are resolved, and checked against effects and dominance
+	// coefficients, before individuals are processed by multiple threads.
+	const vectoru & loci = m_loci.elems(&pop);
+
+	if (m_effectIdx.size() != 2 && m_effectIdx.size() != loci.size() + 1)
+		throw ValueError("Please specify effects of alleles for all or each of the loci.");
+	if (m_dominance.size() > 1 && m_dominance.size() != loci.size())
+		throw ValueError("Please specify dominance coefficient for all or each of the loci.");
+}
+
+
+bool AdditiveQuanTrait::apply(Population & pop) const
+{
+	resolveLoci(pop);
+	return BaseQuanTrait::apply(pop);
+}
+
+
+void AdditiveQuanTrait::prepareDuringMating(Population & /* pop */, Population & offPop,
+                                            RawIndIterator /* offBegin */, RawIndIterator /* offEnd */) const
+{
+	resolveLoci(offPop);
+}
+
+
+void AdditiveQuanTrait::qtrait(Individual * ind, size_t /* gen */, vectorf & traits) const
+{
+	const vectoru & loci = m_loci.elems(ind);
+
+	double value = 0;
+	if (ind->ploidy() == 2 && ind->chromX() < 0 && ind->chromY() < 0 &&
+	    ind->mitochondrial() < 0 && !ind->isHaplodiploid()) {
+		// the common case with only autosomes: two alleles at each locus
+		GenoIterator geno0 = ind->genoBegin(0);
+		GenoIterator geno1 = ind->genoBegin(1);
+		if (m_dominance.empty())
+			// without dominance, the genotypic value is the sum of the
+			// values of the two haplotypes, each summed in one pass
+			value = haploValue(geno0, loci) + haploValue(geno1, loci);
+		else {
+			for (size_t i = 0; i < loci.size(); ++i) {
+				size_t a = ALLELE_AS_UNSINGED(DEREF_ALLELE(geno0 + loci[i]));
+				size_t b = ALLELE_AS_UNSINGED(DEREF_ALLELE(geno1 + loci[i]));
+				double ea = effect(i, a);
+				double eb = effect(i, b);
+				value += ea + eb;
+				if (a != b)
+					value += dominance(i) * fabs(ea - eb);
+			}
+		}
+	} else
+		value = genoValue(ind, loci);
+
+	if (m_envVar > 0)
+		value += getRNG().randNormal(0, sqrt(m_envVar));
+	traits[0] = value;
+}
+
+
+double AdditiveQuanTrait::haploValue(GenoIterator geno, const vectoru & loci) const
+{
+	double value = 0;
+
+	if (m_effects.empty())
+		return 0;
+	if (m_effectIdx.size() == 2) {
+		// the same effects for all loci
+		const double * eff = &m_effects[0];
+		size_t numAllele = m_effects.size();
+		for (size_t i = 0; i < loci.size(); ++i) {
+			size_t a = ALLELE_AS_UNSINGED(DEREF_ALLELE(geno + loci[i]));
+			if (a < numAllele)
+				value += eff[a];
+		}
+	} else {
+		for (size_t i = 0; i < loci.size(); ++i) {
+			size_t a = ALLELE_AS_UNSINGED(DEREF_ALLELE(geno + loci[i]));
+			if (a < m_effectIdx[i + 1] - m_effectIdx[i])
+				value += m_effects[m_effectIdx[i] + a];
+		}
+	}
+	return value;
+}
+
+
+double AdditiveQuanTrait::genoValue(const Individual * ind, const vectoru & loci) const
+{
+	size_t ply = ind->ploidy();
+
+	if (ind->isHaplodiploid() && ind->sex() == MALE)
+		ply = 1;
+
+	bool male = ind->sex() == MALE;
+	double value = 0;
+	for (size_t i = 0; i < loci.size(); ++i) {
+		size_t chromType = ind->chromType(ind->chromLocusPair(loci[i]).first);
+		double sum = 0;
+		double minEff = 0;
+		double maxEff = 0;
+		size_t cnt = 0;
+		for (size_t p = 0; p < ply; ++p) {
+			if (chromType == CHROMOSOME_Y && !male)
+				continue;
+			if (((chromType == CHROMOSOME_X && p == 1) ||
+			     (chromType == CHROMOSOME_Y && p == 0)) && male)
+				continue;
+			if (chromType == MITOCHONDRIAL && p > 0)
+				continue;
+			double e = effect(i, ALLELE_AS_UNSINGED(ind->allele(loci[i], p)));
+			sum += e;
+			minEff = cnt == 0 ? e : std::min(minEff, e);
+			maxEff = cnt == 0 ? e : std::max(maxEff, e);
+			++cnt;
+		}
+		// dominance is only defined for heterozygotes of diploid loci
+		if (cnt == 2 && !m_dominance.empty())
+			sum += dominance(i) * (maxEff - minEff);
+		value += sum;
+	}
+	return value;
+}
+
+
 }
@@ -187,5 +187,115 @@ private:
 	const lociList m_loci;
 };
 
+
+/** This quantitative trait operator assigns a trait field as the sum of
+ *  genotypic values of alleles at a list of loci, plus an optional normally
+ *  distributed environmental deviation. Genotypic values are calculated in
+ *  C++ and, if multiple threads are used, in parallel, so this operator can
+ *  be used for polygenic traits with a large number of loci.
+ */
+class AdditiveQuanTrait : public BaseQuanTrait
+{
+public:
+	/** Create an additive quantitative trait operator for specified \e loci,
+	 *  which can be a list of loci indexes, names, or \c ALL_AVAIL. Effects of
+	 *  alleles are specified as a list of effects of alleles \c 0, \c 1, ...
+	 *  for each locus (parameter \e effects), or a single list that applies
+	 *  to all loci. Alleles without specified effect have no effect. The
+	 *  genotypic value of an individual is the sum of effects of all its
+	 *  alleles at these loci. If a dominance coefficient \c d is given for a
+	 *  locus (parameter \e dominance, one for all loci or one for each locus),
+	 *  the value of a heterozygote with alleles of effects \c a and \c b is
+	 *  <tt>a + b + d * |a - b|</tt> so that \c d=0 (default) is additive,
+	 *  \c d=1 is complete dominance of the allele with larger effect and
+	 *  \c d=-1 is complete dominance of the allele with smaller effect.
+	 *  Alleles on the second homologous copy of chromosome X of male, on
+	 *  chromosome Y of female, and on the second homologous copy of
+	 *  mitochondrial chromosomes and haplodiploid males are ignored. If a
+	 *  positive environmental variance \e envVar is specified, a random
+	 *  value drawn from <tt>N(0, envVar)</tt> will be added to the genotypic
+	 *  value. The trait value will be assigned to the only trait field
+	 *  (\e infoFields).
+	 */
+	AdditiveQuanTrait(const lociList & loci, const floatMatrix & effects,
+		const floatList & dominance = vectorf(), double envVar = 0,
+		const uintList & ancGens = uintList(NULL), int begin = 0, int end = -1, int step = 1,
+		const intList & at = vectori(), const intList & reps = intList(), const subPopList & subPops = subPopList(),
+		const stringList & infoFields = vectorstr());
+
+	/// HIDDEN Deep copy of an additive quantitative trait operator
+	virtual BaseOperator * clone() const
+	{
+		return new AdditiveQuanTrait(*this);
+	}
+
+
+	/// HIDDEN
+	bool apply(Population & pop) const;
+
+	/** CPPONLY
+	 *  resolve loci for offspring in \e offPop before they are generated
+	 */
+	void prepareDuringMating(Population & pop, Population & offPop,
+		RawIndIterator offBegin, RawIndIterator offEnd) const;
+
+	/** CPPONLY
+	 *  calculate genotypic value and add environmental deviation
+	 */
+	virtual void qtrait(Individual * ind, size_t gen, vectorf & traits) const;
+
+	/// HIDDEN
+	string describe(bool format = true) const;
+
+	/// CPPONLY
+	bool parallelizable() const
+	{
+		return true;
+	}
+
+
+private:
+	/// effect of allele \e allele at the \e idx-th locus
+	double effect(size_t idx, size_t allele) const
+	{
+		size_t row = m_effectIdx.size() == 2 ? 0 : idx;
+		size_t beg = m_effectIdx[row];
+
+		return allele < m_effectIdx[row + 1] - beg ? m_effects[beg + allele] : 0;
+	}
+
+
+	double dominance(size_t idx) const
+	{
+		return m_dominance.size() == 1 ? m_dominance[0] : m_dominance[idx];
+	}
+
+
+	/** resolve loci for \e pop and check that effects and dominance
+	 *  coefficients are given for all or each of the loci
+	 */
+	void resolveLoci(const Population & pop) const;
+
+	/// sum of effects of alleles on a haplotype starting at \e geno
+	double haploValue(GenoIterator geno, const vectoru & loci) const;
+
+	/// genotypic value of an individual with sex or haplodiploid chromosomes
+	double genoValue(const Individual * ind, const vectoru & loci) const;
+
+private:
+	/// QTL
+	const lociList m_loci;
+
+	/// effects of all alleles, concatenated locus by locus
+	vectorf m_effects;
+
+	/// index of effects of each locus in m_effects
+	vectoru m_effectIdx;
+
+	const vectorf m_dominance;
+
+	const double m_envVar;
+};
+
 }
 #endif
@@ -40,6 +40,10 @@ bool BaseSelector::apply(Population & pop) const
 
 	subPopList subPops = applicableSubPops(pop);
 
+	// selectors in a MlSelector can be applied to virtual subpopulations
+	if (pop.virtualSplitter())
+		pop.virtualSplitter()->prepare(pop);
+
 	subPopList::const_iterator sp = subPops.begin();
 	subPopList::const_iterator spEnd = subPops.end();
 
@@ -541,34 +545,28 @@ double PyMlSelector::getFitnessValue(const LocGenotype & geno) const
 
 double MutSpaceSelector::indFitness(Population & /* pop */, RawIndIterator ind) const
 {
-	if (ind->sex() == MALE && ind->chromType(0) == CHROMOSOME_X) {
-		if (m_mode == MULTIPLICATIVE) {
-			return randomSelMulFitnessExt(ind->genoBegin(0), ind->genoEnd(0), true);
-		} else if (m_mode == ADDITIVE) {
-			if (m_additive)
-				return randomSelAddFitness(ind->genoBegin(0), ind->genoEnd(0), true);
-			else
-				return randomSelAddFitnessExt(ind->genoBegin(0), ind->genoEnd(0), true);
-		} else if (m_mode == EXPONENTIAL) {
+	bool chrX = ind->sex() == MALE && ind->chromType(0) == CHROMOSOME_X;
+	GenoIterator it = chrX ? ind->genoBegin(0) : ind->genoBegin();
+	GenoIterator it_end = chrX ? ind->genoEnd(0) : ind->genoEnd();
+
+	// m_additive might be reset if a new mutant with h != 0.5 is found
+	// during the calculation, in which case the extended model is used.
+	if (m_mode == MULTIPLICATIVE) {
+		return randomSelMulFitnessExt(it, it_end, chrX);
+	} else if (m_mode == ADDITIVE) {
+		if (m_additive) {
+			double fitness = randomSelAddFitness(it, it_end, chrX);
 			if (m_additive)
-				return randomSelExpFitness(ind->genoBegin(0), ind->genoEnd(0), true);
-			else
-				return randomSelExpFitnessExt(ind->genoBegin(0), ind->genoEnd(0), true);
+				return fitness;
 		}
-	} else {
-		if (m_mode == MULTIPLICATIVE) {
-			return randomSelMulFitnessExt(ind->genoBegin(), ind->genoEnd(), false);
-		} else if (m_mode == ADDITIVE) {
-			if (m_additive)
-				return randomSelAddFitness(ind->genoBegin(), ind->genoEnd(), false);
-			else
-				return randomSelAddFitnessExt(ind->genoBegin(), ind->genoEnd(), false);
-		} else if (m_mode == EXPONENTIAL) {
+		return randomSelAddFitnessExt(it, it_end, chrX);
+	} else if (m_mode == EXPONENTIAL) {
+		if (m_additive) {
+			double fitness = randomSelExpFitness(it, it_end, chrX);
 			if (m_additive)
-				return randomSelExpFitness(ind->genoBegin(), ind->genoEnd(), false);
-			else
-				return randomSelExpFitnessExt(ind->genoBegin(), ind->genoEnd(), false);
+				return fitness;
 		}
+		return randomSelExpFitnessExt(it, it_end, chrX);
 	}
 	return 0;
 }
@@ -577,16 +575,53 @@ double MutSpaceSelector::indFitness(Population & /* pop */, RawIndIterator ind)
 bool MutSpaceSelector::apply(Population & pop) const
 {
 	m_newMutants.clear();
-	if (!BaseSelector::apply(pop))
-		return false;
+
+	size_t fit_id = pop.infoIdx(this->infoField(0));
+
+	subPopList subPops = applicableSubPops(pop);
+
+	subPopList::const_iterator sp = subPops.begin();
+	subPopList::const_iterator spEnd = subPops.end();
+
+	for (; sp != spEnd; ++sp) {
+		if (sp->isVirtual())
+			pop.activateVirtualSubPop(*sp);
+		if (numThreads() > 1) {
+			// selection coefficients of new mutants are assigned (in the same
+			// order as a serial run) before fitness values are calculated, so
+			// that the calculation only reads from m_selCoefs.
+			IndIterator ind = pop.indIterator(sp->subPop());
+			for (; ind.valid(); ++ind) {
+				if (ind->sex() == MALE && ind->chromType(0) == CHROMOSOME_X)
+					assignSelCoef(ind->genoBegin(0), ind->genoEnd(0));
+				else
+					assignSelCoef(ind->genoBegin(), ind->genoEnd());
+			}
+#pragma omp parallel
+			{
+#ifdef _OPENMP
+				IndIterator ind = pop.indIterator(sp->subPop(), omp_get_thread_num());
+				for (; ind.valid(); ++ind)
+					ind->setInfo(indFitness(pop, ind.rawIter()), fit_id);
+#endif
+			}
+		} else {
+			IndIterator ind = pop.indIterator(sp->subPop());
+			for (; ind.valid(); ++ind)
+				ind->setInfo(indFitness(pop, ind.rawIter()), fit_id);
+		}
+		if (sp->isVirtual())
+			pop.deactivateVirtualSubPop(sp->subPop());
+	}
+
 	// output NEW mutant...
 	if (!m_newMutants.empty() && !noOutput()) {
 		ostream & out = getOstream(pop.dict());
 		vectoru::const_iterator it = m_newMutants.begin();
 		vectoru::const_iterator it_end = m_newMutants.end();
 		for (; it != it_end; ++it) {
-			SelCoef s = m_selFactory[*it];
-			out << *it << '\t' << s.first << '\t' << s.second << '\n';
+			const SelCoef * s = m_selCoefs.find(*it);
+			out << *it << '\t' << s->first << '\t' << s->second << '\n';
 		}
 		closeOstream();
 	}
@@ -594,6 +629,63 @@ bool MutSpaceSelector::apply(Population & pop) const
 }
 
 
+void MutSpaceSelector::SelCoefTable::insert(size_t loc, const SelCoef & sc)
+{
+	DBG_ASSERT(loc != 0 && find(loc) == NULL, SystemError,
+		(boost::format("Selection coefficient of mutant %1% should not be assigned twice.") % loc).str());
+	// keep the table at most half full so that probe sequences stay short
+	if (2 * (m_size + 1) > m_locs.size()) {
+		vectoru locs(2 * m_locs.size(), 0);
+		vector<SelCoef> coefs(locs.size());
+		size_t mask = locs.size() - 1;
+		for (size_t i = 0; i < m_locs.size(); ++i) {
+			if (m_locs[i] == 0)
+				continue;
+			size_t j = slot(m_locs[i], mask);
+			while (locs[j] != 0)
+				j = (j + 1) & mask;
+			locs[j] = m_locs[i];
+			coefs[j] = m_coefs[i];
+		}
+		m_locs.swap(locs);
+		m_coefs.swap(coefs);
+	}
+	size_t mask = m_locs.size() - 1;
+	size_t i = slot(loc, mask);
+	while (m_locs[i] != 0)
+		i = (i + 1) & mask;
+	m_locs[i] = loc;
+	m_coefs[i] = sc;
+	++m_size;
+}
+
+
+void MutSpaceSelector::assignSelCoef(GenoIterator it, GenoIterator it_end) const
+{
+	if (m_mode == MULTIPLICATIVE || !m_additive) {
+		// visit mutants in the order used by the extended models
+		vectoru mutants;
+		sortedMutants(it, it_end, mutants);
+		for (size_t i = 0; i < mutants.size(); ++i)
+			if (m_selCoefs.find(mutants[i]) == NULL)
+				getFitnessValue(mutants[i]);
+	} else {
+		for (; it != it_end; ++it)
+			if (*it != 0u && m_selCoefs.find(*it) == NULL)
+				getFitnessValue(*it);
+	}
+}
+
+
+void MutSpaceSelector::sortedMutants(GenoIterator it, GenoIterator it_end, vectoru & mutants) const
+{
+	for (; it != it_end; ++it)
+		if (*it != 0u)
+			mutants.push_back(*it);
+	std::sort(mutants.begin(), mutants.end());
+}
+
+
 MutSpaceSelector::SelCoef MutSpaceSelector::getFitnessValue(size_t mutant) const
 {
 	size_t sz = m_selDist.size();
@@ -640,7 +732,7 @@ MutSpaceSelector::SelCoef MutSpaceSelector::getFitnessValue(size_t mutant) const
 				h = m_selDist[3];
 		}
 	}
-	m_selFactory[mutant] = SelCoef(s, h);
+	m_selCoefs.insert(mutant, SelCoef(s, h));
 	m_newMutants.push_back(mutant);
 	if (m_additive && h != 0.5)
 		m_additive = false;
@@ -655,11 +747,8 @@ double MutSpaceSelector::randomSelAddFitness(GenoIterator it, GenoIterator it_en
 	for (; it != it_end; ++it) {
 		if (*it == 0u)
 			continue;
-		SelMap::iterator sit = m_selFactory.find(static_cast<unsigned int>(*it));
-		if (sit == m_selFactory.end())
-			s += getFitnessValue(*it).first / 2.;
-		else
-			s += sit->second.first / 2;
+		const SelCoef * sc = m_selCoefs.find(*it);
+		s += (sc == NULL ? getFitnessValue(*it).first : sc->first) / 2.;
 	}
 	if (chrX)
 		// fitness of variant on chromosome X is as if it is homogeneous
@@ -675,11 +764,8 @@ double MutSpaceSelector::randomSelExpFitness(GenoIterator it, GenoIterator it_en
 	for (; it != it_end; ++it) {
 		if (*it == 0u)
 			continue;
-		SelMap::iterator sit = m_selFactory.find(static_cast<unsigned int>(*it));
-		if (sit == m_selFactory.end())
-			s += getFitnessValue(*it).first / 2.;
-		else
-			s += sit->second.first / 2;
+		const SelCoef * sc = m_selCoefs.find(*it);
+		s += (sc == NULL ? getFitnessValue(*it).first : sc->first) / 2.;
 	}
 	if (chrX)
 		// fitness of variant on chromosome X is as if it is homogeneous
@@ -690,35 +776,23 @@ double MutSpaceSelector::randomSelExpFitness(GenoIterator it, GenoIterator it_en
 
 double MutSpaceSelector::randomSelMulFitnessExt(GenoIterator it, GenoIterator it_end, bool chrX) const
 {
-	MutCounter cnt;
+	vectoru mutants;
 
-	for (; it != it_end; ++it) {
-		if (*it == 0u)
-			continue;
-		MutCounter::iterator mit = cnt.find(*it);
-		if (mit == cnt.end())
-			cnt[*it] = 1;
-		else
-			++mit->second;
-	}
+	sortedMutants(it, it_end, mutants);
 
 	double s = 1;
-	MutCounter::iterator mit = cnt.begin();
-	MutCounter::iterator mit_end = cnt.end();
-	for (; mit != mit_end; ++mit) {
-		SelMap::iterator sit = m_selFactory.find(mit->first);
-		if (sit == m_selFactory.end()) {
-			SelCoef sf = getFitnessValue(mit->first);
-			if (mit->second == 1 && !chrX)
-				s *= 1 - sf.first * sf.second;
-			else
-				s *= 1 - sf.first;
-		} else {
-			if (mit->second == 1 && !chrX)
-				s *= 1 - sit->second.first * sit->second.second;
-			else
-				s *= 1 - sit->second.first;
-		}
+	for (size_t i = 0; i < mutants.size(); ) {
+		// number of copies of this mutant
+		size_t j = i + 1;
+		while (j < mutants.size() && mutants[j] == mutants[i])
+			++j;
+		const SelCoef * sc = m_selCoefs.find(mutants[i]);
+		SelCoef sf = sc == NULL ? getFitnessValue(mutants[i]) : *sc;
+		if (j - i == 1 && !chrX)
+			s *= 1 - sf.first * sf.second;
+		else
+			s *= 1 - sf.first;
+		i = j;
 	}
 	return s;
 }
@@ -726,35 +800,23 @@ double MutSpaceSelector::randomSelMulFitnessExt(GenoIterator it, GenoIterator it
 
 double MutSpaceSelector::randomSelAddFitnessExt(GenoIterator it, GenoIterator it_end, bool chrX) const
 {
-	MutCounter cnt;
+	vectoru mutants;
 
-	for (; it != it_end; ++it) {
-		if (*it == 0u)
-			continue;
-		MutCounter::iterator mit = cnt.find(*it);
-		if (mit == cnt.end())
-			cnt[*it] = 1;
-		else
-			++mit->second;
-	}
+	sortedMutants(it, it_end, mutants);
 
 	double s = 0;
-	MutCounter::iterator mit = cnt.begin();
-	MutCounter::iterator mit_end = cnt.end();
-	for (; mit != mit_end; ++mit) {
-		SelMap::iterator sit = m_selFactory.find(mit->first);
-		if (sit == m_selFactory.end()) {
-			SelCoef sf = getFitnessValue(mit->first);
-			if (mit->second == 1 && !chrX)
-				s += sf.first * sf.second;
-			else
-				s += sf.first;
-		} else {
-			if (mit->second == 1 && !chrX)
-				s += sit->second.first * sit->second.second;
-			else
-				s += sit->second.first;
-		}
+	for (size_t i = 0; i < mutants.size(); ) {
+		// number of copies of this mutant
+		size_t j = i + 1;
+		while (j < mutants.size() && mutants[j] == mutants[i])
+			++j;
+		const SelCoef * sc = m_selCoefs.find(mutants[i]);
+		SelCoef sf = sc == NULL ? getFitnessValue(mutants[i]) : *sc;
+		if (j - i == 1 && !chrX)
+			s += sf.first * sf.second;
+		else
+			s += sf.first;
+		i = j;
 	}
 	return 1 - s > 0 ? 1 - s : 0;
 }
@@ -762,35 +824,23 @@ double MutSpaceSelector::randomSelAddFitnessExt(GenoIterator it, GenoIterator it
 
 double MutSpaceSelector::randomSelExpFitnessExt(GenoIterator it, GenoIterator it_end, bool chrX) const
 {
-	MutCounter cnt;
+	vectoru mutants;
 
-	for (; it != it_end; ++it) {
-		if (*it == 0u)
-			continue;
-		MutCounter::iterator mit = cnt.find(*it);
-		if (mit == cnt.end())
-			cnt[*it] = 1;
-		else
-			++mit->second;
-	}
+	sortedMutants(it, it_end, mutants);
 
 	double s = 0;
-	MutCounter::iterator mit = cnt.begin();
-	MutCounter::iterator mit_end = cnt.end();
-	for (; mit != mit_end; ++mit) {
-		SelMap::iterator sit = m_selFactory.find(mit->first);
-		if (sit == m_selFactory.end()) {
-			SelCoef sf = getFitnessValue(mit->first);
-			if (mit->second == 1 && !chrX)
-				s += sf.first * sf.second;
-			else
-				s += sf.first;
-		} else {
-			if (mit->second == 1 && !chrX)
-				s += sit->second.first * sit->second.second;
-			else
-				s += sit->second.first;
-		}
+	for (size_t i = 0; i < mutants.size(); ) {
+		// number of copies of this mutant
+		size_t j = i + 1;
+		while (j < mutants.size() && mutants[j] == mutants[i])
+			++j;
+		const SelCoef * sc = m_selCoefs.find(mutants[i]);
+		SelCoef sf = sc == NULL ? getFitnessValue(mutants[i]) : *sc;
+		if (j - i == 1 && !chrX)
+			s += sf.first * sf.second;
+		else
+			s += sf.first;
+		i = j;
 	}
 	return exp(-s);
 }
@@ -587,7 +587,9 @@ private:
 /** This selector assumes that alleles are mutant locations in the mutational
  *  space and assign fitness values to them according to a random distribution.
  *  The overall individual fitness is determined by either an additive, an
- *  multiplicative or an exponential model.
+ *  multiplicative or an exponential model. Selection coefficients are
+ *  assigned to mutants when they are first seen and are kept in a flat table,
+ *  so fitness values of individuals can be calculated by multiple threads.
  */
 class MutSpaceSelector : public BaseSelector
 {
@@ -620,7 +622,7 @@ public:
 		const intList & reps = intList(), const subPopList & subPops = subPopList(),
 		const stringList & infoFields = stringList("fitness")) :
 		BaseSelector(output, begin, end, step, at, reps, subPops, infoFields),
-		m_selDist(selDist), m_mode(mode), m_selFactory(), m_additive(true)
+		m_selDist(selDist), m_mode(mode), m_selCoefs(), m_additive(true)
 	{
 		if (m_selDist.size() == 0) {
 			DBG_FAILIF(!m_selDist.func().isValid(), ValueError,
@@ -664,8 +666,56 @@ public:
 	typedef std::pair<double, double> SelCoef;
 
 private:
+	/** A flat hash table that maps mutant locations to their selection
+	 *  coefficients. Locations and coefficients are stored in two contiguous
+	 *  arrays with linear probing so that a lookup does not allocate or
+	 *  modify the table and can be done from multiple threads.
+	 */
+	class SelCoefTable
+	{
+	public:
+		SelCoefTable() : m_locs(16, 0), m_coefs(16), m_size(0)
+		{
+		}
+
+
+		/// return selection coefficient of mutant \e loc, or \c NULL
+		const SelCoef * find(size_t loc) const
+		{
+			size_t mask = m_locs.size() - 1;
+
+			for (size_t i = slot(loc, mask); m_locs[i] != 0; i = (i + 1) & mask)
+				if (m_locs[i] == loc)
+					return &m_coefs[i];
+			return NULL;
+		}
+
+
+		/// add selection coefficient of a mutant that is not in the table
+		void insert(size_t loc, const SelCoef & sc);
+
+	private:
+		static size_t slot(size_t loc, size_t mask)
+		{
+			size_t h = loc ^ (loc >> 16);
+
+			h *= 0x45d9f3bU;
+			return (h ^ (h >> 16)) & mask;
+		}
+
+
+		/// location 0 (wildtype allele) marks an empty slot
+		vectoru m_locs;
+
+		vector<SelCoef> m_coefs;
+
+		size_t m_size;
+	};
+
 	SelCoef getFitnessValue(size_t mutant) const;
 
+	/// assign selection coefficients to mutants that do not have one
+	void assignSelCoef(GenoIterator it, GenoIterator it_end) const;
 
 	double randomSelAddFitness(GenoIterator it, GenoIterator it_end, bool maleChrX) const;
 
@@ -678,25 +728,18 @@ private:
 
 	double randomSelExpFitnessExt(GenoIterator it, GenoIterator it_end, bool maleChrX) const;
 
+	/** collect and sort non-wildtype alleles in <tt>[it, it_end)</tt> so
+	 *  that copies of the same mutant are adjacent.
+	 */
+	void sortedMutants(GenoIterator it, GenoIterator it_end, vectoru & mutants) const;
+
 private:
 	///
 	floatListFunc m_selDist;
 
 	int m_mode;
 	///
-#  if TR1_SUPPORT == 0
-	typedef std::map<unsigned int, SelCoef> SelMap;
-	typedef std::map<unsigned int, int> MutCounter;
-#  elif TR1_SUPPORT == 1
-	// this is faster than std::map
-	typedef std::unordered_map<size_t, SelCoef> SelMap;
-	typedef std::unordered_map<size_t, size_t> MutCounter;
-#  else
-	// this is faster than std::map
-	typedef std::tr1::unordered_map<size_t, SelCoef> SelMap;
-	typedef std::tr1::unordered_map<size_t, size_t> MutCounter;
-#  endif
-	mutable SelMap m_selFactory;
+	mutable SelCoefTable m_selCoefs;
 	mutable vectoru m_newMutants;
 	// whether or not all markers are additive.
 	mutable bool m_additive;
@@ -3029,200 +3029,202 @@ SWIG_Python_NonDynamicSetAttr(PyObject *obj, PyObject *name, PyObject *value) {
 #define SWIGTYPE_p_second_type swig_types[19]
 #define SWIGTYPE_p_short swig_types[20]
 #define SWIGTYPE_p_signed_char swig_types[21]
-#define SWIGTYPE_p_simuPOP__AffectionSplitter swig_types[22]
-#define SWIGTYPE_p_simuPOP__BackwardMigrator swig_types[23]
-#define SWIGTYPE_p_simuPOP__BaseMutator swig_types[24]
-#define SWIGTYPE_p_simuPOP__BaseOperator swig_types[25]
-#define SWIGTYPE_p_simuPOP__BasePenetrance swig_types[26]
-#define SWIGTYPE_p_simuPOP__BaseQuanTrait swig_types[27]
-#define SWIGTYPE_p_simuPOP__BaseSelector swig_types[28]
-#define SWIGTYPE_p_simuPOP__BaseVspSplitter swig_types[29]
-#define SWIGTYPE_p_simuPOP__Bernullitrials swig_types[30]
-#define SWIGTYPE_p_simuPOP__Bernullitrials_T swig_types[31]
-#define SWIGTYPE_p_simuPOP__BinomialNumOffModel swig_types[32]
-#define SWIGTYPE_p_simuPOP__CloneGenoTransmitter swig_types[33]
-#define SWIGTYPE_p_simuPOP__CombinedAlleleIteratorT_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_iterator_std__vectorT_bool_std__allocatorT_bool_t_t__const_iterator_std__vectorT_bool_std__allocatorT_bool_t_t__const_reference_t swig_types[34]
-#define SWIGTYPE_p_simuPOP__CombinedParentsChooser swig_types[35]
-#define SWIGTYPE_p_simuPOP__CombinedSplitter swig_types[36]
-#define SWIGTYPE_p_simuPOP__ConditionalMating swig_types[37]
-#define SWIGTYPE_p_simuPOP__ConstNumOffModel swig_types[38]
-#define SWIGTYPE_p_simuPOP__ContextMutator swig_types[39]
-#define SWIGTYPE_p_simuPOP__ControlledOffspringGenerator swig_types[40]
-#define SWIGTYPE_p_simuPOP__DiscardIf swig_types[41]
-#define SWIGTYPE_p_simuPOP__Dumper swig_types[42]
-#define SWIGTYPE_p_simuPOP__Exception swig_types[43]
-#define SWIGTYPE_p_simuPOP__FiniteSitesMutator swig_types[44]
-#define SWIGTYPE_p_simuPOP__FuncNumOffModel swig_types[45]
-#define SWIGTYPE_p_simuPOP__FuncSexModel swig_types[46]
-#define SWIGTYPE_p_simuPOP__GenoStruTrait swig_types[47]
-#define SWIGTYPE_p_simuPOP__GenoTransmitter swig_types[48]
-#define SWIGTYPE_p_simuPOP__GenotypeSplitter swig_types[49]
-#define SWIGTYPE_p_simuPOP__GeometricNumOffModel swig_types[50]
-#define SWIGTYPE_p_simuPOP__GlobalSeqSexModel swig_types[51]
-#define SWIGTYPE_p_simuPOP__HaplodiploidGenoTransmitter swig_types[52]
-#define SWIGTYPE_p_simuPOP__HeteroMating swig_types[53]
-#define SWIGTYPE_p_simuPOP__HomoMating swig_types[54]
-#define SWIGTYPE_p_simuPOP__IdTagger swig_types[55]
-#define SWIGTYPE_p_simuPOP__IfElse swig_types[56]
-#define SWIGTYPE_p_simuPOP__IndexError swig_types[57]
-#define SWIGTYPE_p_simuPOP__Individual swig_types[58]
-#define SWIGTYPE_p_simuPOP__IndividualIteratorT_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_iterator_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_pointer_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_reference_t swig_types[59]
-#define SWIGTYPE_p_simuPOP__IndividualIteratorT_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__iterator_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__pointer_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__reference_t swig_types[60]
-#define SWIGTYPE_p_simuPOP__InfoEval swig_types[61]
-#define SWIGTYPE_p_simuPOP__InfoExec swig_types[62]
-#define SWIGTYPE_p_simuPOP__InfoSplitter swig_types[63]
-#define SWIGTYPE_p_simuPOP__InformationIteratorT_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_iterator_t swig_types[64]
-#define SWIGTYPE_p_simuPOP__InformationIteratorT_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__iterator_t swig_types[65]
-#define SWIGTYPE_p_simuPOP__InheritTagger swig_types[66]
-#define SWIGTYPE_p_simuPOP__InitGenotype swig_types[67]
-#define SWIGTYPE_p_simuPOP__InitInfo swig_types[68]
-#define SWIGTYPE_p_simuPOP__InitLineage swig_types[69]
-#define SWIGTYPE_p_simuPOP__InitSex swig_types[70]
-#define SWIGTYPE_p_simuPOP__KAlleleMutator swig_types[71]
-#define SWIGTYPE_p_simuPOP__MaPenetrance swig_types[72]
-#define SWIGTYPE_p_simuPOP__MaSelector swig_types[73]
-#define SWIGTYPE_p_simuPOP__MapPenetrance swig_types[74]
-#define SWIGTYPE_p_simuPOP__MapSelector swig_types[75]
-#define SWIGTYPE_p_simuPOP__MatingScheme swig_types[76]
-#define SWIGTYPE_p_simuPOP__MatrixMutator swig_types[77]
-#define SWIGTYPE_p_simuPOP__MendelianGenoTransmitter swig_types[78]
-#define SWIGTYPE_p_simuPOP__MergeSubPops swig_types[79]
-#define SWIGTYPE_p_simuPOP__Migrator swig_types[80]
-#define SWIGTYPE_p_simuPOP__MitochondrialGenoTransmitter swig_types[81]
-#define SWIGTYPE_p_simuPOP__MixedMutator swig_types[82]
-#define SWIGTYPE_p_simuPOP__MlPenetrance swig_types[83]
-#define SWIGTYPE_p_simuPOP__MlSelector swig_types[84]
-#define SWIGTYPE_p_simuPOP__NoSexModel swig_types[85]
-#define SWIGTYPE_p_simuPOP__NoneOp swig_types[86]
-#define SWIGTYPE_p_simuPOP__NumOfFemalesSexModel swig_types[87]
-#define SWIGTYPE_p_simuPOP__NumOfMalesSexModel swig_types[88]
-#define SWIGTYPE_p_simuPOP__NumOffModel swig_types[89]
-#define SWIGTYPE_p_simuPOP__OffspringGenerator swig_types[90]
-#define SWIGTYPE_p_simuPOP__OffspringTagger swig_types[91]
-#define SWIGTYPE_p_simuPOP__ParentChooser swig_types[92]
-#define SWIGTYPE_p_simuPOP__ParentsTagger swig_types[93]
-#define SWIGTYPE_p_simuPOP__Pause swig_types[94]
-#define SWIGTYPE_p_simuPOP__Pedigree swig_types[95]
-#define SWIGTYPE_p_simuPOP__PedigreeMating swig_types[96]
-#define SWIGTYPE_p_simuPOP__PedigreeTagger swig_types[97]
-#define SWIGTYPE_p_simuPOP__PointMutator swig_types[98]
-#define SWIGTYPE_p_simuPOP__PoissonNumOffModel swig_types[99]
-#define SWIGTYPE_p_simuPOP__PolyParentsChooser swig_types[100]
-#define SWIGTYPE_p_simuPOP__Population swig_types[101]
-#define SWIGTYPE_p_simuPOP__ProbOfMalesSexModel swig_types[102]
-#define SWIGTYPE_p_simuPOP__ProductSplitter swig_types[103]
-#define SWIGTYPE_p_simuPOP__ProportionSplitter swig_types[104]
-#define SWIGTYPE_p_simuPOP__PyEval swig_types[105]
-#define SWIGTYPE_p_simuPOP__PyExec swig_types[106]
-#define SWIGTYPE_p_simuPOP__PyMlPenetrance swig_types[107]
-#define SWIGTYPE_p_simuPOP__PyMlSelector swig_types[108]
-#define SWIGTYPE_p_simuPOP__PyMutator swig_types[109]
-#define SWIGTYPE_p_simuPOP__PyOperator swig_types[110]
-#define SWIGTYPE_p_simuPOP__PyOutput swig_types[111]
-#define SWIGTYPE_p_simuPOP__PyParentsChooser swig_types[112]
-#define SWIGTYPE_p_simuPOP__PyPenetrance swig_types[113]
-#define SWIGTYPE_p_simuPOP__PyQuanTrait swig_types[114]
-#define SWIGTYPE_p_simuPOP__PySelector swig_types[115]
-#define SWIGTYPE_p_simuPOP__PyTagger swig_types[116]
-#define SWIGTYPE_p_simuPOP__RNG swig_types[117]
-#define SWIGTYPE_p_simuPOP__RNG_func swig_types[118]
-#define SWIGTYPE_p_simuPOP__RandomParentChooser swig_types[119]
-#define SWIGTYPE_p_simuPOP__RandomParentsChooser swig_types[120]
-#define SWIGTYPE_p_simuPOP__RandomSexModel swig_types[121]
-#define SWIGTYPE_p_simuPOP__RangeSplitter swig_types[122]
-#define SWIGTYPE_p_simuPOP__Recombinator swig_types[123]
-#define SWIGTYPE_p_simuPOP__ResizeSubPops swig_types[124]
-#define SWIGTYPE_p_simuPOP__RevertEvolution swig_types[125]
-#define SWIGTYPE_p_simuPOP__RevertFixedSites swig_types[126]
-#define SWIGTYPE_p_simuPOP__RevertIf swig_types[127]
-#define SWIGTYPE_p_simuPOP__RuntimeError swig_types[128]
-#define SWIGTYPE_p_simuPOP__SavePopulation swig_types[129]
-#define SWIGTYPE_p_simuPOP__SelfingGenoTransmitter swig_types[130]
-#define SWIGTYPE_p_simuPOP__SeqSexModel swig_types[131]
-#define SWIGTYPE_p_simuPOP__SequentialParentChooser swig_types[132]
-#define SWIGTYPE_p_simuPOP__SexModel swig_types[133]
-#define SWIGTYPE_p_simuPOP__SexSplitter swig_types[134]
-#define SWIGTYPE_p_simuPOP__Simulator swig_types[135]
-#define SWIGTYPE_p_simuPOP__SplitSubPops swig_types[136]
-#define SWIGTYPE_p_simuPOP__Stat swig_types[137]
-#define SWIGTYPE_p_simuPOP__StepwiseMutator swig_types[138]
-#define SWIGTYPE_p_simuPOP__StopEvolution swig_types[139]
-#define SWIGTYPE_p_simuPOP__StopIteration swig_types[140]
-#define SWIGTYPE_p_simuPOP__SummaryTagger swig_types[141]
-#define SWIGTYPE_p_simuPOP__SystemError swig_types[142]
-#define SWIGTYPE_p_simuPOP__TerminateIf swig_types[143]
-#define SWIGTYPE_p_simuPOP__TicToc swig_types[144]
-#define SWIGTYPE_p_simuPOP__UniformNumOffModel swig_types[145]
-#define SWIGTYPE_p_simuPOP__ValueError swig_types[146]
-#define SWIGTYPE_p_simuPOP__WeightedSampler swig_types[147]
-#define SWIGTYPE_p_simuPOP__floatList swig_types[148]
-#define SWIGTYPE_p_simuPOP__floatListFunc swig_types[149]
-#define SWIGTYPE_p_simuPOP__floatMatrix swig_types[150]
-#define SWIGTYPE_p_simuPOP__intList swig_types[151]
-#define SWIGTYPE_p_simuPOP__intMatrix swig_types[152]
-#define SWIGTYPE_p_simuPOP__lociList swig_types[153]
-#define SWIGTYPE_p_simuPOP__opList swig_types[154]
-#define SWIGTYPE_p_simuPOP__pyIndIterator swig_types[155]
-#define SWIGTYPE_p_simuPOP__pyMutantIterator swig_types[156]
-#define SWIGTYPE_p_simuPOP__pyPopIterator swig_types[157]
-#define SWIGTYPE_p_simuPOP__stringFunc swig_types[158]
-#define SWIGTYPE_p_simuPOP__stringList swig_types[159]
-#define SWIGTYPE_p_simuPOP__stringMatrix swig_types[160]
-#define SWIGTYPE_p_simuPOP__subPopList swig_types[161]
-#define SWIGTYPE_p_simuPOP__uintList swig_types[162]
-#define SWIGTYPE_p_simuPOP__uintListFunc swig_types[163]
-#define SWIGTYPE_p_simuPOP__uintString swig_types[164]
-#define SWIGTYPE_p_simuPOP__vspFunctor swig_types[165]
-#define SWIGTYPE_p_simuPOP__vspID swig_types[166]
-#define SWIGTYPE_p_size_t swig_types[167]
-#define SWIGTYPE_p_size_type swig_types[168]
-#define SWIGTYPE_p_std__invalid_argument swig_types[169]
-#define SWIGTYPE_p_std__mapT_int_double_std__lessT_int_t_std__allocatorT_std__pairT_int_const_double_t_t_t swig_types[170]
-#define SWIGTYPE_p_std__mapT_size_t_double_std__lessT_size_t_t_std__allocatorT_std__pairT_size_t_const_double_t_t_t swig_types[171]
-#define SWIGTYPE_p_std__mapT_std__string_double_std__lessT_std__string_t_std__allocatorT_std__pairT_std__string_const_double_t_t_t swig_types[172]
-#define SWIGTYPE_p_std__mapT_std__vectorT_long_std__allocatorT_long_t_t_double_std__lessT_std__vectorT_long_t_t_std__allocatorT_std__pairT_std__vectorT_long_std__allocatorT_long_t_t_const_double_t_t_t swig_types[173]
-#define SWIGTYPE_p_std__pairT_size_t_size_t_t swig_types[174]
-#define SWIGTYPE_p_std__pairT_std__string_double_t swig_types[175]
-#define SWIGTYPE_p_std__string swig_types[176]
-#define SWIGTYPE_p_std__vectorT_bool_std__allocatorT_bool_t_t swig_types[177]
-#define SWIGTYPE_p_std__vectorT_bool_std__allocatorT_bool_t_t__const_iterator swig_types[178]
-#define SWIGTYPE_p_std__vectorT_bool_std__allocatorT_bool_t_t__iterator swig_types[179]
-#define SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t swig_types[180]
-#define SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t__const_iterator swig_types[181]
-#define SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t__iterator swig_types[182]
-#define SWIGTYPE_p_std__vectorT_long_std__allocatorT_long_t_t swig_types[183]
-#define SWIGTYPE_p_std__vectorT_long_std__allocatorT_long_t_t__const_iterator swig_types[184]
-#define SWIGTYPE_p_std__vectorT_long_std__allocatorT_long_t_t__iterator swig_types[185]
-#define SWIGTYPE_p_std__vectorT_simuPOP__BaseOperator_p_std__allocatorT_simuPOP__BaseOperator_p_t_t swig_types[186]
-#define SWIGTYPE_p_std__vectorT_simuPOP__BaseVspSplitter_p_std__allocatorT_simuPOP__BaseVspSplitter_p_t_t swig_types[187]
-#define SWIGTYPE_p_std__vectorT_simuPOP__HomoMating_p_std__allocatorT_simuPOP__HomoMating_p_t_t swig_types[188]
-#define SWIGTYPE_p_std__vectorT_size_t_std__allocatorT_size_t_t_t swig_types[189]
-#define SWIGTYPE_p_std__vectorT_std__pairT_size_t_size_t_t_std__allocatorT_std__pairT_size_t_size_t_t_t_t swig_types[190]
-#define SWIGTYPE_p_std__vectorT_std__pairT_std__string_double_t_std__allocatorT_std__pairT_std__string_double_t_t_t swig_types[191]
-#define SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t swig_types[192]
-#define SWIGTYPE_p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t swig_types[193]
-#define SWIGTYPE_p_std__vectorT_std__vectorT_long_std__allocatorT_long_t_t_std__allocatorT_std__vectorT_long_std__allocatorT_long_t_t_t_t swig_types[194]
-#define SWIGTYPE_p_std__vectorT_std__vectorT_std__string_std__allocatorT_std__string_t_t_std__allocatorT_std__vectorT_std__string_std__allocatorT_std__string_t_t_t_t swig_types[195]
-#define SWIGTYPE_p_swig__SwigPyIterator swig_types[196]
-#define SWIGTYPE_p_unsigned_char swig_types[197]
-#define SWIGTYPE_p_unsigned_int swig_types[198]
-#define SWIGTYPE_p_unsigned_long swig_types[199]
-#define SWIGTYPE_p_unsigned_long_long swig_types[200]
-#define SWIGTYPE_p_unsigned_short swig_types[201]
-#define SWIGTYPE_p_value_type swig_types[202]
-#define SWIGTYPE_p_vectorT_bool_std__allocatorT_bool_t_t swig_types[203]
-#define SWIGTYPE_p_vectorT_bool_std__allocatorT_bool_t_t__const_reference swig_types[204]
-#define SWIGTYPE_p_vectorT_bool_std__allocatorT_bool_t_t__reference swig_types[205]
-#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_iterator swig_types[206]
-#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_pointer swig_types[207]
-#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_reference swig_types[208]
-#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__iterator swig_types[209]
-#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__pointer swig_types[210]
-#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__reference swig_types[211]
-#define SWIGTYPE_p_vectorT_simuPOP__Population_p_std__allocatorT_simuPOP__Population_p_t_t__iterator swig_types[212]
-#define SWIGTYPE_p_vectorvsp swig_types[213]
-static swig_type_info *swig_types[215];
-static swig_module_info swig_module = {swig_types, 214, 0, 0, 0, 0};
+#define SWIGTYPE_p_simuPOP__AdditiveQuanTrait swig_types[22]
+#define SWIGTYPE_p_simuPOP__AffectionSplitter swig_types[23]
+#define SWIGTYPE_p_simuPOP__BackwardMigrator swig_types[24]
+#define SWIGTYPE_p_simuPOP__BaseMutator swig_types[25]
+#define SWIGTYPE_p_simuPOP__BaseOperator swig_types[26]
+#define SWIGTYPE_p_simuPOP__BasePenetrance swig_types[27]
+#define SWIGTYPE_p_simuPOP__BaseQuanTrait swig_types[28]
+#define SWIGTYPE_p_simuPOP__BaseSelector swig_types[29]
+#define SWIGTYPE_p_simuPOP__BaseVspSplitter swig_types[30]
+#define SWIGTYPE_p_simuPOP__Bernullitrials swig_types[31]
+#define SWIGTYPE_p_simuPOP__Bernullitrials_T swig_types[32]
+#define SWIGTYPE_p_simuPOP__BinomialNumOffModel swig_types[33]
+#define SWIGTYPE_p_simuPOP__CloneGenoTransmitter swig_types[34]
+#define SWIGTYPE_p_simuPOP__CombinedAlleleIteratorT_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_iterator_std__vectorT_bool_std__allocatorT_bool_t_t__const_iterator_std__vectorT_bool_std__allocatorT_bool_t_t__const_reference_t swig_types[35]
+#define SWIGTYPE_p_simuPOP__CombinedParentsChooser swig_types[36]
+#define SWIGTYPE_p_simuPOP__CombinedSplitter swig_types[37]
+#define SWIGTYPE_p_simuPOP__ConditionalMating swig_types[38]
+#define SWIGTYPE_p_simuPOP__ConstNumOffModel swig_types[39]
+#define SWIGTYPE_p_simuPOP__ContextMutator swig_types[40]
+#define SWIGTYPE_p_simuPOP__ControlledOffspringGenerator swig_types[41]
+#define SWIGTYPE_p_simuPOP__DiscardIf swig_types[42]
+#define SWIGTYPE_p_simuPOP__Dumper swig_types[43]
+#define SWIGTYPE_p_simuPOP__Exception swig_types[44]
+#define SWIGTYPE_p_simuPOP__FiniteSitesMutator swig_types[45]
+#define SWIGTYPE_p_simuPOP__FuncNumOffModel swig_types[46]
+#define SWIGTYPE_p_simuPOP__FuncSexModel swig_types[47]
+#define SWIGTYPE_p_simuPOP__Genealogy swig_types[48]
+#define SWIGTYPE_p_simuPOP__GenoStruTrait swig_types[49]
+#define SWIGTYPE_p_simuPOP__GenoTransmitter swig_types[50]
+#define SWIGTYPE_p_simuPOP__GenotypeSplitter swig_types[51]
+#define SWIGTYPE_p_simuPOP__GeometricNumOffModel swig_types[52]
+#define SWIGTYPE_p_simuPOP__GlobalSeqSexModel swig_types[53]
+#define SWIGTYPE_p_simuPOP__HaplodiploidGenoTransmitter swig_types[54]
+#define SWIGTYPE_p_simuPOP__HeteroMating swig_types[55]
+#define SWIGTYPE_p_simuPOP__HomoMating swig_types[56]
+#define SWIGTYPE_p_simuPOP__IdTagger swig_types[57]
+#define SWIGTYPE_p_simuPOP__IfElse swig_types[58]
+#define SWIGTYPE_p_simuPOP__IndexError swig_types[59]
+#define SWIGTYPE_p_simuPOP__Individual swig_types[60]
+#define SWIGTYPE_p_simuPOP__IndividualIteratorT_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_iterator_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_pointer_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_reference_t swig_types[61]
+#define SWIGTYPE_p_simuPOP__IndividualIteratorT_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__iterator_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__pointer_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__reference_t swig_types[62]
+#define SWIGTYPE_p_simuPOP__InfoEval swig_types[63]
+#define SWIGTYPE_p_simuPOP__InfoExec swig_types[64]
+#define SWIGTYPE_p_simuPOP__InfoSplitter swig_types[65]
+#define SWIGTYPE_p_simuPOP__InformationIteratorT_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_iterator_t swig_types[66]
+#define SWIGTYPE_p_simuPOP__InformationIteratorT_std__vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__iterator_t swig_types[67]
+#define SWIGTYPE_p_simuPOP__InheritTagger swig_types[68]
+#define SWIGTYPE_p_simuPOP__InitGenotype swig_types[69]
+#define SWIGTYPE_p_simuPOP__InitInfo swig_types[70]
+#define SWIGTYPE_p_simuPOP__InitLineage swig_types[71]
+#define SWIGTYPE_p_simuPOP__InitSex swig_types[72]
+#define SWIGTYPE_p_simuPOP__KAlleleMutator swig_types[73]
+#define SWIGTYPE_p_simuPOP__MaPenetrance swig_types[74]
+#define SWIGTYPE_p_simuPOP__MaSelector swig_types[75]
+#define SWIGTYPE_p_simuPOP__MapPenetrance swig_types[76]
+#define SWIGTYPE_p_simuPOP__MapSelector swig_types[77]
+#define SWIGTYPE_p_simuPOP__MatingScheme swig_types[78]
+#define SWIGTYPE_p_simuPOP__MatrixMutator swig_types[79]
+#define SWIGTYPE_p_simuPOP__MendelianGenoTransmitter swig_types[80]
+#define SWIGTYPE_p_simuPOP__MergeSubPops swig_types[81]
+#define SWIGTYPE_p_simuPOP__Migrator swig_types[82]
+#define SWIGTYPE_p_simuPOP__MitochondrialGenoTransmitter swig_types[83]
+#define SWIGTYPE_p_simuPOP__MixedMutator swig_types[84]
+#define SWIGTYPE_p_simuPOP__MlPenetrance swig_types[85]
+#define SWIGTYPE_p_simuPOP__MlSelector swig_types[86]
+#define SWIGTYPE_p_simuPOP__NoSexModel swig_types[87]
+#define SWIGTYPE_p_simuPOP__NoneOp swig_types[88]
+#define SWIGTYPE_p_simuPOP__NumOfFemalesSexModel swig_types[89]
+#define SWIGTYPE_p_simuPOP__NumOfMalesSexModel swig_types[90]
+#define SWIGTYPE_p_simuPOP__NumOffModel swig_types[91]
+#define SWIGTYPE_p_simuPOP__OffspringGenerator swig_types[92]
+#define SWIGTYPE_p_simuPOP__OffspringTagger swig_types[93]
+#define SWIGTYPE_p_simuPOP__ParentChooser swig_types[94]
+#define SWIGTYPE_p_simuPOP__ParentsTagger swig_types[95]
+#define SWIGTYPE_p_simuPOP__Pause swig_types[96]
+#define SWIGTYPE_p_simuPOP__Pedigree swig_types[97]
+#define SWIGTYPE_p_simuPOP__PedigreeMating swig_types[98]
+#define SWIGTYPE_p_simuPOP__PedigreeTagger swig_types[99]
+#define SWIGTYPE_p_simuPOP__PointMutator swig_types[100]
+#define SWIGTYPE_p_simuPOP__PoissonNumOffModel swig_types[101]
+#define SWIGTYPE_p_simuPOP__PolyParentsChooser swig_types[102]
+#define SWIGTYPE_p_simuPOP__Population swig_types[103]
+#define SWIGTYPE_p_simuPOP__ProbOfMalesSexModel swig_types[104]
+#define SWIGTYPE_p_simuPOP__ProductSplitter swig_types[105]
+#define SWIGTYPE_p_simuPOP__ProportionSplitter swig_types[106]
+#define SWIGTYPE_p_simuPOP__PyEval swig_types[107]
+#define SWIGTYPE_p_simuPOP__PyExec swig_types[108]
+#define SWIGTYPE_p_simuPOP__PyMlPenetrance swig_types[109]
+#define SWIGTYPE_p_simuPOP__PyMlSelector swig_types[110]
+#define SWIGTYPE_p_simuPOP__PyMutator swig_types[111]
+#define SWIGTYPE_p_simuPOP__PyOperator swig_types[112]
+#define SWIGTYPE_p_simuPOP__PyOutput swig_types[113]
+#define SWIGTYPE_p_simuPOP__PyParentsChooser swig_types[114]
+#define SWIGTYPE_p_simuPOP__PyPenetrance swig_types[115]
+#define SWIGTYPE_p_simuPOP__PyQuanTrait swig_types[116]
+#define SWIGTYPE_p_simuPOP__PySelector swig_types[117]
+#define SWIGTYPE_p_simuPOP__PyTagger swig_types[118]
+#define SWIGTYPE_p_simuPOP__RNG swig_types[119]
+#define SWIGTYPE_p_simuPOP__RNG_func swig_types[120]
+#define SWIGTYPE_p_simuPOP__RandomParentChooser swig_types[121]
+#define SWIGTYPE_p_simuPOP__RandomParentsChooser swig_types[122]
+#define SWIGTYPE_p_simuPOP__RandomSexModel swig_types[123]
+#define SWIGTYPE_p_simuPOP__RangeSplitter swig_types[124]
+#define SWIGTYPE_p_simuPOP__Recombinator swig_types[125]
+#define SWIGTYPE_p_simuPOP__ResizeSubPops swig_types[126]
+#define SWIGTYPE_p_simuPOP__RevertEvolution swig_types[127]
+#define SWIGTYPE_p_simuPOP__RevertFixedSites swig_types[128]
+#define SWIGTYPE_p_simuPOP__RevertIf swig_types[129]
+#define SWIGTYPE_p_simuPOP__RuntimeError swig_types[130]
+#define SWIGTYPE_p_simuPOP__SavePopulation swig_types[131]
+#define SWIGTYPE_p_simuPOP__SelfingGenoTransmitter swig_types[132]
+#define SWIGTYPE_p_simuPOP__SeqSexModel swig_types[133]
+#define SWIGTYPE_p_simuPOP__SequentialParentChooser swig_types[134]
+#define SWIGTYPE_p_simuPOP__SexModel swig_types[135]
+#define SWIGTYPE_p_simuPOP__SexSplitter swig_types[136]
+#define SWIGTYPE_p_simuPOP__Simulator swig_types[137]
+#define SWIGTYPE_p_simuPOP__SplitSubPops swig_types[138]
+#define SWIGTYPE_p_simuPOP__Stat swig_types[139]
+#define SWIGTYPE_p_simuPOP__StepwiseMutator swig_types[140]
+#define SWIGTYPE_p_simuPOP__StopEvolution swig_types[141]
+#define SWIGTYPE_p_simuPOP__StopIteration swig_types[142]
+#define SWIGTYPE_p_simuPOP__SummaryTagger swig_types[143]
+#define SWIGTYPE_p_simuPOP__SystemError swig_types[144]
+#define SWIGTYPE_p_simuPOP__TerminateIf swig_types[145]
+#define SWIGTYPE_p_simuPOP__TicToc swig_types[146]
+#define SWIGTYPE_p_simuPOP__UniformNumOffModel swig_types[147]
+#define SWIGTYPE_p_simuPOP__ValueError swig_types[148]
+#define SWIGTYPE_p_simuPOP__WeightedSampler swig_types[149]
+#define SWIGTYPE_p_simuPOP__floatList swig_types[150]
+#define SWIGTYPE_p_simuPOP__floatListFunc swig_types[151]
+#define SWIGTYPE_p_simuPOP__floatMatrix swig_types[152]
+#define SWIGTYPE_p_simuPOP__intList swig_types[153]
+#define SWIGTYPE_p_simuPOP__intMatrix swig_types[154]
+#define SWIGTYPE_p_simuPOP__lociList swig_types[155]
+#define SWIGTYPE_p_simuPOP__opList swig_types[156]
+#define SWIGTYPE_p_simuPOP__pyIndIterator swig_types[157]
+#define SWIGTYPE_p_simuPOP__pyMutantIterator swig_types[158]
+#define SWIGTYPE_p_simuPOP__pyPopIterator swig_types[159]
+#define SWIGTYPE_p_simuPOP__stringFunc swig_types[160]
+#define SWIGTYPE_p_simuPOP__stringList swig_types[161]
+#define SWIGTYPE_p_simuPOP__stringMatrix swig_types[162]
+#define SWIGTYPE_p_simuPOP__subPopList swig_types[163]
+#define SWIGTYPE_p_simuPOP__uintList swig_types[164]
+#define SWIGTYPE_p_simuPOP__uintListFunc swig_types[165]
+#define SWIGTYPE_p_simuPOP__uintString swig_types[166]
+#define SWIGTYPE_p_simuPOP__vspFunctor swig_types[167]
+#define SWIGTYPE_p_simuPOP__vspID swig_types[168]
+#define SWIGTYPE_p_size_t swig_types[169]
+#define SWIGTYPE_p_size_type swig_types[170]
+#define SWIGTYPE_p_std__invalid_argument swig_types[171]
+#define SWIGTYPE_p_std__mapT_int_double_std__lessT_int_t_std__allocatorT_std__pairT_int_const_double_t_t_t swig_types[172]
+#define SWIGTYPE_p_std__mapT_size_t_double_std__lessT_size_t_t_std__allocatorT_std__pairT_size_t_const_double_t_t_t swig_types[173]
+#define SWIGTYPE_p_std__mapT_std__string_double_std__lessT_std__string_t_std__allocatorT_std__pairT_std__string_const_double_t_t_t swig_types[174]
+#define SWIGTYPE_p_std__mapT_std__vectorT_long_std__allocatorT_long_t_t_double_std__lessT_std__vectorT_long_t_t_std__allocatorT_std__pairT_std__vectorT_long_std__allocatorT_long_t_t_const_double_t_t_t swig_types[175]
+#define SWIGTYPE_p_std__pairT_size_t_size_t_t swig_types[176]
+#define SWIGTYPE_p_std__pairT_std__string_double_t swig_types[177]
+#define SWIGTYPE_p_std__string swig_types[178]
+#define SWIGTYPE_p_std__vectorT_bool_std__allocatorT_bool_t_t swig_types[179]
+#define SWIGTYPE_p_std__vectorT_bool_std__allocatorT_bool_t_t__const_iterator swig_types[180]
+#define SWIGTYPE_p_std__vectorT_bool_std__allocatorT_bool_t_t__iterator swig_types[181]
+#define SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t swig_types[182]
+#define SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t__const_iterator swig_types[183]
+#define SWIGTYPE_p_std__vectorT_double_std__allocatorT_double_t_t__iterator swig_types[184]
+#define SWIGTYPE_p_std__vectorT_long_std__allocatorT_long_t_t swig_types[185]
+#define SWIGTYPE_p_std__vectorT_long_std__allocatorT_long_t_t__const_iterator swig_types[186]
+#define SWIGTYPE_p_std__vectorT_long_std__allocatorT_long_t_t__iterator swig_types[187]
+#define SWIGTYPE_p_std__vectorT_simuPOP__BaseOperator_p_std__allocatorT_simuPOP__BaseOperator_p_t_t swig_types[188]
+#define SWIGTYPE_p_std__vectorT_simuPOP__BaseVspSplitter_p_std__allocatorT_simuPOP__BaseVspSplitter_p_t_t swig_types[189]
+#define SWIGTYPE_p_std__vectorT_simuPOP__HomoMating_p_std__allocatorT_simuPOP__HomoMating_p_t_t swig_types[190]
+#define SWIGTYPE_p_std__vectorT_size_t_std__allocatorT_size_t_t_t swig_types[191]
+#define SWIGTYPE_p_std__vectorT_std__pairT_size_t_size_t_t_std__allocatorT_std__pairT_size_t_size_t_t_t_t swig_types[192]
+#define SWIGTYPE_p_std__vectorT_std__pairT_std__string_double_t_std__allocatorT_std__pairT_std__string_double_t_t_t swig_types[193]
+#define SWIGTYPE_p_std__vectorT_std__string_std__allocatorT_std__string_t_t swig_types[194]
+#define SWIGTYPE_p_std__vectorT_std__vectorT_double_std__allocatorT_double_t_t_std__allocatorT_std__vectorT_double_std__allocatorT_double_t_t_t_t swig_types[195]
+#define SWIGTYPE_p_std__vectorT_std__vectorT_long_std__allocatorT_long_t_t_std__allocatorT_std__vectorT_long_std__allocatorT_long_t_t_t_t swig_types[196]
+#define SWIGTYPE_p_std__vectorT_std__vectorT_std__string_std__allocatorT_std__string_t_t_std__allocatorT_std__vectorT_std__string_std__allocatorT_std__string_t_t_t_t swig_types[197]
+#define SWIGTYPE_p_swig__SwigPyIterator swig_types[198]
+#define SWIGTYPE_p_unsigned_char swig_types[199]
+#define SWIGTYPE_p_unsigned_int swig_types[200]
+#define SWIGTYPE_p_unsigned_long swig_types[201]
+#define SWIGTYPE_p_unsigned_long_long swig_types[202]
+#define SWIGTYPE_p_unsigned_short swig_types[203]
+#define SWIGTYPE_p_value_type swig_types[204]
+#define SWIGTYPE_p_vectorT_bool_std__allocatorT_bool_t_t swig_types[205]
+#define SWIGTYPE_p_vectorT_bool_std__allocatorT_bool_t_t__const_reference swig_types[206]
+#define SWIGTYPE_p_vectorT_bool_std__allocatorT_bool_t_t__reference swig_types[207]
+#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_iterator swig_types[208]
+#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_pointer swig_types[209]
+#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__const_reference swig_types[210]
+#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__iterator swig_types[211]
+#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__pointer swig_types[212]
+#define SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__reference swig_types[213]
+#define SWIGTYPE_p_vectorT_simuPOP__Population_p_std__allocatorT_simuPOP__Population_p_t_t__iterator swig_types[214]
+#define SWIGTYPE_p_vectorvsp swig_types[215]
+static swig_type_info *swig_types[217];
+static swig_module_info swig_module = {swig_types, 216, 0, 0, 0, 0};
 #define SWIG_TypeQuery(name) SWIG_TypeQueryModule(&swig_module, &swig_module, name)
 #define SWIG_MangledTypeQuery(name) SWIG_MangledTypeQueryModule(&swig_module, &swig_module, name)
 
@@ -7729,6 +7731,7 @@ SWIGINTERN PyObject *_wrap_setOptions(PyObject *SWIGUNUSEDPARM(self), PyObject *
   int arg1 = (int) (int)-1 ;
   char *arg2 = (char *) NULL ;
   unsigned long arg3 = (unsigned long) 0 ;
+  int arg4 = (int) (int)-1 ;
   int val1 ;
   int ecode1 = 0 ;
   int res2 ;
@@ -7736,14 +7739,17 @@ SWIGINTERN PyObject *_wrap_setOptions(PyObject *SWIGUNUSEDPARM(self), PyObject *
   int alloc2 = 0 ;
   unsigned long val3 ;
   int ecode3 = 0 ;
+  int val4 ;
+  int ecode4 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
   char *  kwnames[] = {
-    (char *) "numThreads",(char *) "name",(char *) "seed", NULL 
+    (char *) "numThreads",(char *) "name",(char *) "seed",(char *) "firstTouch", NULL 
   };
   
-  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"|OOO:setOptions",kwnames,&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"|OOOO:setOptions",kwnames,&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
   if (obj0) {
     ecode1 = SWIG_AsVal_int(obj0, &val1);
     if (!SWIG_IsOK(ecode1)) {
@@ -7765,10 +7771,17 @@ SWIGINTERN PyObject *_wrap_setOptions(PyObject *SWIGUNUSEDPARM(self), PyObject *
     } 
     arg3 = static_cast< unsigned long >(val3);
   }
+  if (obj3) {
+    ecode4 = SWIG_AsVal_int(obj3, &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "setOptions" "', argument " "4"" of type '" "int""'");
+    } 
+    arg4 = static_cast< int >(val4);
+  }
   {
     try
     {
-      simuPOP::setOptions(arg1,(char const *)arg2,arg3);
+      simuPOP::setOptions(arg1,(char const *)arg2,arg3,arg4);
     }
     catch(simuPOP::StopIteration e)
     {
@@ -22123,78 +22136,95 @@ SWIGINTERN PyObject *GenotypeSplitter_swiginit(PyObject *SWIGUNUSEDPARM(self), P
   return SWIG_Python_InitShadowInstance(args);
 }
 
-SWIGINTERN PyObject *_wrap_new_pyIndIterator(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+SWIGINTERN PyObject *_wrap_Genealogy_describe(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  SwigValueWrapper< vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator > arg1 ;
-  SwigValueWrapper< vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator > arg2 ;
-  bool arg3 ;
-  simuPOP::vspFunctor arg4 ;
-  void *argp1 ;
+  simuPOP::Genealogy *arg1 = (simuPOP::Genealogy *) 0 ;
+  bool arg2 = (bool) true ;
+  void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 ;
-  int res2 = 0 ;
-  bool val3 ;
-  int ecode3 = 0 ;
-  void *argp4 ;
-  int res4 = 0 ;
+  bool val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
   char *  kwnames[] = {
-    (char *) "begin",(char *) "end",(char *) "allInds",(char *) "func", NULL 
+    (char *) "self",(char *) "format", NULL 
   };
-  simuPOP::pyIndIterator *result = 0 ;
+  string result;
   
-  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"OOOO:new_pyIndIterator",kwnames,&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
-  {
-    res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__iterator,  0  | 0);
-    if (!SWIG_IsOK(res1)) {
-      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_pyIndIterator" "', argument " "1"" of type '" "vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator const""'"); 
-    }  
-    if (!argp1) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_pyIndIterator" "', argument " "1"" of type '" "vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator const""'");
-    } else {
-      vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator * temp = reinterpret_cast< vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator * >(argp1);
-      arg1 = *temp;
-      if (SWIG_IsNewObj(res1)) delete temp;
-    }
+  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"O|O:Genealogy_describe",kwnames,&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_simuPOP__Genealogy, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Genealogy_describe" "', argument " "1"" of type '" "simuPOP::Genealogy const *""'"); 
   }
-  {
-    res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__iterator,  0  | 0);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_pyIndIterator" "', argument " "2"" of type '" "vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator const""'"); 
-    }  
-    if (!argp2) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_pyIndIterator" "', argument " "2"" of type '" "vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator const""'");
-    } else {
-      vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator * temp = reinterpret_cast< vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator * >(argp2);
-      arg2 = *temp;
-      if (SWIG_IsNewObj(res2)) delete temp;
-    }
+  arg1 = reinterpret_cast< simuPOP::Genealogy * >(argp1);
+  if (obj1) {
+    ecode2 = SWIG_AsVal_bool(obj1, &val2);
+    if (!SWIG_IsOK(ecode2)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Genealogy_describe" "', argument " "2"" of type '" "bool""'");
+    } 
+    arg2 = static_cast< bool >(val2);
   }
-  ecode3 = SWIG_AsVal_bool(obj2, &val3);
-  if (!SWIG_IsOK(ecode3)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_pyIndIterator" "', argument " "3"" of type '" "bool""'");
-  } 
-  arg3 = static_cast< bool >(val3);
   {
-    res4 = SWIG_ConvertPtr(obj3, &argp4, SWIGTYPE_p_simuPOP__vspFunctor,  0  | 0);
-    if (!SWIG_IsOK(res4)) {
-      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "new_pyIndIterator" "', argument " "4"" of type '" "simuPOP::vspFunctor""'"); 
-    }  
-    if (!argp4) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_pyIndIterator" "', argument " "4"" of type '" "simuPOP::vspFunctor""'");
-    } else {
-      simuPOP::vspFunctor * temp = reinterpret_cast< simuPOP::vspFunctor * >(argp4);
-      arg4 = *temp;
-      if (SWIG_IsNewObj(res4)) delete temp;
+    try
+    {
+      result = ((simuPOP::Genealogy const *)arg1)->describe(arg2);
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
     }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Genealogy_nodes(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  simuPOP::Genealogy *arg1 = (simuPOP::Genealogy *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  PyObject *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__Genealogy, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Genealogy_nodes" "', argument " "1"" of type '" "simuPOP::Genealogy const *""'"); 
   }
+  arg1 = reinterpret_cast< simuPOP::Genealogy * >(argp1);
   {
     try
     {
-      result = (simuPOP::pyIndIterator *)new simuPOP::pyIndIterator(arg1,arg2,arg3,arg4);
+      result = (PyObject *)((simuPOP::Genealogy const *)arg1)->nodes();
     }
     catch(simuPOP::StopIteration e)
     {
@@ -22226,31 +22256,32 @@ SWIGINTERN PyObject *_wrap_new_pyIndIterator(PyObject *SWIGUNUSEDPARM(self), PyO
       SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_simuPOP__pyIndIterator, SWIG_POINTER_NEW |  0 );
+  resultobj = result;
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_pyIndIterator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Genealogy_edges(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  simuPOP::pyIndIterator *arg1 = (simuPOP::pyIndIterator *) 0 ;
+  simuPOP::Genealogy *arg1 = (simuPOP::Genealogy *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
+  PyObject *result = 0 ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__pyIndIterator, SWIG_POINTER_DISOWN |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__Genealogy, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_pyIndIterator" "', argument " "1"" of type '" "simuPOP::pyIndIterator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Genealogy_edges" "', argument " "1"" of type '" "simuPOP::Genealogy const *""'"); 
   }
-  arg1 = reinterpret_cast< simuPOP::pyIndIterator * >(argp1);
+  arg1 = reinterpret_cast< simuPOP::Genealogy * >(argp1);
   {
     try
     {
-      delete arg1;
+      result = (PyObject *)((simuPOP::Genealogy const *)arg1)->edges();
     }
     catch(simuPOP::StopIteration e)
     {
@@ -22282,32 +22313,32 @@ SWIGINTERN PyObject *_wrap_delete_pyIndIterator(PyObject *SWIGUNUSEDPARM(self),
       SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = result;
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_pyIndIterator___iter__(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Genealogy_samples(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  simuPOP::pyIndIterator *arg1 = (simuPOP::pyIndIterator *) 0 ;
+  simuPOP::Genealogy *arg1 = (simuPOP::Genealogy *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  SwigValueWrapper< simuPOP::pyIndIterator > result;
+  vectoru result;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__pyIndIterator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__Genealogy, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "pyIndIterator___iter__" "', argument " "1"" of type '" "simuPOP::pyIndIterator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Genealogy_samples" "', argument " "1"" of type '" "simuPOP::Genealogy const *""'"); 
   }
-  arg1 = reinterpret_cast< simuPOP::pyIndIterator * >(argp1);
+  arg1 = reinterpret_cast< simuPOP::Genealogy * >(argp1);
   {
     try
     {
-      result = (arg1)->__iter__();
+      result = ((simuPOP::Genealogy const *)arg1)->samples();
     }
     catch(simuPOP::StopIteration e)
     {
@@ -22339,32 +22370,456 @@ SWIGINTERN PyObject *_wrap_pyIndIterator___iter__(PyObject *SWIGUNUSEDPARM(self)
       SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
     }
   }
-  resultobj = SWIG_NewPointerObj((new simuPOP::pyIndIterator(static_cast< const simuPOP::pyIndIterator& >(result))), SWIGTYPE_p_simuPOP__pyIndIterator, SWIG_POINTER_OWN |  0 );
+  resultobj = swig::from(static_cast< std::vector< size_t,std::allocator< size_t > > >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_pyIndIterator_next(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Genealogy_simplify(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
-  simuPOP::pyIndIterator *arg1 = (simuPOP::pyIndIterator *) 0 ;
+  simuPOP::Genealogy *arg1 = (simuPOP::Genealogy *) 0 ;
+  simuPOP::Population *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char *  kwnames[] = {
+    (char *) "self",(char *) "pop", NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"OO:Genealogy_simplify",kwnames,&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_simuPOP__Genealogy, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Genealogy_simplify" "', argument " "1"" of type '" "simuPOP::Genealogy *""'"); 
+  }
+  arg1 = reinterpret_cast< simuPOP::Genealogy * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_simuPOP__Population,  0  | 0);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Genealogy_simplify" "', argument " "2"" of type '" "simuPOP::Population const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Genealogy_simplify" "', argument " "2"" of type '" "simuPOP::Population const &""'"); 
+  }
+  arg2 = reinterpret_cast< simuPOP::Population * >(argp2);
+  {
+    try
+    {
+      (arg1)->simplify((simuPOP::Population const &)*arg2);
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Genealogy_mutate(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  simuPOP::Genealogy *arg1 = (simuPOP::Genealogy *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  char *  kwnames[] = {
+    (char *) "self",(char *) "rate", NULL 
+  };
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"OO:Genealogy_mutate",kwnames,&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_simuPOP__Genealogy, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Genealogy_mutate" "', argument " "1"" of type '" "simuPOP::Genealogy const *""'"); 
+  }
+  arg1 = reinterpret_cast< simuPOP::Genealogy * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Genealogy_mutate" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  {
+    try
+    {
+      result = (PyObject *)((simuPOP::Genealogy const *)arg1)->mutate(arg2);
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_Genealogy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  simuPOP::Genealogy *arg1 = (simuPOP::Genealogy *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject *swig_obj[1] ;
-  simuPOP::Individual *result = 0 ;
   
   if (!args) SWIG_fail;
   swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__pyIndIterator, 0 |  0 );
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__Genealogy, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "pyIndIterator_next" "', argument " "1"" of type '" "simuPOP::pyIndIterator *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Genealogy" "', argument " "1"" of type '" "simuPOP::Genealogy *""'"); 
   }
-  arg1 = reinterpret_cast< simuPOP::pyIndIterator * >(argp1);
+  arg1 = reinterpret_cast< simuPOP::Genealogy * >(argp1);
   {
     try
     {
-      result = (simuPOP::Individual *) &(arg1)->next();
+      delete arg1;
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *Genealogy_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args,(char *)"swigregister", 1, 1,&obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_simuPOP__Genealogy, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_new_pyIndIterator(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  SwigValueWrapper< vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator > arg1 ;
+  SwigValueWrapper< vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator > arg2 ;
+  bool arg3 ;
+  simuPOP::vspFunctor arg4 ;
+  void *argp1 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  bool val3 ;
+  int ecode3 = 0 ;
+  void *argp4 ;
+  int res4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  char *  kwnames[] = {
+    (char *) "begin",(char *) "end",(char *) "allInds",(char *) "func", NULL 
+  };
+  simuPOP::pyIndIterator *result = 0 ;
+  
+  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"OOOO:new_pyIndIterator",kwnames,&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  {
+    res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__iterator,  0  | 0);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_pyIndIterator" "', argument " "1"" of type '" "vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator const""'"); 
+    }  
+    if (!argp1) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_pyIndIterator" "', argument " "1"" of type '" "vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator const""'");
+    } else {
+      vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator * temp = reinterpret_cast< vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator * >(argp1);
+      arg1 = *temp;
+      if (SWIG_IsNewObj(res1)) delete temp;
+    }
+  }
+  {
+    res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_vectorT_simuPOP__Individual_std__allocatorT_simuPOP__Individual_t_t__iterator,  0  | 0);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_pyIndIterator" "', argument " "2"" of type '" "vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator const""'"); 
+    }  
+    if (!argp2) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_pyIndIterator" "', argument " "2"" of type '" "vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator const""'");
+    } else {
+      vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator * temp = reinterpret_cast< vector< simuPOP::Individual,std::allocator< simuPOP::Individual > >::iterator * >(argp2);
+      arg2 = *temp;
+      if (SWIG_IsNewObj(res2)) delete temp;
+    }
+  }
+  ecode3 = SWIG_AsVal_bool(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "new_pyIndIterator" "', argument " "3"" of type '" "bool""'");
+  } 
+  arg3 = static_cast< bool >(val3);
+  {
+    res4 = SWIG_ConvertPtr(obj3, &argp4, SWIGTYPE_p_simuPOP__vspFunctor,  0  | 0);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "new_pyIndIterator" "', argument " "4"" of type '" "simuPOP::vspFunctor""'"); 
+    }  
+    if (!argp4) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_pyIndIterator" "', argument " "4"" of type '" "simuPOP::vspFunctor""'");
+    } else {
+      simuPOP::vspFunctor * temp = reinterpret_cast< simuPOP::vspFunctor * >(argp4);
+      arg4 = *temp;
+      if (SWIG_IsNewObj(res4)) delete temp;
+    }
+  }
+  {
+    try
+    {
+      result = (simuPOP::pyIndIterator *)new simuPOP::pyIndIterator(arg1,arg2,arg3,arg4);
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_simuPOP__pyIndIterator, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_pyIndIterator(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  simuPOP::pyIndIterator *arg1 = (simuPOP::pyIndIterator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__pyIndIterator, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_pyIndIterator" "', argument " "1"" of type '" "simuPOP::pyIndIterator *""'"); 
+  }
+  arg1 = reinterpret_cast< simuPOP::pyIndIterator * >(argp1);
+  {
+    try
+    {
+      delete arg1;
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_pyIndIterator___iter__(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  simuPOP::pyIndIterator *arg1 = (simuPOP::pyIndIterator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  SwigValueWrapper< simuPOP::pyIndIterator > result;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__pyIndIterator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "pyIndIterator___iter__" "', argument " "1"" of type '" "simuPOP::pyIndIterator *""'"); 
+  }
+  arg1 = reinterpret_cast< simuPOP::pyIndIterator * >(argp1);
+  {
+    try
+    {
+      result = (arg1)->__iter__();
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_NewPointerObj((new simuPOP::pyIndIterator(static_cast< const simuPOP::pyIndIterator& >(result))), SWIGTYPE_p_simuPOP__pyIndIterator, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_pyIndIterator_next(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  simuPOP::pyIndIterator *arg1 = (simuPOP::pyIndIterator *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  simuPOP::Individual *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__pyIndIterator, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "pyIndIterator_next" "', argument " "1"" of type '" "simuPOP::pyIndIterator *""'"); 
+  }
+  arg1 = reinterpret_cast< simuPOP::pyIndIterator * >(argp1);
+  {
+    try
+    {
+      result = (simuPOP::Individual *) &(arg1)->next();
     }
     catch(simuPOP::StopIteration e)
     {
@@ -28226,6 +28681,151 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_Population_recordGenealogy(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  simuPOP::Population *arg1 = (simuPOP::Population *) 0 ;
+  string const &arg2_defvalue = "ind_id" ;
+  string *arg2 = (string *) &arg2_defvalue ;
+  UINT arg3 = (UINT) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  UINT val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  char *  kwnames[] = {
+    (char *) "self",(char *) "idField",(char *) "simplifyInterval", NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"O|OO:Population_recordGenealogy",kwnames,&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_simuPOP__Population, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Population_recordGenealogy" "', argument " "1"" of type '" "simuPOP::Population *""'"); 
+  }
+  arg1 = reinterpret_cast< simuPOP::Population * >(argp1);
+  if (obj1) {
+    {
+      std::string *ptr = (std::string *)0;
+      res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+      if (!SWIG_IsOK(res2)) {
+        SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Population_recordGenealogy" "', argument " "2"" of type '" "string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Population_recordGenealogy" "', argument " "2"" of type '" "string const &""'"); 
+      }
+      arg2 = ptr;
+    }
+  }
+  if (obj2) {
+    ecode3 = SWIG_AsVal_unsigned_SS_int(obj2, &val3);
+    if (!SWIG_IsOK(ecode3)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Population_recordGenealogy" "', argument " "3"" of type '" "UINT""'");
+    } 
+    arg3 = static_cast< UINT >(val3);
+  }
+  {
+    try
+    {
+      (arg1)->recordGenealogy((string const &)*arg2,arg3);
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Population_genealogy(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  simuPOP::Population *arg1 = (simuPOP::Population *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  simuPOP::Genealogy *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__Population, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Population_genealogy" "', argument " "1"" of type '" "simuPOP::Population *""'"); 
+  }
+  arg1 = reinterpret_cast< simuPOP::Population * >(argp1);
+  {
+    try
+    {
+      result = (simuPOP::Genealogy *) &(arg1)->genealogy();
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_simuPOP__Genealogy, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_Population_useAncestralGen(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   simuPOP::Population *arg1 = (simuPOP::Population *) 0 ;
@@ -34535,19 +35135,23 @@ SWIGINTERN PyObject *_wrap_new_Simulator(PyObject *SWIGUNUSEDPARM(self), PyObjec
   PyObject *arg1 = (PyObject *) 0 ;
   UINT arg2 = (UINT) 1 ;
   bool arg3 = (bool) true ;
+  bool arg4 = (bool) false ;
   unsigned int val2 ;
   int ecode2 = 0 ;
   bool val3 ;
   int ecode3 = 0 ;
+  bool val4 ;
+  int ecode4 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
   char *  kwnames[] = {
-    (char *) "pops",(char *) "rep",(char *) "stealPops", NULL 
+    (char *) "pops",(char *) "rep",(char *) "stealPops",(char *) "shareGenotype", NULL 
   };
   simuPOP::Simulator *result = 0 ;
   
-  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"O|OO:new_Simulator",kwnames,&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"O|OOO:new_Simulator",kwnames,&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
   arg1 = obj0;
   if (obj1) {
     ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
@@ -34563,10 +35167,17 @@ SWIGINTERN PyObject *_wrap_new_Simulator(PyObject *SWIGUNUSEDPARM(self), PyObjec
     } 
     arg3 = static_cast< bool >(val3);
   }
+  if (obj3) {
+    ecode4 = SWIG_AsVal_bool(obj3, &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_Simulator" "', argument " "4"" of type '" "bool""'");
+    } 
+    arg4 = static_cast< bool >(val4);
+  }
   {
     try
     {
-      result = (simuPOP::Simulator *)new simuPOP::Simulator(arg1,arg2,arg3);
+      result = (simuPOP::Simulator *)new simuPOP::Simulator(arg1,arg2,arg3,arg4);
     }
     catch(simuPOP::StopIteration e)
     {
@@ -38003,6 +38614,7 @@ SWIGINTERN PyObject *_wrap_new_SavePopulation(PyObject *SWIGUNUSEDPARM(self), Py
   simuPOP::subPopList *arg7 = (simuPOP::subPopList *) &arg7_defvalue ;
   simuPOP::stringList const &arg8_defvalue = vectorstr() ;
   simuPOP::stringList *arg8 = (simuPOP::stringList *) &arg8_defvalue ;
+  size_t arg9 = (size_t) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   int val2 ;
@@ -38019,6 +38631,8 @@ SWIGINTERN PyObject *_wrap_new_SavePopulation(PyObject *SWIGUNUSEDPARM(self), Py
   int res7 = 0 ;
   void *argp8 = 0 ;
   int res8 = 0 ;
+  size_t val9 ;
+  int ecode9 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
@@ -38027,12 +38641,13 @@ SWIGINTERN PyObject *_wrap_new_SavePopulation(PyObject *SWIGUNUSEDPARM(self), Py
   PyObject * obj5 = 0 ;
   PyObject * obj6 = 0 ;
   PyObject * obj7 = 0 ;
+  PyObject * obj8 = 0 ;
   char *  kwnames[] = {
-    (char *) "output",(char *) "begin",(char *) "end",(char *) "step",(char *) "at",(char *) "reps",(char *) "subPops",(char *) "infoFields", NULL 
+    (char *) "output",(char *) "begin",(char *) "end",(char *) "step",(char *) "at",(char *) "reps",(char *) "subPops",(char *) "infoFields",(char *) "background", NULL 
   };
   simuPOP::SavePopulation *result = 0 ;
   
-  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"|OOOOOOOO:new_SavePopulation",kwnames,&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"|OOOOOOOOO:new_SavePopulation",kwnames,&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8)) SWIG_fail;
   if (obj0) {
     res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_simuPOP__stringFunc,  0  | SWIG_POINTER_IMPLICIT_CONV);
     if (!SWIG_IsOK(res1)) {
@@ -38104,10 +38719,17 @@ SWIGINTERN PyObject *_wrap_new_SavePopulation(PyObject *SWIGUNUSEDPARM(self), Py
     }
     arg8 = reinterpret_cast< simuPOP::stringList * >(argp8);
   }
+  if (obj8) {
+    ecode9 = SWIG_AsVal_size_t(obj8, &val9);
+    if (!SWIG_IsOK(ecode9)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode9), "in method '" "new_SavePopulation" "', argument " "9"" of type '" "size_t""'");
+    } 
+    arg9 = static_cast< size_t >(val9);
+  }
   {
     try
     {
-      result = (simuPOP::SavePopulation *)new simuPOP::SavePopulation((simuPOP::stringFunc const &)*arg1,arg2,arg3,arg4,(simuPOP::intList const &)*arg5,(simuPOP::intList const &)*arg6,(simuPOP::subPopList const &)*arg7,(simuPOP::stringList const &)*arg8);
+      result = (simuPOP::SavePopulation *)new simuPOP::SavePopulation((simuPOP::stringFunc const &)*arg1,arg2,arg3,arg4,(simuPOP::intList const &)*arg5,(simuPOP::intList const &)*arg6,(simuPOP::subPopList const &)*arg7,(simuPOP::stringList const &)*arg8,arg9);
     }
     catch(simuPOP::StopIteration e)
     {
@@ -49834,6 +50456,297 @@ SWIGINTERN PyObject *PyQuanTrait_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObje
   return SWIG_Python_InitShadowInstance(args);
 }
 
+SWIGINTERN PyObject *_wrap_new_AdditiveQuanTrait(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  simuPOP::lociList *arg1 = 0 ;
+  simuPOP::floatMatrix *arg2 = 0 ;
+  simuPOP::floatList const &arg3_defvalue = vectorf() ;
+  simuPOP::floatList *arg3 = (simuPOP::floatList *) &arg3_defvalue ;
+  double arg4 = (double) 0 ;
+  simuPOP::uintList const &arg5_defvalue = simuPOP::uintList(NULL) ;
+  simuPOP::uintList *arg5 = (simuPOP::uintList *) &arg5_defvalue ;
+  int arg6 = (int) 0 ;
+  int arg7 = (int) -1 ;
+  int arg8 = (int) 1 ;
+  simuPOP::intList const &arg9_defvalue = vectori() ;
+  simuPOP::intList *arg9 = (simuPOP::intList *) &arg9_defvalue ;
+  simuPOP::intList const &arg10_defvalue = simuPOP::intList() ;
+  simuPOP::intList *arg10 = (simuPOP::intList *) &arg10_defvalue ;
+  simuPOP::subPopList const &arg11_defvalue = simuPOP::subPopList() ;
+  simuPOP::subPopList *arg11 = (simuPOP::subPopList *) &arg11_defvalue ;
+  simuPOP::stringList const &arg12_defvalue = vectorstr() ;
+  simuPOP::stringList *arg12 = (simuPOP::stringList *) &arg12_defvalue ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  double val4 ;
+  int ecode4 = 0 ;
+  void *argp5 = 0 ;
+  int res5 = 0 ;
+  int val6 ;
+  int ecode6 = 0 ;
+  int val7 ;
+  int ecode7 = 0 ;
+  int val8 ;
+  int ecode8 = 0 ;
+  void *argp9 = 0 ;
+  int res9 = 0 ;
+  void *argp10 = 0 ;
+  int res10 = 0 ;
+  void *argp11 = 0 ;
+  int res11 = 0 ;
+  void *argp12 = 0 ;
+  int res12 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  PyObject * obj8 = 0 ;
+  PyObject * obj9 = 0 ;
+  PyObject * obj10 = 0 ;
+  PyObject * obj11 = 0 ;
+  char *  kwnames[] = {
+    (char *) "loci",(char *) "effects",(char *) "dominance",(char *) "envVar",(char *) "ancGens",(char *) "begin",(char *) "end",(char *) "step",(char *) "at",(char *) "reps",(char *) "subPops",(char *) "infoFields", NULL 
+  };
+  simuPOP::AdditiveQuanTrait *result = 0 ;
+  
+  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"OO|OOOOOOOOOO:new_AdditiveQuanTrait",kwnames,&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8,&obj9,&obj10,&obj11)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_simuPOP__lociList,  0  | SWIG_POINTER_IMPLICIT_CONV);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_AdditiveQuanTrait" "', argument " "1"" of type '" "simuPOP::lociList const &""'"); 
+  }
+  if (!argp1) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_AdditiveQuanTrait" "', argument " "1"" of type '" "simuPOP::lociList const &""'"); 
+  }
+  arg1 = reinterpret_cast< simuPOP::lociList * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_simuPOP__floatMatrix,  0  | SWIG_POINTER_IMPLICIT_CONV);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_AdditiveQuanTrait" "', argument " "2"" of type '" "simuPOP::floatMatrix const &""'"); 
+  }
+  if (!argp2) {
+    SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_AdditiveQuanTrait" "', argument " "2"" of type '" "simuPOP::floatMatrix const &""'"); 
+  }
+  arg2 = reinterpret_cast< simuPOP::floatMatrix * >(argp2);
+  if (obj2) {
+    res3 = SWIG_ConvertPtr(obj2, &argp3, SWIGTYPE_p_simuPOP__floatList,  0  | SWIG_POINTER_IMPLICIT_CONV);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_AdditiveQuanTrait" "', argument " "3"" of type '" "simuPOP::floatList const &""'"); 
+    }
+    if (!argp3) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_AdditiveQuanTrait" "', argument " "3"" of type '" "simuPOP::floatList const &""'"); 
+    }
+    arg3 = reinterpret_cast< simuPOP::floatList * >(argp3);
+  }
+  if (obj3) {
+    ecode4 = SWIG_AsVal_double(obj3, &val4);
+    if (!SWIG_IsOK(ecode4)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_AdditiveQuanTrait" "', argument " "4"" of type '" "double""'");
+    } 
+    arg4 = static_cast< double >(val4);
+  }
+  if (obj4) {
+    res5 = SWIG_ConvertPtr(obj4, &argp5, SWIGTYPE_p_simuPOP__uintList,  0  | SWIG_POINTER_IMPLICIT_CONV);
+    if (!SWIG_IsOK(res5)) {
+      SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "new_AdditiveQuanTrait" "', argument " "5"" of type '" "simuPOP::uintList const &""'"); 
+    }
+    if (!argp5) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_AdditiveQuanTrait" "', argument " "5"" of type '" "simuPOP::uintList const &""'"); 
+    }
+    arg5 = reinterpret_cast< simuPOP::uintList * >(argp5);
+  }
+  if (obj5) {
+    ecode6 = SWIG_AsVal_int(obj5, &val6);
+    if (!SWIG_IsOK(ecode6)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode6), "in method '" "new_AdditiveQuanTrait" "', argument " "6"" of type '" "int""'");
+    } 
+    arg6 = static_cast< int >(val6);
+  }
+  if (obj6) {
+    ecode7 = SWIG_AsVal_int(obj6, &val7);
+    if (!SWIG_IsOK(ecode7)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode7), "in method '" "new_AdditiveQuanTrait" "', argument " "7"" of type '" "int""'");
+    } 
+    arg7 = static_cast< int >(val7);
+  }
+  if (obj7) {
+    ecode8 = SWIG_AsVal_int(obj7, &val8);
+    if (!SWIG_IsOK(ecode8)) {
+      SWIG_exception_fail(SWIG_ArgError(ecode8), "in method '" "new_AdditiveQuanTrait" "', argument " "8"" of type '" "int""'");
+    } 
+    arg8 = static_cast< int >(val8);
+  }
+  if (obj8) {
+    res9 = SWIG_ConvertPtr(obj8, &argp9, SWIGTYPE_p_simuPOP__intList,  0  | SWIG_POINTER_IMPLICIT_CONV);
+    if (!SWIG_IsOK(res9)) {
+      SWIG_exception_fail(SWIG_ArgError(res9), "in method '" "new_AdditiveQuanTrait" "', argument " "9"" of type '" "simuPOP::intList const &""'"); 
+    }
+    if (!argp9) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_AdditiveQuanTrait" "', argument " "9"" of type '" "simuPOP::intList const &""'"); 
+    }
+    arg9 = reinterpret_cast< simuPOP::intList * >(argp9);
+  }
+  if (obj9) {
+    res10 = SWIG_ConvertPtr(obj9, &argp10, SWIGTYPE_p_simuPOP__intList,  0  | SWIG_POINTER_IMPLICIT_CONV);
+    if (!SWIG_IsOK(res10)) {
+      SWIG_exception_fail(SWIG_ArgError(res10), "in method '" "new_AdditiveQuanTrait" "', argument " "10"" of type '" "simuPOP::intList const &""'"); 
+    }
+    if (!argp10) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_AdditiveQuanTrait" "', argument " "10"" of type '" "simuPOP::intList const &""'"); 
+    }
+    arg10 = reinterpret_cast< simuPOP::intList * >(argp10);
+  }
+  if (obj10) {
+    res11 = SWIG_ConvertPtr(obj10, &argp11, SWIGTYPE_p_simuPOP__subPopList,  0  | SWIG_POINTER_IMPLICIT_CONV);
+    if (!SWIG_IsOK(res11)) {
+      SWIG_exception_fail(SWIG_ArgError(res11), "in method '" "new_AdditiveQuanTrait" "', argument " "11"" of type '" "simuPOP::subPopList const &""'"); 
+    }
+    if (!argp11) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_AdditiveQuanTrait" "', argument " "11"" of type '" "simuPOP::subPopList const &""'"); 
+    }
+    arg11 = reinterpret_cast< simuPOP::subPopList * >(argp11);
+  }
+  if (obj11) {
+    res12 = SWIG_ConvertPtr(obj11, &argp12, SWIGTYPE_p_simuPOP__stringList,  0  | SWIG_POINTER_IMPLICIT_CONV);
+    if (!SWIG_IsOK(res12)) {
+      SWIG_exception_fail(SWIG_ArgError(res12), "in method '" "new_AdditiveQuanTrait" "', argument " "12"" of type '" "simuPOP::stringList const &""'"); 
+    }
+    if (!argp12) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_AdditiveQuanTrait" "', argument " "12"" of type '" "simuPOP::stringList const &""'"); 
+    }
+    arg12 = reinterpret_cast< simuPOP::stringList * >(argp12);
+  }
+  {
+    try
+    {
+      result = (simuPOP::AdditiveQuanTrait *)new simuPOP::AdditiveQuanTrait((simuPOP::lociList const &)*arg1,(simuPOP::floatMatrix const &)*arg2,(simuPOP::floatList const &)*arg3,arg4,(simuPOP::uintList const &)*arg5,arg6,arg7,arg8,(simuPOP::intList const &)*arg9,(simuPOP::intList const &)*arg10,(simuPOP::subPopList const &)*arg11,(simuPOP::stringList const &)*arg12);
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_simuPOP__AdditiveQuanTrait, SWIG_POINTER_NEW |  0 );
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res5)) delete arg5;
+  if (SWIG_IsNewObj(res9)) delete arg9;
+  if (SWIG_IsNewObj(res10)) delete arg10;
+  if (SWIG_IsNewObj(res11)) delete arg11;
+  if (SWIG_IsNewObj(res12)) delete arg12;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res5)) delete arg5;
+  if (SWIG_IsNewObj(res9)) delete arg9;
+  if (SWIG_IsNewObj(res10)) delete arg10;
+  if (SWIG_IsNewObj(res11)) delete arg11;
+  if (SWIG_IsNewObj(res12)) delete arg12;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_AdditiveQuanTrait(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  simuPOP::AdditiveQuanTrait *arg1 = (simuPOP::AdditiveQuanTrait *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__AdditiveQuanTrait, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_AdditiveQuanTrait" "', argument " "1"" of type '" "simuPOP::AdditiveQuanTrait *""'"); 
+  }
+  arg1 = reinterpret_cast< simuPOP::AdditiveQuanTrait * >(argp1);
+  {
+    try
+    {
+      delete arg1;
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *AdditiveQuanTrait_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!SWIG_Python_UnpackTuple(args,(char *)"swigregister", 1, 1,&obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_simuPOP__AdditiveQuanTrait, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *AdditiveQuanTrait_swiginit(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  return SWIG_Python_InitShadowInstance(args);
+}
+
 SWIGINTERN PyObject *_wrap_new_BasePenetrance(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   simuPOP::uintList const &arg1_defvalue = simuPOP::uintList(NULL) ;
@@ -51655,186 +52568,205 @@ SWIGINTERN PyObject *_wrap_new_Pedigree(PyObject *SWIGUNUSEDPARM(self), PyObject
       SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_simuPOP__Pedigree, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_simuPOP__Pedigree, SWIG_POINTER_NEW |  0 );
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  if (SWIG_IsNewObj(res5)) delete arg5;
+  if (SWIG_IsNewObj(res6)) delete arg6;
+  if (SWIG_IsNewObj(res7)) delete arg7;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  if (SWIG_IsNewObj(res5)) delete arg5;
+  if (SWIG_IsNewObj(res6)) delete arg6;
+  if (SWIG_IsNewObj(res7)) delete arg7;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Pedigree_clone(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  simuPOP::Pedigree *arg1 = (simuPOP::Pedigree *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject *swig_obj[1] ;
+  simuPOP::Pedigree *result = 0 ;
+  
+  if (!args) SWIG_fail;
+  swig_obj[0] = args;
+  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__Pedigree, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Pedigree_clone" "', argument " "1"" of type '" "simuPOP::Pedigree const *""'"); 
+  }
+  arg1 = reinterpret_cast< simuPOP::Pedigree * >(argp1);
+  {
+    try
+    {
+      result = (simuPOP::Pedigree *)((simuPOP::Pedigree const *)arg1)->clone();
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_simuPOP__Pedigree, 0 |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Pedigree_save(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
+  PyObject *resultobj = 0;
+  simuPOP::Pedigree *arg1 = (simuPOP::Pedigree *) 0 ;
+  string *arg2 = 0 ;
+  simuPOP::stringList const &arg3_defvalue = vectorstr() ;
+  simuPOP::stringList *arg3 = (simuPOP::stringList *) &arg3_defvalue ;
+  simuPOP::lociList const &arg4_defvalue = vectoru() ;
+  simuPOP::lociList *arg4 = (simuPOP::lociList *) &arg4_defvalue ;
+  string const &arg5_defvalue = "text" ;
+  string *arg5 = (string *) &arg5_defvalue ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  void *argp4 = 0 ;
+  int res4 = 0 ;
+  int res5 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  char *  kwnames[] = {
+    (char *) "self",(char *) "filename",(char *) "infoFields",(char *) "loci",(char *) "format", NULL 
+  };
+  
+  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"OO|OOO:Pedigree_save",kwnames,&obj0,&obj1,&obj2,&obj3,&obj4)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_simuPOP__Pedigree, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Pedigree_save" "', argument " "1"" of type '" "simuPOP::Pedigree const *""'"); 
+  }
+  arg1 = reinterpret_cast< simuPOP::Pedigree * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Pedigree_save" "', argument " "2"" of type '" "string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Pedigree_save" "', argument " "2"" of type '" "string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  if (obj2) {
+    res3 = SWIG_ConvertPtr(obj2, &argp3, SWIGTYPE_p_simuPOP__stringList,  0  | SWIG_POINTER_IMPLICIT_CONV);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Pedigree_save" "', argument " "3"" of type '" "simuPOP::stringList const &""'"); 
+    }
+    if (!argp3) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Pedigree_save" "', argument " "3"" of type '" "simuPOP::stringList const &""'"); 
+    }
+    arg3 = reinterpret_cast< simuPOP::stringList * >(argp3);
+  }
+  if (obj3) {
+    res4 = SWIG_ConvertPtr(obj3, &argp4, SWIGTYPE_p_simuPOP__lociList,  0  | SWIG_POINTER_IMPLICIT_CONV);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "Pedigree_save" "', argument " "4"" of type '" "simuPOP::lociList const &""'"); 
+    }
+    if (!argp4) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Pedigree_save" "', argument " "4"" of type '" "simuPOP::lociList const &""'"); 
+    }
+    arg4 = reinterpret_cast< simuPOP::lociList * >(argp4);
+  }
+  if (obj4) {
+    {
+      std::string *ptr = (std::string *)0;
+      res5 = SWIG_AsPtr_std_string(obj4, &ptr);
+      if (!SWIG_IsOK(res5)) {
+        SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "Pedigree_save" "', argument " "5"" of type '" "string const &""'"); 
+      }
+      if (!ptr) {
+        SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Pedigree_save" "', argument " "5"" of type '" "string const &""'"); 
+      }
+      arg5 = ptr;
+    }
+  }
+  {
+    try
+    {
+      ((simuPOP::Pedigree const *)arg1)->save((string const &)*arg2,(simuPOP::stringList const &)*arg3,(simuPOP::lociList const &)*arg4,(string const &)*arg5);
+    }
+    catch(simuPOP::StopIteration e)
+    {
+      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
+      SWIG_fail;
+    }
+    catch(simuPOP::IndexError e)
+    {
+      SWIG_exception(SWIG_IndexError, e.message());
+    }
+    catch(simuPOP::ValueError e)
+    {
+      SWIG_exception(SWIG_ValueError, e.message());
+    }
+    catch(simuPOP::SystemError e)
+    {
+      SWIG_exception(SWIG_SystemError, e.message());
+    }
+    catch(simuPOP::RuntimeError e)
+    {
+      SWIG_exception(SWIG_RuntimeError, e.message());
+    }
+    catch(std::bad_alloc)
+    {
+      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
+    }
+    catch(...)
+    {
+      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
+    }
+  }
+  resultobj = SWIG_Py_Void();
   if (SWIG_IsNewObj(res2)) delete arg2;
   if (SWIG_IsNewObj(res3)) delete arg3;
   if (SWIG_IsNewObj(res4)) delete arg4;
   if (SWIG_IsNewObj(res5)) delete arg5;
-  if (SWIG_IsNewObj(res6)) delete arg6;
-  if (SWIG_IsNewObj(res7)) delete arg7;
   return resultobj;
 fail:
   if (SWIG_IsNewObj(res2)) delete arg2;
   if (SWIG_IsNewObj(res3)) delete arg3;
   if (SWIG_IsNewObj(res4)) delete arg4;
   if (SWIG_IsNewObj(res5)) delete arg5;
-  if (SWIG_IsNewObj(res6)) delete arg6;
-  if (SWIG_IsNewObj(res7)) delete arg7;
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_Pedigree_clone(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *resultobj = 0;
-  simuPOP::Pedigree *arg1 = (simuPOP::Pedigree *) 0 ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  PyObject *swig_obj[1] ;
-  simuPOP::Pedigree *result = 0 ;
-  
-  if (!args) SWIG_fail;
-  swig_obj[0] = args;
-  res1 = SWIG_ConvertPtr(swig_obj[0], &argp1,SWIGTYPE_p_simuPOP__Pedigree, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Pedigree_clone" "', argument " "1"" of type '" "simuPOP::Pedigree const *""'"); 
-  }
-  arg1 = reinterpret_cast< simuPOP::Pedigree * >(argp1);
-  {
-    try
-    {
-      result = (simuPOP::Pedigree *)((simuPOP::Pedigree const *)arg1)->clone();
-    }
-    catch(simuPOP::StopIteration e)
-    {
-      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
-      SWIG_fail;
-    }
-    catch(simuPOP::IndexError e)
-    {
-      SWIG_exception(SWIG_IndexError, e.message());
-    }
-    catch(simuPOP::ValueError e)
-    {
-      SWIG_exception(SWIG_ValueError, e.message());
-    }
-    catch(simuPOP::SystemError e)
-    {
-      SWIG_exception(SWIG_SystemError, e.message());
-    }
-    catch(simuPOP::RuntimeError e)
-    {
-      SWIG_exception(SWIG_RuntimeError, e.message());
-    }
-    catch(std::bad_alloc)
-    {
-      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
-    }
-    catch(...)
-    {
-      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
-    }
-  }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_simuPOP__Pedigree, 0 |  0 );
-  return resultobj;
-fail:
-  return NULL;
-}
-
-
-SWIGINTERN PyObject *_wrap_Pedigree_save(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
-  PyObject *resultobj = 0;
-  simuPOP::Pedigree *arg1 = (simuPOP::Pedigree *) 0 ;
-  string *arg2 = 0 ;
-  simuPOP::stringList const &arg3_defvalue = vectorstr() ;
-  simuPOP::stringList *arg3 = (simuPOP::stringList *) &arg3_defvalue ;
-  simuPOP::lociList const &arg4_defvalue = vectoru() ;
-  simuPOP::lociList *arg4 = (simuPOP::lociList *) &arg4_defvalue ;
-  void *argp1 = 0 ;
-  int res1 = 0 ;
-  int res2 = SWIG_OLDOBJ ;
-  void *argp3 = 0 ;
-  int res3 = 0 ;
-  void *argp4 = 0 ;
-  int res4 = 0 ;
-  PyObject * obj0 = 0 ;
-  PyObject * obj1 = 0 ;
-  PyObject * obj2 = 0 ;
-  PyObject * obj3 = 0 ;
-  char *  kwnames[] = {
-    (char *) "self",(char *) "filename",(char *) "infoFields",(char *) "loci", NULL 
-  };
-  
-  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"OO|OO:Pedigree_save",kwnames,&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_simuPOP__Pedigree, 0 |  0 );
-  if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Pedigree_save" "', argument " "1"" of type '" "simuPOP::Pedigree const *""'"); 
-  }
-  arg1 = reinterpret_cast< simuPOP::Pedigree * >(argp1);
-  {
-    std::string *ptr = (std::string *)0;
-    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
-    if (!SWIG_IsOK(res2)) {
-      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Pedigree_save" "', argument " "2"" of type '" "string const &""'"); 
-    }
-    if (!ptr) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Pedigree_save" "', argument " "2"" of type '" "string const &""'"); 
-    }
-    arg2 = ptr;
-  }
-  if (obj2) {
-    res3 = SWIG_ConvertPtr(obj2, &argp3, SWIGTYPE_p_simuPOP__stringList,  0  | SWIG_POINTER_IMPLICIT_CONV);
-    if (!SWIG_IsOK(res3)) {
-      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Pedigree_save" "', argument " "3"" of type '" "simuPOP::stringList const &""'"); 
-    }
-    if (!argp3) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Pedigree_save" "', argument " "3"" of type '" "simuPOP::stringList const &""'"); 
-    }
-    arg3 = reinterpret_cast< simuPOP::stringList * >(argp3);
-  }
-  if (obj3) {
-    res4 = SWIG_ConvertPtr(obj3, &argp4, SWIGTYPE_p_simuPOP__lociList,  0  | SWIG_POINTER_IMPLICIT_CONV);
-    if (!SWIG_IsOK(res4)) {
-      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "Pedigree_save" "', argument " "4"" of type '" "simuPOP::lociList const &""'"); 
-    }
-    if (!argp4) {
-      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Pedigree_save" "', argument " "4"" of type '" "simuPOP::lociList const &""'"); 
-    }
-    arg4 = reinterpret_cast< simuPOP::lociList * >(argp4);
-  }
-  {
-    try
-    {
-      ((simuPOP::Pedigree const *)arg1)->save((string const &)*arg2,(simuPOP::stringList const &)*arg3,(simuPOP::lociList const &)*arg4);
-    }
-    catch(simuPOP::StopIteration e)
-    {
-      SWIG_SetErrorObj(PyExc_StopIteration, SWIG_Py_Void());
-      SWIG_fail;
-    }
-    catch(simuPOP::IndexError e)
-    {
-      SWIG_exception(SWIG_IndexError, e.message());
-    }
-    catch(simuPOP::ValueError e)
-    {
-      SWIG_exception(SWIG_ValueError, e.message());
-    }
-    catch(simuPOP::SystemError e)
-    {
-      SWIG_exception(SWIG_SystemError, e.message());
-    }
-    catch(simuPOP::RuntimeError e)
-    {
-      SWIG_exception(SWIG_RuntimeError, e.message());
-    }
-    catch(std::bad_alloc)
-    {
-      SWIG_exception(SWIG_MemoryError, "Memory allocation error");
-    }
-    catch(...)
-    {
-      SWIG_exception(SWIG_UnknownError, "Unknown runtime error happened.");
-    }
-  }
-  resultobj = SWIG_Py_Void();
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
-  if (SWIG_IsNewObj(res4)) delete arg4;
-  return resultobj;
-fail:
-  if (SWIG_IsNewObj(res2)) delete arg2;
-  if (SWIG_IsNewObj(res3)) delete arg3;
-  if (SWIG_IsNewObj(res4)) delete arg4;
   return NULL;
 }
 
@@ -53586,6 +54518,8 @@ SWIGINTERN PyObject *_wrap_loadPedigree(PyObject *SWIGUNUSEDPARM(self), PyObject
   simuPOP::stringList *arg12 = (simuPOP::stringList *) &arg12_defvalue ;
   simuPOP::stringList const &arg13_defvalue = vectorstr() ;
   simuPOP::stringList *arg13 = (simuPOP::stringList *) &arg13_defvalue ;
+  simuPOP::uintList const &arg14_defvalue = simuPOP::uintList() ;
+  simuPOP::uintList *arg14 = (simuPOP::uintList *) &arg14_defvalue ;
   int res1 = SWIG_OLDOBJ ;
   int res2 = SWIG_OLDOBJ ;
   int res3 = SWIG_OLDOBJ ;
@@ -53608,6 +54542,8 @@ SWIGINTERN PyObject *_wrap_loadPedigree(PyObject *SWIGUNUSEDPARM(self), PyObject
   int res12 = 0 ;
   void *argp13 = 0 ;
   int res13 = 0 ;
+  void *argp14 = 0 ;
+  int res14 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
@@ -53621,12 +54557,13 @@ SWIGINTERN PyObject *_wrap_loadPedigree(PyObject *SWIGUNUSEDPARM(self), PyObject
   PyObject * obj10 = 0 ;
   PyObject * obj11 = 0 ;
   PyObject * obj12 = 0 ;
+  PyObject * obj13 = 0 ;
   char *  kwnames[] = {
-    (char *) "file",(char *) "idField",(char *) "fatherField",(char *) "motherField",(char *) "ploidy",(char *) "loci",(char *) "chromTypes",(char *) "lociPos",(char *) "chromNames",(char *) "alleleNames",(char *) "lociNames",(char *) "subPopNames",(char *) "infoFields", NULL 
+    (char *) "file",(char *) "idField",(char *) "fatherField",(char *) "motherField",(char *) "ploidy",(char *) "loci",(char *) "chromTypes",(char *) "lociPos",(char *) "chromNames",(char *) "alleleNames",(char *) "lociNames",(char *) "subPopNames",(char *) "infoFields",(char *) "ancGens", NULL 
   };
   SwigValueWrapper< simuPOP::Pedigree > result;
   
-  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"O|OOOOOOOOOOOO:loadPedigree",kwnames,&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8,&obj9,&obj10,&obj11,&obj12)) SWIG_fail;
+  if (!PyArg_ParseTupleAndKeywords(args,kwargs,(char *)"O|OOOOOOOOOOOOO:loadPedigree",kwnames,&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8,&obj9,&obj10,&obj11,&obj12,&obj13)) SWIG_fail;
   {
     std::string *ptr = (std::string *)0;
     res1 = SWIG_AsPtr_std_string(obj0, &ptr);
@@ -53764,10 +54701,20 @@ SWIGINTERN PyObject *_wrap_loadPedigree(PyObject *SWIGUNUSEDPARM(self), PyObject
     }
     arg13 = reinterpret_cast< simuPOP::stringList * >(argp13);
   }
+  if (obj13) {
+    res14 = SWIG_ConvertPtr(obj13, &argp14, SWIGTYPE_p_simuPOP__uintList,  0  | SWIG_POINTER_IMPLICIT_CONV);
+    if (!SWIG_IsOK(res14)) {
+      SWIG_exception_fail(SWIG_ArgError(res14), "in method '" "loadPedigree" "', argument " "14"" of type '" "simuPOP::uintList const &""'"); 
+    }
+    if (!argp14) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "loadPedigree" "', argument " "14"" of type '" "simuPOP::uintList const &""'"); 
+    }
+    arg14 = reinterpret_cast< simuPOP::uintList * >(argp14);
+  }
   {
     try
     {
-      result = simuPOP::loadPedigree((std::string const &)*arg1,(std::string const &)*arg2,(std::string const &)*arg3,(std::string const &)*arg4,arg5,(simuPOP::uintList const &)*arg6,(simuPOP::uintList const &)*arg7,(simuPOP::floatList const &)*arg8,(simuPOP::stringList const &)*arg9,(simuPOP::stringMatrix const &)*arg10,(simuPOP::stringList const &)*arg11,(simuPOP::stringList const &)*arg12,(simuPOP::stringList const &)*arg13);
+      result = simuPOP::loadPedigree((std::string const &)*arg1,(std::string const &)*arg2,(std::string const &)*arg3,(std::string const &)*arg4,arg5,(simuPOP::uintList const &)*arg6,(simuPOP::uintList const &)*arg7,(simuPOP::floatList const &)*arg8,(simuPOP::stringList const &)*arg9,(simuPOP::stringMatrix const &)*arg10,(simuPOP::stringList const &)*arg11,(simuPOP::stringList const &)*arg12,(simuPOP::stringList const &)*arg13,(simuPOP::uintList const &)*arg14);
     }
     catch(simuPOP::StopIteration e)
     {
@@ -53812,6 +54759,7 @@ SWIGINTERN PyObject *_wrap_loadPedigree(PyObject *SWIGUNUSEDPARM(self), PyObject
   if (SWIG_IsNewObj(res11)) delete arg11;
   if (SWIG_IsNewObj(res12)) delete arg12;
   if (SWIG_IsNewObj(res13)) delete arg13;
+  if (SWIG_IsNewObj(res14)) delete arg14;
   return resultobj;
 fail:
   if (SWIG_IsNewObj(res1)) delete arg1;
@@ -53826,6 +54774,7 @@ fail:
   if (SWIG_IsNewObj(res11)) delete arg11;
   if (SWIG_IsNewObj(res12)) delete arg12;
   if (SWIG_IsNewObj(res13)) delete arg13;
+  if (SWIG_IsNewObj(res14)) delete arg14;
   return NULL;
 }
 
@@ -53927,7 +54876,7 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Usage:\n"
 		"\n"
-		"    setOptions(numThreads=-1, name=None, seed=0)\n"
+		"    setOptions(numThreads=-1, name=None, seed=0, firstTouch=-1)\n"
 		"\n"
 		"Details:\n"
 		"\n"
@@ -53937,7 +54886,14 @@ static PyMethodDef SwigMethods[] = {
 		"    environmental variable OMP_NUM_THREADS. Second and third argument\n"
 		"    is to set the type or seed of existing random number generator\n"
 		"    using RNGname with seed. If using openMP, it sets the type or seed\n"
-		"    of random number generator of each thread.\n"
+		"    of random number generator of each thread. If firstTouch is set to\n"
+		"    1, newly allocated genotype, lineage and information field buffers\n"
+		"    of populations are first written by the threads that will later\n"
+		"    generate offspring into them, so that their memory pages are\n"
+		"    placed on the NUMA nodes of these threads (Linux only). This\n"
+		"    policy can be turned off by setting firstTouch to 0, and is left\n"
+		"    unchanged by the default value -1. The current policy is available\n"
+		"    from moduleInfo()['firstTouch'].\n"
 		"\n"
 		"\n"
 		""},
@@ -55725,6 +56681,88 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"delete_GenotypeSplitter", (PyCFunction)_wrap_delete_GenotypeSplitter, METH_O, NULL},
 	 { (char *)"GenotypeSplitter_swigregister", GenotypeSplitter_swigregister, METH_VARARGS, NULL},
 	 { (char *)"GenotypeSplitter_swiginit", GenotypeSplitter_swiginit, METH_VARARGS, NULL},
+	 { (char *)"Genealogy_describe", (PyCFunction) _wrap_Genealogy_describe, METH_VARARGS | METH_KEYWORDS, (char *)"Obsolete or undocumented function."},
+	 { (char *)"Genealogy_nodes", (PyCFunction)_wrap_Genealogy_nodes, METH_O, (char *)"\n"
+		"\n"
+		"\n"
+		"Usage:\n"
+		"\n"
+		"    x.nodes()\n"
+		"\n"
+		"Details:\n"
+		"\n"
+		"    Return the node table as a list of (node, time) pairs.\n"
+		"\n"
+		"\n"
+		""},
+	 { (char *)"Genealogy_edges", (PyCFunction)_wrap_Genealogy_edges, METH_O, (char *)"\n"
+		"\n"
+		"\n"
+		"Usage:\n"
+		"\n"
+		"    x.edges()\n"
+		"\n"
+		"Details:\n"
+		"\n"
+		"    Return the edge table as a list of (left, right, parent, child)\n"
+		"    tuples, sorted by parent, child and left position.\n"
+		"\n"
+		"\n"
+		""},
+	 { (char *)"Genealogy_samples", (PyCFunction)_wrap_Genealogy_samples, METH_O, (char *)"\n"
+		"\n"
+		"\n"
+		"Usage:\n"
+		"\n"
+		"    x.samples()\n"
+		"\n"
+		"Details:\n"
+		"\n"
+		"    Return a list of nodes of the present generation, namely nodes of\n"
+		"    individuals in the population when the genealogy was last\n"
+		"    committed or simplified.\n"
+		"\n"
+		"\n"
+		""},
+	 { (char *)"Genealogy_simplify", (PyCFunction) _wrap_Genealogy_simplify, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
+		"\n"
+		"\n"
+		"Usage:\n"
+		"\n"
+		"    x.simplify(pop)\n"
+		"\n"
+		"Details:\n"
+		"\n"
+		"    Remove nodes and edges that do not contribute genetic material to\n"
+		"    individuals in the present generation of population pop, and trim\n"
+		"    the remaining edges to the inherited regions. Nodes of the present\n"
+		"    generation are marked as samples.\n"
+		"\n"
+		"\n"
+		""},
+	 { (char *)"Genealogy_mutate", (PyCFunction) _wrap_Genealogy_mutate, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
+		"\n"
+		"\n"
+		"Usage:\n"
+		"\n"
+		"    x.mutate(rate)\n"
+		"\n"
+		"Details:\n"
+		"\n"
+		"    Place neutral mutations on the genealogy with rate mutations per\n"
+		"    locus per generation. Mutations are placed on each edge according\n"
+		"    to a Poisson distribution with mean rate * (right - left) *\n"
+		"    (time(child) - time(parent)), at positions uniformly distributed\n"
+		"    in [left, right), so that a mutation at position x lies between\n"
+		"    loci int(x) and int(x) + 1. This function returns a list of (pos,\n"
+		"    node, carriers) where node is the child node of the edge on which\n"
+		"    the mutation happens, and carriers is a list of samples that\n"
+		"    inherit the mutation.\n"
+		"\n"
+		"\n"
+		""},
+	 { (char *)"delete_Genealogy", (PyCFunction)_wrap_delete_Genealogy, METH_O, NULL},
+	 { (char *)"Genealogy_swigregister", Genealogy_swigregister, METH_VARARGS, NULL},
 	 { (char *)"new_pyIndIterator", (PyCFunction) _wrap_new_pyIndIterator, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
 		"\n"
 		"\n"
@@ -56789,6 +57827,46 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"\n"
 		""},
+	 { (char *)"Population_recordGenealogy", (PyCFunction) _wrap_Population_recordGenealogy, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
+		"\n"
+		"\n"
+		"Usage:\n"
+		"\n"
+		"    x.recordGenealogy(idField=\"ind_id\", simplifyInterval=0)\n"
+		"\n"
+		"Details:\n"
+		"\n"
+		"    Start recording the genealogy of this population during evolution.\n"
+		"    Individuals in the present generation are added as founder nodes,\n"
+		"    and genotype transmitters will record how offspring inherit\n"
+		"    segments of parental chromosomes in subsequent generations.\n"
+		"    Individuals are identified by information field idField (default\n"
+		"    to ind_id), which should hold unique IDs for all individuals (e.g.\n"
+		"    assigned by an IdTagger during mating). If a positive\n"
+		"    simplifyInterval is given, the genealogy will be simplified every\n"
+		"    simplifyInterval generations so that only the ancestry of the\n"
+		"    present generation is kept. Existing records are discarded if this\n"
+		"    function is called again. Please refer to class Genealogy for\n"
+		"    details.\n"
+		"\n"
+		"\n"
+		""},
+	 { (char *)"Population_genealogy", (PyCFunction)_wrap_Population_genealogy, METH_O, (char *)"\n"
+		"\n"
+		"\n"
+		"Usage:\n"
+		"\n"
+		"    x.genealogy()\n"
+		"\n"
+		"Details:\n"
+		"\n"
+		"    Return the genealogy that is being recorded for this population. A\n"
+		"    ValueError will be raised if the genealogy of this population is\n"
+		"    not recorded. Note that the genealogy is not saved with the\n"
+		"    population.\n"
+		"\n"
+		"\n"
+		""},
 	 { (char *)"Population_useAncestralGen", (PyCFunction) _wrap_Population_useAncestralGen, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
 		"\n"
 		"\n"
@@ -57905,7 +58983,7 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Usage:\n"
 		"\n"
-		"    Simulator(pops, rep=1, stealPops=True)\n"
+		"    Simulator(pops, rep=1, stealPops=True, shareGenotype=False)\n"
 		"\n"
 		"Details:\n"
 		"\n"
@@ -57916,7 +58994,11 @@ static PyMethodDef SwigMethods[] = {
 		"    duplication of potentially large population objects, leaving empty\n"
 		"    populations behind. This behavior can be changed by setting\n"
 		"    stealPops to False, in which case populations are copied to the\n"
-		"    simulator.\n"
+		"    simulator. If shareGenotype is set to True, replicates share the\n"
+		"    genotypes of all generations of a population until the genotypes\n"
+		"    of a replicate are changed (copy-on-write). This saves memory and\n"
+		"    time if replicates of a large population are mated before their\n"
+		"    genotypes are changed.\n"
 		"\n"
 		"\n"
 		""},
@@ -58872,7 +59954,7 @@ static PyMethodDef SwigMethods[] = {
 		"Usage:\n"
 		"\n"
 		"    SavePopulation(output=\"\", begin=0, end=-1, step=1, at=[],\n"
-		"      reps=ALL_AVAIL, subPops=ALL_AVAIL, infoFields=[])\n"
+		"      reps=ALL_AVAIL, subPops=ALL_AVAIL, infoFields=[], background=0)\n"
 		"\n"
 		"Details:\n"
 		"\n"
@@ -58881,9 +59963,16 @@ static PyMethodDef SwigMethods[] = {
 		"    specifications ('', 'filename', 'filename' prefixed by one or more\n"
 		"    '>' characters, and '!expr') but output from different operators\n"
 		"    will always replace existing files (effectively ignore '>'\n"
-		"    specification). Parameter subPops is ignored. Please refer to\n"
-		"    class BaseOperator for a detailed description about common\n"
-		"    operator parameters such as stage and begin.\n"
+		"    specification). If background is set to a positive number, this\n"
+		"    operator copies the population and saves the copy in a background\n"
+		"    thread so that the evolutionary process can continue while the\n"
+		"    population is being written. At most background populations can be\n"
+		"    saved at the same time (the operator waits for the oldest one if\n"
+		"    more are needed) and all of them are saved when function evolve\n"
+		"    returns. Background saving is not supported under windows.\n"
+		"    Parameter subPops is ignored. Please refer to class BaseOperator\n"
+		"    for a detailed description about common operator parameters such\n"
+		"    as stage and begin.\n"
 		"\n"
 		"\n"
 		""},
@@ -60612,6 +61701,41 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"delete_PyQuanTrait", (PyCFunction)_wrap_delete_PyQuanTrait, METH_O, NULL},
 	 { (char *)"PyQuanTrait_swigregister", PyQuanTrait_swigregister, METH_VARARGS, NULL},
 	 { (char *)"PyQuanTrait_swiginit", PyQuanTrait_swiginit, METH_VARARGS, NULL},
+	 { (char *)"new_AdditiveQuanTrait", (PyCFunction) _wrap_new_AdditiveQuanTrait, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
+		"\n"
+		"\n"
+		"Usage:\n"
+		"\n"
+		"    AdditiveQuanTrait(loci, effects, dominance=[], envVar=0,\n"
+		"      ancGens=UNSPECIFIED, begin=0, end=-1, step=1, at=[],\n"
+		"      reps=ALL_AVAIL, subPops=ALL_AVAIL, infoFields=[])\n"
+		"\n"
+		"Details:\n"
+		"\n"
+		"    Create an additive quantitative trait operator for specified loci,\n"
+		"    which can be a list of loci indexes, names, or ALL_AVAIL. Effects\n"
+		"    of alleles are specified as a list of effects of alleles 0, 1, ...\n"
+		"    for each locus (parameter effects), or a single list that applies\n"
+		"    to all loci. Alleles without specified effect have no effect. The\n"
+		"    genotypic value of an individual is the sum of effects of all its\n"
+		"    alleles at these loci. If a dominance coefficient d is given for a\n"
+		"    locus (parameter dominance, one for all loci or one for each\n"
+		"    locus), the value of a heterozygote with alleles of effects a and\n"
+		"    b is a + b + d * |a - b| so that d=0 (default) is additive, d=1 is\n"
+		"    complete dominance of the allele with larger effect and d=-1 is\n"
+		"    complete dominance of the allele with smaller effect. Alleles on\n"
+		"    the second homologous copy of chromosome X of male, on chromosome\n"
+		"    Y of female, and on the second homologous copy of mitochondrial\n"
+		"    chromosomes and haplodiploid males are ignored. If a positive\n"
+		"    environmental variance envVar is specified, a random value drawn\n"
+		"    from N(0, envVar) will be added to the genotypic value. The trait\n"
+		"    value will be assigned to the only trait field (infoFields).\n"
+		"\n"
+		"\n"
+		""},
+	 { (char *)"delete_AdditiveQuanTrait", (PyCFunction)_wrap_delete_AdditiveQuanTrait, METH_O, NULL},
+	 { (char *)"AdditiveQuanTrait_swigregister", AdditiveQuanTrait_swigregister, METH_VARARGS, NULL},
+	 { (char *)"AdditiveQuanTrait_swiginit", AdditiveQuanTrait_swiginit, METH_VARARGS, NULL},
 	 { (char *)"new_BasePenetrance", (PyCFunction) _wrap_new_BasePenetrance, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
 		"\n"
 		"\n"
@@ -60910,7 +62034,7 @@ static PyMethodDef SwigMethods[] = {
 		"\n"
 		"Usage:\n"
 		"\n"
-		"    x.save(filename, infoFields=[], loci=[])\n"
+		"    x.save(filename, infoFields=[], loci=[], format=\"text\")\n"
 		"\n"
 		"Details:\n"
 		"\n"
@@ -60929,7 +62053,18 @@ static PyMethodDef SwigMethods[] = {
 		"    have to be unique. Note that parental IDs will be set to zero if\n"
 		"    the parent is not in the pedigree object. Therefore, the parents\n"
 		"    of individuals in the top-most ancestral generation will always be\n"
-		"    zero.\n"
+		"    zero.  If format is set to 'binary' (or 'binary.gz'), the pedigree\n"
+		"    is saved in a binary format with a header that describes the\n"
+		"    genotypic structure of saved loci, names of information fields,\n"
+		"    and the location of each generation in the file, followed by each\n"
+		"    generation with columns of IDs, parental IDs, sex and affection\n"
+		"    status, a matrix of information fields, and bit- or byte-packed\n"
+		"    genotypes at specified loci (saved in the order of loci indexes).\n"
+		"    Generations are compressed separately if 'binary.gz' is used.\n"
+		"    Binary files can be loaded using function loadPedigree, which\n"
+		"    reads the genotypic structure and names of information fields from\n"
+		"    the file, and can load selected generations without reading the\n"
+		"    rest of the file.\n"
 		"\n"
 		"\n"
 		""},
@@ -61140,7 +62275,7 @@ static PyMethodDef SwigMethods[] = {
 		"    loadPedigree(file, idField=\"ind_id\", fatherField=\"father_id\",\n"
 		"      motherField=\"mother_id\", ploidy=2, loci=[], chromTypes=[],\n"
 		"      lociPos=[], chromNames=[], alleleNames=[], lociNames=[],\n"
-		"      subPopNames=[], infoFields=[])\n"
+		"      subPopNames=[], infoFields=[], ancGens=[])\n"
 		"\n"
 		"Details:\n"
 		"\n"
@@ -61180,7 +62315,14 @@ static PyMethodDef SwigMethods[] = {
 		"    chromTypes, lociPos, chromNames, alleleNames, lociNames could be\n"
 		"    used to specified the genotype structured of the loaded pedigree.\n"
 		"    Please refer to class Population for details about these\n"
-		"    parameters.\n"
+		"    parameters.  If the file is saved by function Pedigree.save in\n"
+		"    binary format, generations are loaded as they are saved, and the\n"
+		"    genotypic structure and names of information fields are read from\n"
+		"    the file. Parameter infoFields can be used to rename all saved\n"
+		"    information fields. In both cases, parameter ancGens can be used\n"
+		"    to load only specified ancestral generations (default to all\n"
+		"    generations), and only these generations are read from binary\n"
+		"    files.\n"
 		"\n"
 		"\n"
 		""},
@@ -61418,6 +62560,9 @@ static void *_p_simuPOP__IfElseTo_p_simuPOP__BaseOperator(void *x, int *SWIGUNUS
 static void *_p_simuPOP__InfoEvalTo_p_simuPOP__BaseOperator(void *x, int *SWIGUNUSEDPARM(newmemory)) {
     return (void *)((simuPOP::BaseOperator *)  ((simuPOP::InfoEval *) x));
 }
+static void *_p_simuPOP__AdditiveQuanTraitTo_p_simuPOP__BaseOperator(void *x, int *SWIGUNUSEDPARM(newmemory)) {
+    return (void *)((simuPOP::BaseOperator *) (simuPOP::BaseQuanTrait *) ((simuPOP::AdditiveQuanTrait *) x));
+}
 static void *_p_simuPOP__ControlledOffspringGeneratorTo_p_simuPOP__OffspringGenerator(void *x, int *SWIGUNUSEDPARM(newmemory)) {
     return (void *)((simuPOP::OffspringGenerator *)  ((simuPOP::ControlledOffspringGenerator *) x));
 }
@@ -61457,6 +62602,9 @@ static void *_p_simuPOP__PyMlSelectorTo_p_simuPOP__BaseSelector(void *x, int *SW
 static void *_p_simuPOP__PyQuanTraitTo_p_simuPOP__BaseQuanTrait(void *x, int *SWIGUNUSEDPARM(newmemory)) {
     return (void *)((simuPOP::BaseQuanTrait *)  ((simuPOP::PyQuanTrait *) x));
 }
+static void *_p_simuPOP__AdditiveQuanTraitTo_p_simuPOP__BaseQuanTrait(void *x, int *SWIGUNUSEDPARM(newmemory)) {
+    return (void *)((simuPOP::BaseQuanTrait *)  ((simuPOP::AdditiveQuanTrait *) x));
+}
 static void *_p_simuPOP__PopulationTo_p_simuPOP__GenoStruTrait(void *x, int *SWIGUNUSEDPARM(newmemory)) {
     return (void *)((simuPOP::GenoStruTrait *)  ((simuPOP::Population *) x));
 }
@@ -61620,6 +62768,7 @@ static swig_type_info _swigt__p_reference = {"_p_reference", "reference *", 0, 0
 static swig_type_info _swigt__p_second_type = {"_p_second_type", "second_type *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_short = {"_p_short", "short *|int_least16_t *|int16_t *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_signed_char = {"_p_signed_char", "signed char *|int_least8_t *|int_fast8_t *|int8_t *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_simuPOP__AdditiveQuanTrait = {"_p_simuPOP__AdditiveQuanTrait", "simuPOP::AdditiveQuanTrait *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_simuPOP__AffectionSplitter = {"_p_simuPOP__AffectionSplitter", "simuPOP::AffectionSplitter *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_simuPOP__BackwardMigrator = {"_p_simuPOP__BackwardMigrator", "simuPOP::BackwardMigrator *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_simuPOP__BaseMutator = {"_p_simuPOP__BaseMutator", "simuPOP::BaseMutator *", 0, 0, (void*)0, 0};
@@ -61641,6 +62790,7 @@ static swig_type_info _swigt__p_simuPOP__DiscardIf = {"_p_simuPOP__DiscardIf", "
 static swig_type_info _swigt__p_simuPOP__Dumper = {"_p_simuPOP__Dumper", "simuPOP::Dumper *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_simuPOP__Exception = {"_p_simuPOP__Exception", "simuPOP::Exception *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_simuPOP__FiniteSitesMutator = {"_p_simuPOP__FiniteSitesMutator", "simuPOP::FiniteSitesMutator *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_simuPOP__Genealogy = {"_p_simuPOP__Genealogy", "simuPOP::Genealogy *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_simuPOP__GenoStruTrait = {"_p_simuPOP__GenoStruTrait", "simuPOP::GenoStruTrait *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_simuPOP__GenoTransmitter = {"_p_simuPOP__GenoTransmitter", "simuPOP::GenoTransmitter *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_simuPOP__GenotypeSplitter = {"_p_simuPOP__GenotypeSplitter", "simuPOP::GenotypeSplitter *", 0, 0, (void*)0, 0};
@@ -61836,6 +62986,7 @@ static swig_type_info *swig_type_initial[] = {
   &_swigt__p_second_type,
   &_swigt__p_short,
   &_swigt__p_signed_char,
+  &_swigt__p_simuPOP__AdditiveQuanTrait,
   &_swigt__p_simuPOP__AffectionSplitter,
   &_swigt__p_simuPOP__BackwardMigrator,
   &_swigt__p_simuPOP__BaseMutator,
@@ -61861,6 +63012,7 @@ static swig_type_info *swig_type_initial[] = {
   &_swigt__p_simuPOP__FiniteSitesMutator,
   &_swigt__p_simuPOP__FuncNumOffModel,
   &_swigt__p_simuPOP__FuncSexModel,
+  &_swigt__p_simuPOP__Genealogy,
   &_swigt__p_simuPOP__GenoStruTrait,
   &_swigt__p_simuPOP__GenoTransmitter,
   &_swigt__p_simuPOP__GenotypeSplitter,
@@ -62052,12 +63204,13 @@ static swig_cast_info _swigc__p_reference[] = {  {&_swigt__p_reference, 0, 0, 0}
 static swig_cast_info _swigc__p_second_type[] = {  {&_swigt__p_second_type, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_short[] = {  {&_swigt__p_short, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_signed_char[] = {  {&_swigt__p_signed_char, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_simuPOP__AdditiveQuanTrait[] = {  {&_swigt__p_simuPOP__AdditiveQuanTrait, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__AffectionSplitter[] = {  {&_swigt__p_simuPOP__AffectionSplitter, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__BackwardMigrator[] = {  {&_swigt__p_simuPOP__BackwardMigrator, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__BaseMutator[] = {  {&_swigt__p_simuPOP__BaseMutator, 0, 0, 0},  {&_swigt__p_simuPOP__MatrixMutator, _p_simuPOP__MatrixMutatorTo_p_simuPOP__BaseMutator, 0, 0},  {&_swigt__p_simuPOP__KAlleleMutator, _p_simuPOP__KAlleleMutatorTo_p_simuPOP__BaseMutator, 0, 0},  {&_swigt__p_simuPOP__StepwiseMutator, _p_simuPOP__StepwiseMutatorTo_p_simuPOP__BaseMutator, 0, 0},  {&_swigt__p_simuPOP__PyMutator, _p_simuPOP__PyMutatorTo_p_simuPOP__BaseMutator, 0, 0},  {&_swigt__p_simuPOP__MixedMutator, _p_simuPOP__MixedMutatorTo_p_simuPOP__BaseMutator, 0, 0},  {&_swigt__p_simuPOP__ContextMutator, _p_simuPOP__ContextMutatorTo_p_simuPOP__BaseMutator, 0, 0},{0, 0, 0, 0}};
-static swig_cast_info _swigc__p_simuPOP__BaseOperator[] = {  {&_swigt__p_simuPOP__InitSex, _p_simuPOP__InitSexTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InitGenotype, _p_simuPOP__InitGenotypeTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__Recombinator, _p_simuPOP__RecombinatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__SavePopulation, _p_simuPOP__SavePopulationTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__RevertIf, _p_simuPOP__RevertIfTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__IfElse, _p_simuPOP__IfElseTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BackwardMigrator, _p_simuPOP__BackwardMigratorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__Migrator, _p_simuPOP__MigratorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyEval, _p_simuPOP__PyEvalTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__RevertFixedSites, _p_simuPOP__RevertFixedSitesTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__TerminateIf, _p_simuPOP__TerminateIfTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__Pause, _p_simuPOP__PauseTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InheritTagger, _p_simuPOP__InheritTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__IdTagger, _p_simuPOP__IdTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InitLineage, _p_simuPOP__InitLineageTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyOperator, _p_simuPOP__PyOperatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BaseOperator, 0, 0, 0},  {&_swigt__p_simuPOP__DiscardIf, _p_simuPOP__DiscardIfTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__ResizeSubPops, _p_simuPOP__ResizeSubPopsTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MergeSubPops, _p_simuPOP__MergeSubPopsTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__SplitSubPops, _p_simuPOP__SplitSubPopsTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BasePenetrance, _p_simuPOP__BasePenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MapPenetrance, _p_simuPOP__MapPenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MaPenetrance, _p_simuPOP__MaPenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MlPenetrance, _p_simuPOP__MlPenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyPenetrance, _p_simuPOP__PyPenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyMlPenetrance, _p_simuPOP__PyMlPenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__Stat, _p_simuPOP__StatTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InfoExec, _p_simuPOP__InfoExecTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InitInfo, _p_simuPOP__InitInfoTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__KAlleleMutator, _p_simuPOP__KAlleleMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MatrixMutator, _p_simuPOP__MatrixMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BaseMutator, _p_simuPOP__BaseMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__StepwiseMutator, _p_simuPOP__StepwiseMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyMutator, _p_simuPOP__PyMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MixedMutator, _p_simuPOP__MixedMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__ContextMutator, _p_simuPOP__ContextMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PointMutator, _p_simuPOP__PointMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__FiniteSitesMutator, _p_simuPOP__FiniteSitesMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BaseSelector, _p_simuPOP__BaseSelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MapSelector, _p_simuPOP__MapSelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MaSelector, _p_simuPOP__MaSelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MlSelector, _p_simuPOP__MlSelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PySelector, _p_simuPOP__PySelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyMlSelector, _p_simuPOP__PyMlSelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__GenoTransmitter, _p_simuPOP__GenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__CloneGenoTransmitter, _p_simuPOP__CloneGenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MendelianGenoTransmitter, _p_simuPOP__MendelianGenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__SelfingGenoTransmitter, _p_simuPOP__SelfingGenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__HaplodiploidGenoTransmitter, _p_simuPOP__HaplodiploidGenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MitochondrialGenoTransmitter, _p_simuPOP__MitochondrialGenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__Dumper, _p_simuPOP__DumperTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyTagger, _p_simuPOP__PyTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PedigreeTagger, _p_simuPOP__PedigreeTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__OffspringTagger, _p_simuPOP__OffspringTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__ParentsTagger, _p_simuPOP__ParentsTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__SummaryTagger, _p_simuPOP__SummaryTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__TicToc, _p_simuPOP__TicTocTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__NoneOp, _p_simuPOP__NoneOpTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BaseQuanTrait, _p_simuPOP__BaseQuanTraitTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyQuanTrait, _p_simuPOP__PyQuanTraitTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyExec, _p_simuPOP__PyExecTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyOutput, _p_simuPOP__PyOutputTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InfoEval, _p_simuPOP__InfoEvalTo_p_simuPOP__BaseOperator, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_simuPOP__BaseOperator[] = {  {&_swigt__p_simuPOP__InitSex, _p_simuPOP__InitSexTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InitGenotype, _p_simuPOP__InitGenotypeTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__Recombinator, _p_simuPOP__RecombinatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__SavePopulation, _p_simuPOP__SavePopulationTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__RevertIf, _p_simuPOP__RevertIfTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__IfElse, _p_simuPOP__IfElseTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BackwardMigrator, _p_simuPOP__BackwardMigratorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__Migrator, _p_simuPOP__MigratorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyEval, _p_simuPOP__PyEvalTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__RevertFixedSites, _p_simuPOP__RevertFixedSitesTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__TerminateIf, _p_simuPOP__TerminateIfTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__Pause, _p_simuPOP__PauseTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InheritTagger, _p_simuPOP__InheritTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__IdTagger, _p_simuPOP__IdTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InitLineage, _p_simuPOP__InitLineageTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyOperator, _p_simuPOP__PyOperatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BaseOperator, 0, 0, 0},  {&_swigt__p_simuPOP__DiscardIf, _p_simuPOP__DiscardIfTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__ResizeSubPops, _p_simuPOP__ResizeSubPopsTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MergeSubPops, _p_simuPOP__MergeSubPopsTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__SplitSubPops, _p_simuPOP__SplitSubPopsTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BasePenetrance, _p_simuPOP__BasePenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MapPenetrance, _p_simuPOP__MapPenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MaPenetrance, _p_simuPOP__MaPenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MlPenetrance, _p_simuPOP__MlPenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyPenetrance, _p_simuPOP__PyPenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyMlPenetrance, _p_simuPOP__PyMlPenetranceTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__Stat, _p_simuPOP__StatTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InfoExec, _p_simuPOP__InfoExecTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InitInfo, _p_simuPOP__InitInfoTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__KAlleleMutator, _p_simuPOP__KAlleleMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MatrixMutator, _p_simuPOP__MatrixMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BaseMutator, _p_simuPOP__BaseMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__StepwiseMutator, _p_simuPOP__StepwiseMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyMutator, _p_simuPOP__PyMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MixedMutator, _p_simuPOP__MixedMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__ContextMutator, _p_simuPOP__ContextMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PointMutator, _p_simuPOP__PointMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__FiniteSitesMutator, _p_simuPOP__FiniteSitesMutatorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BaseSelector, _p_simuPOP__BaseSelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MapSelector, _p_simuPOP__MapSelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MaSelector, _p_simuPOP__MaSelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MlSelector, _p_simuPOP__MlSelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PySelector, _p_simuPOP__PySelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyMlSelector, _p_simuPOP__PyMlSelectorTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__GenoTransmitter, _p_simuPOP__GenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__CloneGenoTransmitter, _p_simuPOP__CloneGenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MendelianGenoTransmitter, _p_simuPOP__MendelianGenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__SelfingGenoTransmitter, _p_simuPOP__SelfingGenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__HaplodiploidGenoTransmitter, _p_simuPOP__HaplodiploidGenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__MitochondrialGenoTransmitter, _p_simuPOP__MitochondrialGenoTransmitterTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__Dumper, _p_simuPOP__DumperTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyTagger, _p_simuPOP__PyTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PedigreeTagger, _p_simuPOP__PedigreeTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__OffspringTagger, _p_simuPOP__OffspringTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__ParentsTagger, _p_simuPOP__ParentsTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__SummaryTagger, _p_simuPOP__SummaryTaggerTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__TicToc, _p_simuPOP__TicTocTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__NoneOp, _p_simuPOP__NoneOpTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__BaseQuanTrait, _p_simuPOP__BaseQuanTraitTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyQuanTrait, _p_simuPOP__PyQuanTraitTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyExec, _p_simuPOP__PyExecTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__PyOutput, _p_simuPOP__PyOutputTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__InfoEval, _p_simuPOP__InfoEvalTo_p_simuPOP__BaseOperator, 0, 0},  {&_swigt__p_simuPOP__AdditiveQuanTrait, _p_simuPOP__AdditiveQuanTraitTo_p_simuPOP__BaseOperator, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__BasePenetrance[] = {  {&_swigt__p_simuPOP__BasePenetrance, 0, 0, 0},  {&_swigt__p_simuPOP__MapPenetrance, _p_simuPOP__MapPenetranceTo_p_simuPOP__BasePenetrance, 0, 0},  {&_swigt__p_simuPOP__MaPenetrance, _p_simuPOP__MaPenetranceTo_p_simuPOP__BasePenetrance, 0, 0},  {&_swigt__p_simuPOP__MlPenetrance, _p_simuPOP__MlPenetranceTo_p_simuPOP__BasePenetrance, 0, 0},  {&_swigt__p_simuPOP__PyPenetrance, _p_simuPOP__PyPenetranceTo_p_simuPOP__BasePenetrance, 0, 0},  {&_swigt__p_simuPOP__PyMlPenetrance, _p_simuPOP__PyMlPenetranceTo_p_simuPOP__BasePenetrance, 0, 0},{0, 0, 0, 0}};
-static swig_cast_info _swigc__p_simuPOP__BaseQuanTrait[] = {  {&_swigt__p_simuPOP__BaseQuanTrait, 0, 0, 0},  {&_swigt__p_simuPOP__PyQuanTrait, _p_simuPOP__PyQuanTraitTo_p_simuPOP__BaseQuanTrait, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_simuPOP__BaseQuanTrait[] = {  {&_swigt__p_simuPOP__BaseQuanTrait, 0, 0, 0},  {&_swigt__p_simuPOP__PyQuanTrait, _p_simuPOP__PyQuanTraitTo_p_simuPOP__BaseQuanTrait, 0, 0},  {&_swigt__p_simuPOP__AdditiveQuanTrait, _p_simuPOP__AdditiveQuanTraitTo_p_simuPOP__BaseQuanTrait, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__BaseSelector[] = {  {&_swigt__p_simuPOP__BaseSelector, 0, 0, 0},  {&_swigt__p_simuPOP__MapSelector, _p_simuPOP__MapSelectorTo_p_simuPOP__BaseSelector, 0, 0},  {&_swigt__p_simuPOP__MaSelector, _p_simuPOP__MaSelectorTo_p_simuPOP__BaseSelector, 0, 0},  {&_swigt__p_simuPOP__MlSelector, _p_simuPOP__MlSelectorTo_p_simuPOP__BaseSelector, 0, 0},  {&_swigt__p_simuPOP__PySelector, _p_simuPOP__PySelectorTo_p_simuPOP__BaseSelector, 0, 0},  {&_swigt__p_simuPOP__PyMlSelector, _p_simuPOP__PyMlSelectorTo_p_simuPOP__BaseSelector, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__BaseVspSplitter[] = {  {&_swigt__p_simuPOP__BaseVspSplitter, 0, 0, 0},  {&_swigt__p_simuPOP__CombinedSplitter, _p_simuPOP__CombinedSplitterTo_p_simuPOP__BaseVspSplitter, 0, 0},  {&_swigt__p_simuPOP__ProductSplitter, _p_simuPOP__ProductSplitterTo_p_simuPOP__BaseVspSplitter, 0, 0},  {&_swigt__p_simuPOP__SexSplitter, _p_simuPOP__SexSplitterTo_p_simuPOP__BaseVspSplitter, 0, 0},  {&_swigt__p_simuPOP__AffectionSplitter, _p_simuPOP__AffectionSplitterTo_p_simuPOP__BaseVspSplitter, 0, 0},  {&_swigt__p_simuPOP__InfoSplitter, _p_simuPOP__InfoSplitterTo_p_simuPOP__BaseVspSplitter, 0, 0},  {&_swigt__p_simuPOP__ProportionSplitter, _p_simuPOP__ProportionSplitterTo_p_simuPOP__BaseVspSplitter, 0, 0},  {&_swigt__p_simuPOP__RangeSplitter, _p_simuPOP__RangeSplitterTo_p_simuPOP__BaseVspSplitter, 0, 0},  {&_swigt__p_simuPOP__GenotypeSplitter, _p_simuPOP__GenotypeSplitterTo_p_simuPOP__BaseVspSplitter, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__Bernullitrials[] = {  {&_swigt__p_simuPOP__Bernullitrials, 0, 0, 0},{0, 0, 0, 0}};
@@ -62073,6 +63226,7 @@ static swig_cast_info _swigc__p_simuPOP__DiscardIf[] = {  {&_swigt__p_simuPOP__D
 static swig_cast_info _swigc__p_simuPOP__Dumper[] = {  {&_swigt__p_simuPOP__Dumper, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__Exception[] = {  {&_swigt__p_simuPOP__StopEvolution, _p_simuPOP__StopEvolutionTo_p_simuPOP__Exception, 0, 0},  {&_swigt__p_simuPOP__RevertEvolution, _p_simuPOP__RevertEvolutionTo_p_simuPOP__Exception, 0, 0},  {&_swigt__p_simuPOP__Exception, 0, 0, 0},  {&_swigt__p_simuPOP__StopIteration, _p_simuPOP__StopIterationTo_p_simuPOP__Exception, 0, 0},  {&_swigt__p_simuPOP__ValueError, _p_simuPOP__ValueErrorTo_p_simuPOP__Exception, 0, 0},  {&_swigt__p_simuPOP__RuntimeError, _p_simuPOP__RuntimeErrorTo_p_simuPOP__Exception, 0, 0},  {&_swigt__p_simuPOP__SystemError, _p_simuPOP__SystemErrorTo_p_simuPOP__Exception, 0, 0},  {&_swigt__p_simuPOP__IndexError, _p_simuPOP__IndexErrorTo_p_simuPOP__Exception, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__FiniteSitesMutator[] = {  {&_swigt__p_simuPOP__FiniteSitesMutator, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_simuPOP__Genealogy[] = {  {&_swigt__p_simuPOP__Genealogy, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__GenoStruTrait[] = {  {&_swigt__p_simuPOP__Population, _p_simuPOP__PopulationTo_p_simuPOP__GenoStruTrait, 0, 0},  {&_swigt__p_simuPOP__Pedigree, _p_simuPOP__PedigreeTo_p_simuPOP__GenoStruTrait, 0, 0},  {&_swigt__p_simuPOP__GenoStruTrait, 0, 0, 0},  {&_swigt__p_simuPOP__Individual, _p_simuPOP__IndividualTo_p_simuPOP__GenoStruTrait, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__GenoTransmitter[] = {  {&_swigt__p_simuPOP__Recombinator, _p_simuPOP__RecombinatorTo_p_simuPOP__GenoTransmitter, 0, 0},  {&_swigt__p_simuPOP__GenoTransmitter, 0, 0, 0},  {&_swigt__p_simuPOP__CloneGenoTransmitter, _p_simuPOP__CloneGenoTransmitterTo_p_simuPOP__GenoTransmitter, 0, 0},  {&_swigt__p_simuPOP__MendelianGenoTransmitter, _p_simuPOP__MendelianGenoTransmitterTo_p_simuPOP__GenoTransmitter, 0, 0},  {&_swigt__p_simuPOP__SelfingGenoTransmitter, _p_simuPOP__SelfingGenoTransmitterTo_p_simuPOP__GenoTransmitter, 0, 0},  {&_swigt__p_simuPOP__HaplodiploidGenoTransmitter, _p_simuPOP__HaplodiploidGenoTransmitterTo_p_simuPOP__GenoTransmitter, 0, 0},  {&_swigt__p_simuPOP__MitochondrialGenoTransmitter, _p_simuPOP__MitochondrialGenoTransmitterTo_p_simuPOP__GenoTransmitter, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_simuPOP__GenotypeSplitter[] = {  {&_swigt__p_simuPOP__GenotypeSplitter, 0, 0, 0},{0, 0, 0, 0}};
@@ -62268,6 +63422,7 @@ static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_second_type,
   _swigc__p_short,
   _swigc__p_signed_char,
+  _swigc__p_simuPOP__AdditiveQuanTrait,
   _swigc__p_simuPOP__AffectionSplitter,
   _swigc__p_simuPOP__BackwardMigrator,
   _swigc__p_simuPOP__BaseMutator,
@@ -62293,6 +63448,7 @@ static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_simuPOP__FiniteSitesMutator,
   _swigc__p_simuPOP__FuncNumOffModel,
   _swigc__p_simuPOP__FuncSexModel,
+  _swigc__p_simuPOP__Genealogy,
   _swigc__p_simuPOP__GenoStruTrait,
   _swigc__p_simuPOP__GenoTransmitter,
   _swigc__p_simuPOP__GenotypeSplitter,
@@ -33,6 +33,7 @@
 #include "simuPOP_cfg.h"
 #include "genoStru.h"
 #include "individual.h"
+#include "genealogy.h"
 #include "population.h"
 #include "pedigree.h"
 #include "virtualSubPop.h"
@@ -309,6 +310,7 @@ namespace std
 }
 
 %include "virtualSubPop.h"
+%include "genealogy.h"
 %include "population.h"
 
 namespace std {
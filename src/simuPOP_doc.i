@@ -1,3 +1,59 @@
+%feature("docstring") simuPOP::AdditiveQuanTrait "
+
+Details:
+
+    This quantitative trait operator assigns a trait field as the sum
+    of genotypic values of alleles at a list of loci, plus an optional
+    normally distributed environmental deviation. Genotypic values are
+    calculated in C++ and, if multiple threads are used, in parallel,
+    so this operator can be used for polygenic traits with a large
+    number of loci.
+
+"; 
+
+%feature("docstring") simuPOP::AdditiveQuanTrait::AdditiveQuanTrait "
+
+Usage:
+
+    AdditiveQuanTrait(loci, effects, dominance=[], envVar=0,
+      ancGens=UNSPECIFIED, begin=0, end=-1, step=1, at=[],
+      reps=ALL_AVAIL, subPops=ALL_AVAIL, infoFields=[])
+
+Details:
+
+    Create an additive quantitative trait operator for specified loci,
+    which can be a list of loci indexes, names, or ALL_AVAIL. Effects
+    of alleles are specified as a list of effects of alleles 0, 1, ...
+    for each locus (parameter effects), or a single list that applies
+    to all loci. Alleles without specified effect have no effect. The
+    genotypic value of an individual is the sum of effects of all its
+    alleles at these loci. If a dominance coefficient d is given for a
+    locus (parameter dominance, one for all loci or one for each
+    locus), the value of a heterozygote with alleles of effects a and
+    b is a + b + d * |a - b| so that d=0 (default) is additive, d=1 is
+    complete dominance of the allele with larger effect and d=-1 is
+    complete dominance of the allele with smaller effect. Alleles on
+    the second homologous copy of chromosome X of male, on chromosome
+    Y of female, and on the second homologous copy of mitochondrial
+    chromosomes and haplodiploid males are ignored. If a positive
+    environmental variance envVar is specified, a random value drawn
+    from N(0, envVar) will be added to the genotypic value. The trait
+    value will be assigned to the only trait field (infoFields).
+
+"; 
+
+%feature("docstring") simuPOP::AdditiveQuanTrait::apply "Obsolete or undocumented function."
+
+%feature("docstring") simuPOP::AdditiveQuanTrait::clone "Obsolete or undocumented function."
+
+%feature("docstring") simuPOP::AdditiveQuanTrait::describe "Obsolete or undocumented function."
+
+%ignore simuPOP::AdditiveQuanTrait::parallelizable() const;
+
+%ignore simuPOP::AdditiveQuanTrait::prepareDuringMating(Population &pop, Population &offPop, RawIndIterator offBegin, RawIndIterator offEnd) const;
+
+%ignore simuPOP::AdditiveQuanTrait::qtrait(Individual *ind, size_t gen, vectorf &traits) const;
+
 %feature("docstring") simuPOP::AffectionSplitter "
 
 Details:
@@ -438,6 +494,8 @@ Details:
 
 %ignore simuPOP::BaseOperator::parallelizable() const;
 
+%ignore simuPOP::BaseOperator::prepareDuringMating(Population &pop, Population &offPop, RawIndIterator offBegin, RawIndIterator offEnd) const;
+
 %feature("docstring") simuPOP::BaseOperator::~BaseOperator "
 
 Description:
@@ -808,6 +866,8 @@ Details:
 
 "; 
 
+%ignore simuPOP::BaseVspSplitter::prepare(const Population &pop) const;
+
 %ignore simuPOP::BaseVspSplitter::size(const Population &pop, size_t subPop, size_t virtualSubPop) const;
 
 %feature("docstring") simuPOP::BaseVspSplitter::vspByName "
@@ -1369,6 +1429,8 @@ Details:
 
 "; 
 
+%ignore simuPOP::CombinedSplitter::prepare(const Population &pop) const;
+
 %ignore simuPOP::CombinedSplitter::size(const Population &pop, size_t subPop, size_t virtualSubPop) const;
 
 %feature("docstring") simuPOP::CombinedSplitter::~CombinedSplitter "
@@ -1576,6 +1638,8 @@ Details:
 
 %ignore simuPOP::ControlledOffspringGenerator::initialize(const Population &pop, size_t subPop);
 
+%ignore simuPOP::DiploidLociCounts;
+
 %feature("docstring") simuPOP::DiscardIf "
 
 Details:
@@ -1931,6 +1995,124 @@ Usage:
 
 "; 
 
+%feature("docstring") simuPOP::Genealogy "
+
+Details:
+
+    A genealogy records how haplotypes are inherited from parents to
+    offspring during evolution, in the form of a node table and an
+    edge table. Each homologous set of chromosomes of an individual is
+    a node, identified by ID * ploidy + p where ID is the value of an
+    information field that stores unique individual IDs (e.g. set by
+    an IdTagger) and p is the index of the homologous set. The time of
+    a node is the number of generations since recording started. Each
+    edge (left, right, parent, child) states that loci [left, right)
+    of node child are copied from node parent.
+
+    A genealogy is created by function Population.recordGenealogy and
+    is filled by genotype transmitters (MendelianGenoTransmitter,
+    SelfingGenoTransmitter, HaplodiploidGenoTransmitter,
+    CloneGenoTransmitter and Recombinator) during mating. Because only
+    the ancestry of the present generation is usually of interest, the
+    genealogy can be simplified (periodically, or by calling function
+    simplify) to remove nodes and edges that do not contribute genetic
+    material to the present generation. Neutral mutations can then be
+    placed on the recorded genealogy after evolution (function mutate)
+    so that only loci under selection need to be simulated forward in
+    time.
+
+"; 
+
+%ignore simuPOP::Genealogy::Genealogy(const string &idField, size_t simplifyInterval);
+
+%ignore simuPOP::Genealogy::addEdge(const Individual &parent, size_t parPloidy, size_t offIdx, size_t ploidy, size_t left, size_t right);
+
+%ignore simuPOP::Genealogy::addNodes(const Population &pop);
+
+%ignore simuPOP::Genealogy::clone() const;
+
+%ignore simuPOP::Genealogy::commit(const Population &offPop);
+
+%feature("docstring") simuPOP::Genealogy::describe "Obsolete or undocumented function."
+
+%feature("docstring") simuPOP::Genealogy::edges "
+
+Usage:
+
+    x.edges()
+
+Details:
+
+    Return the edge table as a list of (left, right, parent, child)
+    tuples, sorted by parent, child and left position.
+
+"; 
+
+%feature("docstring") simuPOP::Genealogy::mutate "
+
+Usage:
+
+    x.mutate(rate)
+
+Details:
+
+    Place neutral mutations on the genealogy with rate mutations per
+    locus per generation. Mutations are placed on each edge according
+    to a Poisson distribution with mean rate * (right - left) *
+    (time(child) - time(parent)), at positions uniformly distributed
+    in [left, right), so that a mutation at position x lies between
+    loci int(x) and int(x) + 1. This function returns a list of (pos,
+    node, carriers) where node is the child node of the edge on which
+    the mutation happens, and carriers is a list of samples that
+    inherit the mutation.
+
+"; 
+
+%feature("docstring") simuPOP::Genealogy::nodes "
+
+Usage:
+
+    x.nodes()
+
+Details:
+
+    Return the node table as a list of (node, time) pairs.
+
+"; 
+
+%ignore simuPOP::Genealogy::prepare();
+
+%feature("docstring") simuPOP::Genealogy::samples "
+
+Usage:
+
+    x.samples()
+
+Details:
+
+    Return a list of nodes of the present generation, namely nodes of
+    individuals in the population when the genealogy was last
+    committed or simplified.
+
+"; 
+
+%feature("docstring") simuPOP::Genealogy::simplify "
+
+Usage:
+
+    x.simplify(pop)
+
+Details:
+
+    Remove nodes and edges that do not contribute genetic material to
+    individuals in the present generation of population pop, and trim
+    the remaining edges to the inherited regions. Nodes of the present
+    generation are marked as samples.
+
+"; 
+
+%ignore simuPOP::Genealogy::Edge;
+
 %feature("docstring") simuPOP::GenoStruTrait "
 
 Details:
@@ -2595,6 +2777,8 @@ Usage:
 
 "; 
 
+%ignore simuPOP::GenotypeSplitter::prepare(const Population &pop) const;
+
 %ignore simuPOP::GenotypeSplitter::size(const Population &pop, size_t subPop, size_t virtualSubPop) const;
 
 %ignore simuPOP::GeometricNumOffModel;
@@ -2665,6 +2849,8 @@ Usage:
 
 "; 
 
+%ignore simuPOP::HWETestCache;
+
 %feature("docstring") simuPOP::HaplodiploidGenoTransmitter "
 
 Details:
@@ -2866,10 +3052,14 @@ Details:
     for parentship. If you would like to reset the sequence or start
     from a different number, you can call the reset(startID) function
     of any IdTagger.  An IdTagger is usually used during-mating to
-    assign ID to each offspring. However, if it is applied directly to
-    a population, it will assign unique IDs to all individuals in this
-    population. This property is usually used in the preOps parameter
-    of function Simulator.evolve to assign initial ID to a population.
+    assign ID to each offspring. IDs are reserved in blocks for all
+    offspring of a subpopulation so that offspring of a subpopulation
+    receive consecutive IDs, in the order they are stored, regardless
+    of the number of threads used. However, if it is applied directly
+    to a population, it will assign unique IDs to all individuals in
+    this population. This property is usually used in the preOps
+    parameter of function Simulator.evolve to assign initial ID to a
+    population.
 
 "; 
 
@@ -2891,6 +3081,8 @@ Details:
 
 "; 
 
+%ignore simuPOP::IdTagger::IdTagger(const IdTagger &rhs);
+
 %feature("docstring") simuPOP::IdTagger::apply "Obsolete or undocumented function."
 
 %ignore simuPOP::IdTagger::applyDuringMating(Population &pop, Population &offPop, RawIndIterator offspring, Individual *dad=NULL, Individual *mom=NULL) const;
@@ -2901,6 +3093,8 @@ Details:
 
 %ignore simuPOP::IdTagger::parallelizable() const;
 
+%ignore simuPOP::IdTagger::prepareDuringMating(Population &pop, Population &offPop, RawIndIterator offBegin, RawIndIterator offEnd) const;
+
 %feature("docstring") simuPOP::IdTagger::reset "
 
 Usage:
@@ -2997,6 +3191,8 @@ Usage:
 
 "; 
 
+%ignore simuPOP::IndBuffers;
+
 %feature("docstring") simuPOP::Individual "
 
 Details:
@@ -3097,6 +3293,8 @@ Details:
 
 "; 
 
+%ignore simuPOP::Individual::bufferIdx() const;
+
 %feature("docstring") simuPOP::Individual::cmp "
 
 Description:
@@ -3111,8 +3309,6 @@ Usage:
 
 %ignore simuPOP::Individual::copyFrom(const Individual &rhs);
 
-%ignore simuPOP::Individual::display(ostream &out, int width=1, const vectoru &loci=vectoru(), const vectoru &infoIdx=vectoru());
-
 %ignore simuPOP::Individual::firstOffspring() const;
 
 %ignore simuPOP::Individual::genoAtLoci(const lociList &loci);
@@ -3129,6 +3325,8 @@ Usage:
 
 %ignore simuPOP::Individual::genoPtr() const;
 
+%ignore simuPOP::Individual::genoSlot() const;
+
 %feature("docstring") simuPOP::Individual::genotype "
 
 Usage:
@@ -3167,6 +3365,8 @@ Details:
 
 %ignore simuPOP::Individual::infoPtr() const;
 
+%ignore simuPOP::Individual::infoSlot() const;
+
 %ignore simuPOP::Individual::intInfo(const uintString &field) const;
 
 %feature("docstring") simuPOP::Individual::lineage "
@@ -3259,9 +3459,11 @@ Details:
 
 "; 
 
+%ignore simuPOP::Individual::setBufferIdx(size_t idx);
+
 %ignore simuPOP::Individual::setFirstOffspring(bool first) const;
 
-%ignore simuPOP::Individual::setGenoPtr(GenoIterator pos);
+%ignore simuPOP::Individual::setGenoSlot(size_t slot);
 
 %feature("docstring") simuPOP::Individual::setGenotype "
 
@@ -3296,7 +3498,7 @@ Details:
 
 "; 
 
-%ignore simuPOP::Individual::setInfoPtr(InfoIterator pos);
+%ignore simuPOP::Individual::setInfoSlot(size_t slot);
 
 %feature("docstring") simuPOP::Individual::setLineage "
 
@@ -3331,6 +3533,8 @@ Details:
 
 "; 
 
+%ignore simuPOP::Individual::setSlot(size_t idx, size_t slot);
+
 %ignore simuPOP::Individual::setVisible(bool visible) const;
 
 %feature("docstring") simuPOP::Individual::sex "
@@ -3347,6 +3551,8 @@ Details:
 
 %ignore simuPOP::Individual::swap(Individual &ind, bool swapContent=true);
 
+%ignore simuPOP::Individual::validIndex(size_t idx, size_t p, size_t ch) const;
+
 %ignore simuPOP::Individual::visible() const;
 
 %feature("docstring") simuPOP::Individual::~Individual "
@@ -4689,6 +4895,8 @@ Usage:
 
 "; 
 
+%ignore simuPOP::MutantRegistry;
+
 %ignore simuPOP::NoSexModel;
 
 %feature("docstring") simuPOP::NoSexModel::NoSexModel "
@@ -4989,6 +5197,8 @@ Details:
 
 %ignore simuPOP::OffspringGenerator::parallelizable() const;
 
+%ignore simuPOP::OffspringGenerator::prepareOffspring(Population &pop, Population &offPop, RawIndIterator offBegin, RawIndIterator offEnd);
+
 %feature("docstring") simuPOP::OffspringGenerator::~OffspringGenerator "
 
 Usage:
@@ -5320,6 +5530,8 @@ Details:
 
 "; 
 
+%ignore simuPOP::Pedigree::fatherIdx() const;
+
 %ignore simuPOP::Pedigree::fatherOf(size_t id) const;
 
 %ignore simuPOP::Pedigree::idIdx() const;
@@ -5467,6 +5679,8 @@ Details:
 
 %feature("docstring") simuPOP::Pedigree::mergeSubPops "Obsolete or undocumented function."
 
+%ignore simuPOP::Pedigree::motherIdx() const;
+
 %ignore simuPOP::Pedigree::motherOf(size_t id) const;
 
 %feature("docstring") simuPOP::Pedigree::numParents "Obsolete or undocumented function."
@@ -5483,7 +5697,7 @@ Details:
 
 Usage:
 
-    x.save(filename, infoFields=[], loci=[])
+    x.save(filename, infoFields=[], loci=[], format=\"text\")
 
 Details:
 
@@ -5502,7 +5716,18 @@ Details:
     have to be unique. Note that parental IDs will be set to zero if
     the parent is not in the pedigree object. Therefore, the parents
     of individuals in the top-most ancestral generation will always be
-    zero.
+    zero.  If format is set to 'binary' (or 'binary.gz'), the pedigree
+    is saved in a binary format with a header that describes the
+    genotypic structure of saved loci, names of information fields,
+    and the location of each generation in the file, followed by each
+    generation with columns of IDs, parental IDs, sex and affection
+    status, a matrix of information fields, and bit- or byte-packed
+    genotypes at specified loci (saved in the order of loci indexes).
+    Generations are compressed separately if 'binary.gz' is used.
+    Binary files can be loaded using function loadPedigree, which
+    reads the genotypic structure and names of information fields from
+    the file, and can load selected generations without reading the
+    rest of the file.
 
 "; 
 
@@ -6139,6 +6364,8 @@ Details:
 
 "; 
 
+%ignore simuPOP::Population::cloneSharingGenotype() const;
+
 %feature("docstring") simuPOP::Population::cmp "
 
 Description:
@@ -6155,6 +6382,8 @@ Usage:
 
 %feature("docstring") simuPOP::Population::deactivateVirtualSubPop "Obsolete or undocumented function."
 
+%ignore simuPOP::Population::detachGenotype() const;
+
 %ignore simuPOP::Population::dict(vspID subPop=vspID());
 
 %feature("docstring") simuPOP::Population::dvars "
@@ -6239,6 +6468,23 @@ Details:
 
 %ignore simuPOP::Population::gen() const;
 
+%feature("docstring") simuPOP::Population::genealogy "
+
+Usage:
+
+    x.genealogy()
+
+Details:
+
+    Return the genealogy that is being recorded for this population. A
+    ValueError will be raised if the genealogy of this population is
+    not recorded. Note that the genealogy is not saved with the
+    population.
+
+"; 
+
+%ignore simuPOP::Population::genealogyRecorder() const;
+
 %ignore simuPOP::Population::genoBegin(bool order);
 
 %ignore simuPOP::Population::genoBegin(size_t subPop, bool order);
@@ -6401,6 +6647,8 @@ Details:
 
 "; 
 
+%ignore simuPOP::Population::mutantRegistry();
+
 %feature("docstring") simuPOP::Population::mutants "
 
 Usage:
@@ -6523,6 +6771,29 @@ Details:
 
 "; 
 
+%feature("docstring") simuPOP::Population::recordGenealogy "
+
+Usage:
+
+    x.recordGenealogy(idField=\"ind_id\", simplifyInterval=0)
+
+Details:
+
+    Start recording the genealogy of this population during evolution.
+    Individuals in the present generation are added as founder nodes,
+    and genotype transmitters will record how offspring inherit
+    segments of parental chromosomes in subsequent generations.
+    Individuals are identified by information field idField (default
+    to ind_id), which should hold unique IDs for all individuals (e.g.
+    assigned by an IdTagger during mating). If a positive
+    simplifyInterval is given, the genealogy will be simplified every
+    simplifyInterval generations so that only the ancestry of the
+    present generation is kept. Existing records are discarded if this
+    function is called again. Please refer to class Genealogy for
+    details.
+
+"; 
+
 %feature("docstring") simuPOP::Population::removeIndividuals "
 
 Usage:
@@ -6766,6 +7037,8 @@ Details:
 
 "; 
 
+%ignore simuPOP::Population::snapshot() const;
+
 %feature("docstring") simuPOP::Population::sortIndividuals "
 
 Usage:
@@ -7113,6 +7386,8 @@ Details:
 
 "; 
 
+%ignore simuPOP::ProductSplitter::prepare(const Population &pop) const;
+
 %ignore simuPOP::ProductSplitter::size(const Population &pop, size_t subPop, size_t virtualSubPop) const;
 
 %feature("docstring") simuPOP::ProductSplitter::~ProductSplitter "
@@ -8689,7 +8964,7 @@ Details:
 Usage:
 
     SavePopulation(output=\"\", begin=0, end=-1, step=1, at=[],
-      reps=ALL_AVAIL, subPops=ALL_AVAIL, infoFields=[])
+      reps=ALL_AVAIL, subPops=ALL_AVAIL, infoFields=[], background=0)
 
 Details:
 
@@ -8698,9 +8973,16 @@ Details:
     specifications ('', 'filename', 'filename' prefixed by one or more
     '>' characters, and '!expr') but output from different operators
     will always replace existing files (effectively ignore '>'
-    specification). Parameter subPops is ignored. Please refer to
-    class BaseOperator for a detailed description about common
-    operator parameters such as stage and begin.
+    specification). If background is set to a positive number, this
+    operator copies the population and saves the copy in a background
+    thread so that the evolutionary process can continue while the
+    population is being written. At most background populations can be
+    saved at the same time (the operator waits for the oldest one if
+    more are needed) and all of them are saved when function evolve
+    returns. Background saving is not supported under windows.
+    Parameter subPops is ignored. Please refer to class BaseOperator
+    for a detailed description about common operator parameters such
+    as stage and begin.
 
 "; 
 
@@ -9052,7 +9334,7 @@ Details:
 
 Usage:
 
-    Simulator(pops, rep=1, stealPops=True)
+    Simulator(pops, rep=1, stealPops=True, shareGenotype=False)
 
 Details:
 
@@ -9063,7 +9345,11 @@ Details:
     duplication of potentially large population objects, leaving empty
     populations behind. This behavior can be changed by setting
     stealPops to False, in which case populations are copied to the
-    simulator.
+    simulator. If shareGenotype is set to True, replicates share the
+    genotypes of all generations of a population until the genotypes
+    of a replicate are changed (copy-on-write). This saves memory and
+    time if replicates of a large population are mated before their
+    genotypes are changed.
 
 "; 
 
@@ -10322,6 +10608,8 @@ Details:
 
 %ignore simuPOP::cnull();
 
+%ignore simuPOP::countDiploidLoci(const Population &pop, const vector< const Individual * > &inds, const vectoru &loci, vectoru &genoCnt, vectoru &IBSCnt, vectoru &IBDCnt, vector< char > &general);
+
 %ignore simuPOP::debug(DBG_CODE code);
 
 %feature("docstring") simuPOP::describeEvolProcess "
@@ -10349,8 +10637,12 @@ Usage:
 
 "; 
 
+%ignore simuPOP::fetchAndAdd(ATOMICLONG *val, ATOMICLONG n);
+
 %ignore simuPOP::fetchAndIncrement(ATOMICLONG *val);
 
+%ignore simuPOP::firstTouch();
+
 %feature("docstring") simuPOP::floatList "
 
 "; 
@@ -10484,7 +10776,7 @@ Usage:
     loadPedigree(file, idField=\"ind_id\", fatherField=\"father_id\",
       motherField=\"mother_id\", ploidy=2, loci=[], chromTypes=[],
       lociPos=[], chromNames=[], alleleNames=[], lociNames=[],
-      subPopNames=[], infoFields=[])
+      subPopNames=[], infoFields=[], ancGens=[])
 
 Details:
 
@@ -10524,7 +10816,14 @@ Details:
     chromTypes, lociPos, chromNames, alleleNames, lociNames could be
     used to specified the genotype structured of the loaded pedigree.
     Please refer to class Population for details about these
-    parameters.
+    parameters.  If the file is saved by function Pedigree.save in
+    binary format, generations are loaded as they are saved, and the
+    genotypic structure and names of information fields are read from
+    the file. Parameter infoFields can be used to rename all saved
+    information fields. In both cases, parameter ancGens can be used
+    to load only specified ancestral generations (default to all
+    generations), and only these generations are read from binary
+    files.
 
 "; 
 
@@ -10609,6 +10908,8 @@ Details:
     *   maxNumSubPop: maximum number of subpopulations.
     *   maxIndex: maximum index size (limits population size * total
     number of marker).
+    *   firstTouch: Whether or not population buffers are placed by
+    the threads that first write to them (True or False).
     *   debug: A dictionary with debugging codes as keys and the
     status of each debugging code (True or False) as their values.
 
@@ -10960,13 +11261,15 @@ Usage:
 
 %ignore simuPOP::pyPopPointer(PyObject *p);
 
+%ignore simuPOP::releasePages(void *begin, size_t size);
+
 %ignore simuPOP::repeatedWarning(const string &message);
 
 %feature("docstring") simuPOP::setOptions "
 
 Usage:
 
-    setOptions(numThreads=-1, name=None, seed=0)
+    setOptions(numThreads=-1, name=None, seed=0, firstTouch=-1)
 
 Details:
 
@@ -10976,7 +11279,14 @@ Details:
     environmental variable OMP_NUM_THREADS. Second and third argument
     is to set the type or seed of existing random number generator
     using RNGname with seed. If using openMP, it sets the type or seed
-    of random number generator of each thread.
+    of random number generator of each thread. If firstTouch is set to
+    1, newly allocated genotype, lineage and information field buffers
+    of populations are first written by the threads that will later
+    generate offspring into them, so that their memory pages are
+    placed on the NUMA nodes of these threads (Linux only). This
+    policy can be turned off by setting firstTouch to 0, and is left
+    unchanged by the default value -1. The current policy is available
+    from moduleInfo()['firstTouch'].
 
 "; 
 
@@ -11831,5 +12141,7 @@ Usage:
 
 "; 
 
+%ignore simuPOP::waitForBackgroundSaves();
+
 %ignore std::powthree(unsigned n);
 
@@ -344,13 +344,13 @@ def elapsedTime(name: 'string const &') -> "void":
     """
     return _simuPOP_lin.elapsedTime(name)
 
-def setOptions(numThreads: 'int const'=-1, name: 'char const *'=None, seed: 'unsigned long'=0) -> "void":
+def setOptions(numThreads: 'int const'=-1, name: 'char const *'=None, seed: 'unsigned long'=0, firstTouch: 'int const'=-1) -> "void":
     """
 
 
     Usage:
 
-        setOptions(numThreads=-1, name=None, seed=0)
+        setOptions(numThreads=-1, name=None, seed=0, firstTouch=-1)
 
     Details:
 
@@ -360,11 +360,18 @@ def setOptions(numThreads: 'int const'=-1, name: 'char const *'=None, seed: 'uns
         environmental variable OMP_NUM_THREADS. Second and third argument
         is to set the type or seed of existing random number generator
         using RNGname with seed. If using openMP, it sets the type or seed
-        of random number generator of each thread.
+        of random number generator of each thread. If firstTouch is set to
+        1, newly allocated genotype, lineage and information field buffers
+        of populations are first written by the threads that will later
+        generate offspring into them, so that their memory pages are
+        placed on the NUMA nodes of these threads (Linux only). This
+        policy can be turned off by setting firstTouch to 0, and is left
+        unchanged by the default value -1. The current policy is available
+        from moduleInfo()['firstTouch'].
 
 
     """
-    return _simuPOP_lin.setOptions(numThreads, name, seed)
+    return _simuPOP_lin.setOptions(numThreads, name, seed, firstTouch)
 
 def simuPOP_kbhit() -> "int":
     return _simuPOP_lin.simuPOP_kbhit()
@@ -2557,7 +2564,6 @@ class Individual(GenoStruTrait):
         """
         return _simuPOP_lin.Individual_setInfo(self, value, field)
 
-Individual.setLineagePtr = new_instancemethod(_simuPOP_lin.Individual_setLineagePtr, None, Individual)
 Individual.lineagePtr = new_instancemethod(_simuPOP_lin.Individual_lineagePtr, None, Individual)
 Individual.allele = new_instancemethod(_simuPOP_lin.Individual_allele, None, Individual)
 Individual.alleleChar = new_instancemethod(_simuPOP_lin.Individual_alleleChar, None, Individual)
@@ -3147,6 +3153,156 @@ class GenotypeSplitter(BaseVspSplitter):
 GenotypeSplitter_swigregister = _simuPOP_lin.GenotypeSplitter_swigregister
 GenotypeSplitter_swigregister(GenotypeSplitter)
 
+class Genealogy(object):
+    """
+
+
+    Details:
+
+        A genealogy records how haplotypes are inherited from parents to
+        offspring during evolution, in the form of a node table and an
+        edge table. Each homologous set of chromosomes of an individual is
+        a node, identified by ID * ploidy + p where ID is the value of an
+        information field that stores unique individual IDs (e.g. set by
+        an IdTagger) and p is the index of the homologous set. The time of
+        a node is the number of generations since recording started. Each
+        edge (left, right, parent, child) states that loci [left, right)
+        of node child are copied from node parent.
+
+        A genealogy is created by function Population.recordGenealogy and
+        is filled by genotype transmitters (MendelianGenoTransmitter,
+        SelfingGenoTransmitter, HaplodiploidGenoTransmitter,
+        CloneGenoTransmitter and Recombinator) during mating. Because only
+        the ancestry of the present generation is usually of interest, the
+        genealogy can be simplified (periodically, or by calling function
+        simplify) to remove nodes and edges that do not contribute genetic
+        material to the present generation. Neutral mutations can then be
+        placed on the recorded genealogy after evolution (function mutate)
+        so that only loci under selection need to be simulated forward in
+        time.
+
+
+    """
+
+    thisown = _swig_property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
+
+    def __init__(self, *args, **kwargs):
+        raise AttributeError("No constructor defined")
+    __repr__ = _swig_repr
+
+    def describe(self, format: 'bool'=True) -> "string":
+        """Obsolete or undocumented function."""
+        return _simuPOP_lin.Genealogy_describe(self, format)
+
+
+    def nodes(self) -> "PyObject *":
+        """
+
+
+        Usage:
+
+            x.nodes()
+
+        Details:
+
+            Return the node table as a list of (node, time) pairs.
+
+
+        """
+        return _simuPOP_lin.Genealogy_nodes(self)
+
+
+    def edges(self) -> "PyObject *":
+        """
+
+
+        Usage:
+
+            x.edges()
+
+        Details:
+
+            Return the edge table as a list of (left, right, parent, child)
+            tuples, sorted by parent, child and left position.
+
+
+        """
+        return _simuPOP_lin.Genealogy_edges(self)
+
+
+    def samples(self) -> "vectoru":
+        """
+
+
+        Usage:
+
+            x.samples()
+
+        Details:
+
+            Return a list of nodes of the present generation, namely nodes of
+            individuals in the population when the genealogy was last
+            committed or simplified.
+
+
+        """
+        return _simuPOP_lin.Genealogy_samples(self)
+
+
+    def simplify(self, pop: 'Population') -> "void":
+        """
+
+
+        Usage:
+
+            x.simplify(pop)
+
+        Details:
+
+            Remove nodes and edges that do not contribute genetic material to
+            individuals in the present generation of population pop, and trim
+            the remaining edges to the inherited regions. Nodes of the present
+            generation are marked as samples.
+
+
+        """
+        return _simuPOP_lin.Genealogy_simplify(self, pop)
+
+
+    def mutate(self, rate: 'double') -> "PyObject *":
+        """
+
+
+        Usage:
+
+            x.mutate(rate)
+
+        Details:
+
+            Place neutral mutations on the genealogy with rate mutations per
+            locus per generation. Mutations are placed on each edge according
+            to a Poisson distribution with mean rate * (right - left) *
+            (time(child) - time(parent)), at positions uniformly distributed
+            in [left, right), so that a mutation at position x lies between
+            loci int(x) and int(x) + 1. This function returns a list of (pos,
+            node, carriers) where node is the child node of the edge on which
+            the mutation happens, and carriers is a list of samples that
+            inherit the mutation.
+
+
+        """
+        return _simuPOP_lin.Genealogy_mutate(self, rate)
+
+    __swig_destroy__ = _simuPOP_lin.delete_Genealogy
+Genealogy.describe = new_instancemethod(_simuPOP_lin.Genealogy_describe, None, Genealogy)
+Genealogy.nodes = new_instancemethod(_simuPOP_lin.Genealogy_nodes, None, Genealogy)
+Genealogy.edges = new_instancemethod(_simuPOP_lin.Genealogy_edges, None, Genealogy)
+Genealogy.samples = new_instancemethod(_simuPOP_lin.Genealogy_samples, None, Genealogy)
+Genealogy.simplify = new_instancemethod(_simuPOP_lin.Genealogy_simplify, None, Genealogy)
+Genealogy.mutate = new_instancemethod(_simuPOP_lin.Genealogy_mutate, None, Genealogy)
+Genealogy_swigregister = _simuPOP_lin.Genealogy_swigregister
+Genealogy_swigregister(Genealogy)
+
 class pyIndIterator(object):
     """
 
@@ -4483,6 +4639,54 @@ class Population(GenoStruTrait):
         """
         return _simuPOP_lin.Population_setAncestralDepth(self, depth)
 
+    def recordGenealogy(self, *args, **kwargs) -> "void":
+        """
+
+
+        Usage:
+
+            x.recordGenealogy(idField="ind_id", simplifyInterval=0)
+
+        Details:
+
+            Start recording the genealogy of this population during evolution.
+            Individuals in the present generation are added as founder nodes,
+            and genotype transmitters will record how offspring inherit
+            segments of parental chromosomes in subsequent generations.
+            Individuals are identified by information field idField (default
+            to ind_id), which should hold unique IDs for all individuals (e.g.
+            assigned by an IdTagger during mating). If a positive
+            simplifyInterval is given, the genealogy will be simplified every
+            simplifyInterval generations so that only the ancestry of the
+            present generation is kept. Existing records are discarded if this
+            function is called again. Please refer to class Genealogy for
+            details.
+
+
+        """
+        return _simuPOP_lin.Population_recordGenealogy(self, *args, **kwargs)
+
+
+    def genealogy(self) -> "simuPOP::Genealogy &":
+        """
+
+
+        Usage:
+
+            x.genealogy()
+
+        Details:
+
+            Return the genealogy that is being recorded for this population. A
+            ValueError will be raised if the genealogy of this population is
+            not recorded. Note that the genealogy is not saved with the
+            population.
+
+
+        """
+        return _simuPOP_lin.Population_genealogy(self)
+
+
 
     def useAncestralGen(self, idx: 'ssize_t') -> "void":
         """
@@ -4624,6 +4828,8 @@ Population.setInfoFields = new_instancemethod(_simuPOP_lin.Population_setInfoFie
 Population.removeInfoFields = new_instancemethod(_simuPOP_lin.Population_removeInfoFields, None, Population)
 Population.updateInfoFieldsFrom = new_instancemethod(_simuPOP_lin.Population_updateInfoFieldsFrom, None, Population)
 Population.setAncestralDepth = new_instancemethod(_simuPOP_lin.Population_setAncestralDepth, None, Population)
+Population.recordGenealogy = new_instancemethod(_simuPOP_lin.Population_recordGenealogy, None, Population)
+Population.genealogy = new_instancemethod(_simuPOP_lin.Population_genealogy, None, Population)
 Population.useAncestralGen = new_instancemethod(_simuPOP_lin.Population_useAncestralGen, None, Population)
 Population.save = new_instancemethod(_simuPOP_lin.Population_save, None, Population)
 Population.vars = new_instancemethod(_simuPOP_lin.Population_vars, None, Population)
@@ -6177,13 +6383,13 @@ class Simulator(object):
     thisown = _swig_property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
     __repr__ = _swig_repr
 
-    def __init__(self, pops: 'PyObject *', rep: 'UINT'=1, stealPops: 'bool'=True):
+    def __init__(self, pops: 'PyObject *', rep: 'UINT'=1, stealPops: 'bool'=True, shareGenotype: 'bool'=False):
         """
 
 
         Usage:
 
-            Simulator(pops, rep=1, stealPops=True)
+            Simulator(pops, rep=1, stealPops=True, shareGenotype=False)
 
         Details:
 
@@ -6194,11 +6400,15 @@ class Simulator(object):
             duplication of potentially large population objects, leaving empty
             populations behind. This behavior can be changed by setting
             stealPops to False, in which case populations are copied to the
-            simulator.
+            simulator. If shareGenotype is set to True, replicates share the
+            genotypes of all generations of a population until the genotypes
+            of a replicate are changed (copy-on-write). This saves memory and
+            time if replicates of a large population are mated before their
+            genotypes are changed.
 
 
         """
-        _simuPOP_lin.Simulator_swiginit(self, _simuPOP_lin.new_Simulator(pops, rep, stealPops))
+        _simuPOP_lin.Simulator_swiginit(self, _simuPOP_lin.new_Simulator(pops, rep, stealPops, shareGenotype))
     __swig_destroy__ = _simuPOP_lin.delete_Simulator
 
     def clone(self) -> "simuPOP::Simulator *":
@@ -7283,7 +7493,7 @@ class SavePopulation(BaseOperator):
         Usage:
 
             SavePopulation(output="", begin=0, end=-1, step=1, at=[],
-              reps=ALL_AVAIL, subPops=ALL_AVAIL, infoFields=[])
+              reps=ALL_AVAIL, subPops=ALL_AVAIL, infoFields=[], background=0)
 
         Details:
 
@@ -7292,9 +7502,16 @@ class SavePopulation(BaseOperator):
             specifications ('', 'filename', 'filename' prefixed by one or more
             '>' characters, and '!expr') but output from different operators
             will always replace existing files (effectively ignore '>'
-            specification). Parameter subPops is ignored. Please refer to
-            class BaseOperator for a detailed description about common
-            operator parameters such as stage and begin.
+            specification). If background is set to a positive number, this
+            operator copies the population and saves the copy in a background
+            thread so that the evolutionary process can continue while the
+            population is being written. At most background populations can be
+            saved at the same time (the operator waits for the oldest one if
+            more are needed) and all of them are saved when function evolve
+            returns. Background saving is not supported under windows.
+            Parameter subPops is ignored. Please refer to class BaseOperator
+            for a detailed description about common operator parameters such
+            as stage and begin.
 
 
         """
@@ -7536,10 +7753,14 @@ class IdTagger(BaseOperator):
         for parentship. If you would like to reset the sequence or start
         from a different number, you can call the reset(startID) function
         of any IdTagger.  An IdTagger is usually used during-mating to
-        assign ID to each offspring. However, if it is applied directly to
-        a population, it will assign unique IDs to all individuals in this
-        population. This property is usually used in the preOps parameter
-        of function Simulator.evolve to assign initial ID to a population.
+        assign ID to each offspring. IDs are reserved in blocks for all
+        offspring of a subpopulation so that offspring of a subpopulation
+        receive consecutive IDs, in the order they are stored, regardless
+        of the number of threads used. However, if it is applied directly
+        to a population, it will assign unique IDs to all individuals in
+        this population. This property is usually used in the preOps
+        parameter of function Simulator.evolve to assign initial ID to a
+        population.
 
 
     """
@@ -9805,6 +10026,63 @@ class PyQuanTrait(BaseQuanTrait):
 PyQuanTrait_swigregister = _simuPOP_lin.PyQuanTrait_swigregister
 PyQuanTrait_swigregister(PyQuanTrait)
 
+class AdditiveQuanTrait(BaseQuanTrait):
+    """
+
+
+    Details:
+
+        This quantitative trait operator assigns a trait field as the sum
+        of genotypic values of alleles at a list of loci, plus an optional
+        normally distributed environmental deviation. Genotypic values are
+        calculated in C++ and, if multiple threads are used, in parallel,
+        so this operator can be used for polygenic traits with a large
+        number of loci.
+
+
+    """
+
+    thisown = _swig_property(lambda x: x.this.own(), lambda x, v: x.this.own(v), doc='The membership flag')
+    __repr__ = _swig_repr
+
+    def __init__(self, *args, **kwargs):
+        """
+
+
+        Usage:
+
+            AdditiveQuanTrait(loci, effects, dominance=[], envVar=0,
+              ancGens=UNSPECIFIED, begin=0, end=-1, step=1, at=[],
+              reps=ALL_AVAIL, subPops=ALL_AVAIL, infoFields=[])
+
+        Details:
+
+            Create an additive quantitative trait operator for specified loci,
+            which can be a list of loci indexes, names, or ALL_AVAIL. Effects
+            of alleles are specified as a list of effects of alleles 0, 1, ...
+            for each locus (parameter effects), or a single list that applies
+            to all loci. Alleles without specified effect have no effect. The
+            genotypic value of an individual is the sum of effects of all its
+            alleles at these loci. If a dominance coefficient d is given for a
+            locus (parameter dominance, one for all loci or one for each
+            locus), the value of a heterozygote with alleles of effects a and
+            b is a + b + d * |a - b| so that d=0 (default) is additive, d=1 is
+            complete dominance of the allele with larger effect and d=-1 is
+            complete dominance of the allele with smaller effect. Alleles on
+            the second homologous copy of chromosome X of male, on chromosome
+            Y of female, and on the second homologous copy of mitochondrial
+            chromosomes and haplodiploid males are ignored. If a positive
+            environmental variance envVar is specified, a random value drawn
+            from N(0, envVar) will be added to the genotypic value. The trait
+            value will be assigned to the only trait field (infoFields).
+
+
+        """
+        _simuPOP_lin.AdditiveQuanTrait_swiginit(self, _simuPOP_lin.new_AdditiveQuanTrait(*args, **kwargs))
+    __swig_destroy__ = _simuPOP_lin.delete_AdditiveQuanTrait
+AdditiveQuanTrait_swigregister = _simuPOP_lin.AdditiveQuanTrait_swigregister
+AdditiveQuanTrait_swigregister(AdditiveQuanTrait)
+
 class BasePenetrance(BaseOperator):
     """
 
@@ -10256,7 +10534,7 @@ class Pedigree(Population):
 
         Usage:
 
-            x.save(filename, infoFields=[], loci=[])
+            x.save(filename, infoFields=[], loci=[], format="text")
 
         Details:
 
@@ -10275,7 +10553,18 @@ class Pedigree(Population):
             have to be unique. Note that parental IDs will be set to zero if
             the parent is not in the pedigree object. Therefore, the parents
             of individuals in the top-most ancestral generation will always be
-            zero.
+            zero.  If format is set to 'binary' (or 'binary.gz'), the pedigree
+            is saved in a binary format with a header that describes the
+            genotypic structure of saved loci, names of information fields,
+            and the location of each generation in the file, followed by each
+            generation with columns of IDs, parental IDs, sex and affection
+            status, a matrix of information fields, and bit- or byte-packed
+            genotypes at specified loci (saved in the order of loci indexes).
+            Generations are compressed separately if 'binary.gz' is used.
+            Binary files can be loaded using function loadPedigree, which
+            reads the genotypic structure and names of information fields from
+            the file, and can load selected generations without reading the
+            rest of the file.
 
 
         """
@@ -10578,7 +10867,7 @@ def loadPedigree(*args, **kwargs) -> "simuPOP::Pedigree":
         loadPedigree(file, idField="ind_id", fatherField="father_id",
           motherField="mother_id", ploidy=2, loci=[], chromTypes=[],
           lociPos=[], chromNames=[], alleleNames=[], lociNames=[],
-          subPopNames=[], infoFields=[])
+          subPopNames=[], infoFields=[], ancGens=[])
 
     Details:
 
@@ -10618,7 +10907,14 @@ def loadPedigree(*args, **kwargs) -> "simuPOP::Pedigree":
         chromTypes, lociPos, chromNames, alleleNames, lociNames could be
         used to specified the genotype structured of the loaded pedigree.
         Please refer to class Population for details about these
-        parameters.
+        parameters.  If the file is saved by function Pedigree.save in
+        binary format, generations are loaded as they are saved, and the
+        genotypic structure and names of information fields are read from
+        the file. Parameter infoFields can be used to rename all saved
+        information fields. In both cases, parameter ancGens can be used
+        to load only specified ancestral generations (default to all
+        generations), and only these generations are read from binary
+        files.
 
 
     """
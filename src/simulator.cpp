@@ -24,6 +24,7 @@
  */
 
 #include "simulator.h"
+#include "outputer.h"
 
 #include <sstream>
 using std::ostringstream;
@@ -39,7 +40,7 @@ Population & pyPopIterator::next()
 }
 
 
-Simulator::Simulator(PyObject * pops, UINT rep, bool steal)
+Simulator::Simulator(PyObject * pops, UINT rep, bool steal, bool shareGenotype)
 {
 	PARAM_ASSERT(rep >= 1, ValueError,
 		"Number of replicates should be greater than or equal one.");
@@ -94,7 +95,8 @@ Simulator::Simulator(PyObject * pops, UINT rep, bool steal)
 	for (UINT i = 1; i < rep; ++i) {
 		for (UINT j = 0; j < numRep; ++j) {
 			try {
-				m_pops.push_back(m_pops[j]->clone());
+				m_pops.push_back(shareGenotype ? m_pops[j]->cloneSharingGenotype()
+					: m_pops[j]->clone());
 				DBG_FAILIF(m_pops.back() == NULL,
 					SystemError, "Fail to create new replicate.");
 			} catch (...) {
@@ -153,6 +155,8 @@ Population & Simulator::population(size_t rep) const
 	DBG_FAILIF(rep >= m_pops.size(), IndexError,
 		"replicate index out of range. From 0 to numRep()-1 ");
 
+	// the population can be changed through the returned reference
+	m_pops[rep]->detachGenotype();
 	return *m_pops[rep];
 }
 
@@ -163,6 +167,7 @@ Population & Simulator::extract(UINT rep)
 		"replicate index out of range. From 0 to numRep()-1 ");
 
 	Population * pop = m_pops[rep];
+	pop->detachGenotype();
 	m_pops.erase(m_pops.begin() + rep);
 	return *pop;
 }
@@ -408,6 +413,8 @@ vectoru Simulator::evolve(
 	// close every opened file (including append-cross-evolution ones)
 	ostreamManager().closeAll();
 	cleanupCircularRefs();
+	// make sure that populations saved in background threads are complete
+	waitForBackgroundSaves();
 	return evolvedGens;
 }
 
@@ -105,9 +105,14 @@ public:
 	 *  populations are by default moved to the simulator to avoid duplication
 	 *  of potentially large population objects, leaving empty populations
 	 *  behind. This behavior can be changed by setting \e stealPops to \c False,
-	 *  in which case populations are copied to the simulator.
+	 *  in which case populations are copied to the simulator. If
+	 *  \e shareGenotype is set to \c True, replicates share the genotypes of
+	 *  all generations of a population until the genotypes of a replicate are
+	 *  changed (copy-on-write). This saves memory and time if replicates of a
+	 *  large population are mated before their genotypes are changed.
 	 */
-	Simulator(PyObject * pops, UINT rep = 1, bool stealPops = true);
+	Simulator(PyObject * pops, UINT rep = 1, bool stealPops = true,
+		bool shareGenotype = false);
 
 	// destroy a simulator along with all its populations
 	~Simulator();
@@ -162,6 +167,8 @@ public:
 	 */
 	pyPopIterator populations()
 	{
+		for (size_t i = 0; i < m_pops.size(); ++i)
+			m_pops[i]->detachGenotype();
 		return pyPopIterator(m_pops.begin(), m_pops.end());
 	}
 
@@ -446,15 +446,58 @@ string Stat::describe(bool /* format */) const
 }
 
 
+namespace {
+
+// Add \e loci to \e allLoci and return 1 if they are all on autosomes or
+// customized chromosomes, so that their genotypes can be counted by
+// countDiploidLoci.
+size_t addAutosomalLoci(const Population & pop, const lociList & loci, vectoru & allLoci)
+{
+	if (loci.empty())
+		return 0;
+	const vectoru & elems = loci.elems(&pop);
+	for (size_t i = 0; i < elems.size(); ++i) {
+		size_t chromType = pop.chromType(pop.chromLocusPair(elems[i]).first);
+		if (chromType != AUTOSOME && chromType != CUSTOMIZED)
+			return 0;
+	}
+	allLoci.insert(allLoci.end(), elems.begin(), elems.end());
+	return 1;
+}
+
+
+}
+
 bool Stat::apply(Population & pop) const
 {
+	// Statistics that can be calculated from genotype counts of diploid
+	// individuals share a single sweep through the population if more than
+	// one of them is requested.
+	DiploidLociCounts counts;
+	if (pop.ploidy() == 2 && !pop.isHaplodiploid()) {
+		vectoru loci;
+		size_t nStats = 0;
+#ifndef MUTANTALLELE
+		// the mutant module counts alleles from non-zero alleles directly
+		nStats += addAutosomalLoci(pop, m_alleleFreq.loci(), loci);
+#endif
+		nStats += addAutosomalLoci(pop, m_heteroFreq.loci(), loci);
+		nStats += addAutosomalLoci(pop, m_structure.loci(), loci);
+		nStats += addAutosomalLoci(pop, m_HWE.loci(), loci);
+		nStats += addAutosomalLoci(pop, m_Inbreeding.loci(), loci);
+		if (nStats > 1) {
+			counts.count(pop, applicableSubPops(pop), loci);
+		}
+	}
+	const DiploidLociCounts * shared = counts.empty() ? NULL : &counts;
+
 	return m_popSize.apply(pop) &&
 	       m_numOfMales.apply(pop) &&
 	       m_numOfAffected.apply(pop) &&
 	       m_numOfSegSites.apply(pop) &&
 	       m_numOfMutants.apply(pop) &&
-	       m_alleleFreq.apply(pop) &&
-	       m_heteroFreq.apply(pop) &&
+	       m_alleleFreq.apply(pop, shared) &&
+	       m_heteroFreq.apply(pop, shared) &&
 	       m_genoFreq.apply(pop) &&
 	       m_haploFreq.apply(pop) &&
 	       m_haploHomoFreq.apply(pop) &&
@@ -462,9 +505,9 @@ bool Stat::apply(Population & pop) const
 	       m_LD.apply(pop) &&
 	       m_association.apply(pop) &&
 	       m_neutrality.apply(pop) &&
-	       m_structure.apply(pop) &&
-	       m_HWE.apply(pop) &&
-	       m_Inbreeding.apply(pop) &&
+	       m_structure.apply(pop, shared) &&
+	       m_HWE.apply(pop, shared) &&
+	       m_Inbreeding.apply(pop, shared) &&
 	       m_effectiveSize.apply(pop);
 }
 
@@ -977,7 +1020,7 @@ string statAlleleFreq::describe(bool /* format */) const
 }
 
 
-bool statAlleleFreq::apply(Population & pop) const
+bool statAlleleFreq::apply(Population & pop, const DiploidLociCounts * counts) const
 {
 	if (m_loci.empty())
 		return true;
@@ -989,9 +1032,15 @@ bool statAlleleFreq::apply(Population & pop) const
 	vectoru allAllelesCnt(loci.size(), 0);
 	// selected (virtual) subpopulatons.
 	subPopList subPops = m_subPops.expandFrom(pop);
+#ifdef MUTANTALLELE
+	(void)counts;
+#else
+	if (counts != NULL && !counts->covers(loci))
+		counts = NULL;
+#endif
 	subPopList::const_iterator it = subPops.begin();
 	subPopList::const_iterator itEnd = subPops.end();
-	for (; it != itEnd; ++it) {
+	for (size_t spIdx = 0; it != itEnd; ++it, ++spIdx) {
 		if (m_vars.contains(AlleleNum_sp_String))
 			pop.getVars().removeVar(subPopVar_String(*it, AlleleNum_String, m_suffix));
 		if (m_vars.contains(AlleleFreq_sp_String))
@@ -1136,20 +1185,31 @@ bool statAlleleFreq::apply(Population & pop) const
 #  endif
 			size_t allAlleles = 0;
 
-			// go through all alleles
-			IndAlleleIterator a = pop.alleleIterator(loc, it->subPop());
-			// use allAllelel here because some marker does not have full number
-			// of alleles (e.g. markers on chromosome X and Y).
-			for (; a.valid(); ++a) {
-				Allele v = a.value();
+			size_t cntIdx = counts == NULL ? 0 : counts->index(loc);
+			if (counts != NULL && !counts->general(spIdx, cntIdx)) {
+				// alleles 0 and 1 from counts of genotypes 00, 01 and 11
+				const size_t * genoCnt = counts->genoCnt(spIdx, cntIdx);
+				if (genoCnt[0] * 2 + genoCnt[1] > 0)
+					alleles[0] = genoCnt[0] * 2 + genoCnt[1];
+				if (genoCnt[1] + genoCnt[2] * 2 > 0)
+					alleles[1] = genoCnt[1] + genoCnt[2] * 2;
+				allAlleles = counts->individuals(spIdx).size() * 2;
+			} else {
+				// go through all alleles
+				IndAlleleIterator a = pop.alleleIterator(loc, it->subPop());
+				// use allAllelel here because some marker does not have full number
+				// of alleles (e.g. markers on chromosome X and Y).
+				for (; a.valid(); ++a) {
+					Allele v = a.value();
 #  ifndef BINARYALLELE
 #    ifndef LONGALLELE
-				if (v >= alleles.size())
-					alleles.resize(v + 1, 0);
+					if (v >= alleles.size())
+						alleles.resize(v + 1, 0);
 #    endif
 #  endif
-				alleles[v]++;
-				allAlleles++;
+					alleles[v]++;
+					allAlleles++;
+				}
 			}
 			// total allele count
 #  ifdef LONGALLELE
@@ -1269,7 +1329,7 @@ string statHeteroFreq::describe(bool /* format */) const
 }
 
 
-bool statHeteroFreq::apply(Population & pop) const
+bool statHeteroFreq::apply(Population & pop, const DiploidLociCounts * counts) const
 {
 	if (m_loci.empty())
 		return true;
@@ -1287,9 +1347,11 @@ bool statHeteroFreq::apply(Population & pop) const
 
 	// selected (virtual) subpopulatons.
 	subPopList subPops = m_subPops.expandFrom(pop);
+	if (counts != NULL && !counts->covers(loci))
+		counts = NULL;
 	subPopList::const_iterator it = subPops.begin();
 	subPopList::const_iterator itEnd = subPops.end();
-	for (; it != itEnd; ++it) {
+	for (size_t spIdx = 0; it != itEnd; ++it, ++spIdx) {
 		pop.activateVirtualSubPop(*it);
 
 		uintDict heteroCnt;
@@ -1307,13 +1369,18 @@ bool statHeteroFreq::apply(Population & pop) const
 			size_t hetero = 0;
 			size_t homo = 0;
 
-			// go through all alleles
-			IndAlleleIterator a = pop.alleleIterator(loc, it->subPop());
-			for (; a.valid(); a += 2) {
-				if (a.value() != (a + 1).value())
-					hetero += 1;
-				else
-					homo += 1;
+			if (counts != NULL) {
+				homo = counts->IBSCnt(spIdx, counts->index(loc));
+				hetero = counts->individuals(spIdx).size() - homo;
+			} else {
+				// go through all alleles
+				IndAlleleIterator a = pop.alleleIterator(loc, it->subPop());
+				for (; a.valid(); a += 2) {
+					if (a.value() != (a + 1).value())
+						hetero += 1;
+					else
+						homo += 1;
+				}
 			}
 #pragma omp critical
 			{
@@ -2749,6 +2816,95 @@ double statAssociation::armitageTest(const GENOCNT & caseCnt,
 }
 
 
+void statAssociation::denseChiSqTest(const size_t * caseCnt, const size_t * controlCnt,
+                                     size_t n, double & chisq, double & chisq_p) const
+{
+	// alleles or genotypes that do not appear in the sample are not part
+	// of the table, which is consistent with alleleChiSqTest and genoChiSqTest
+	vector<vectoru> table(2);
+	for (size_t i = 0; i < n; ++i) {
+		if (caseCnt[i] + controlCnt[i] == 0)
+			continue;
+		table[0].push_back(caseCnt[i]);
+		table[1].push_back(controlCnt[i]);
+	}
+	chisqTest(table, chisq, chisq_p);
+}
+
+
+double statAssociation::denseArmitageTest(const size_t * caseCnt,
+                                          const size_t * ctrlCnt) const
+{
+	// allele counts from genotypes 00, 01 and 11
+	size_t cnt0 = 2 * (caseCnt[0] + ctrlCnt[0]) + caseCnt[1] + ctrlCnt[1];
+	size_t cnt1 = 2 * (caseCnt[2] + ctrlCnt[2]) + caseCnt[1] + ctrlCnt[1];
+
+	if (cnt0 == 0 || cnt1 == 0)
+		return 1.;
+	// use the same major allele as armitageTest, namely allele 1 for ties
+	vector<vectoru> table(2);
+	for (size_t i = 0; i < 2; ++i)
+		table[i].resize(3, 0);
+	size_t major = cnt0 > cnt1 ? 0 : 2;
+	table[1][0] = caseCnt[major];
+	table[1][1] = caseCnt[1];
+	table[1][2] = caseCnt[2 - major];
+	table[0][0] = ctrlCnt[major];
+	table[0][1] = ctrlCnt[1];
+	table[0][2] = ctrlCnt[2 - major];
+	vectorf weight(3);
+	for (size_t i = 0; i < 3; ++i)
+		weight[i] = static_cast<double>(i);
+	return armitageTrendTest(table, weight);
+}
+
+
+void statAssociation::countLocus(const Population & pop, const vector<const Individual *> & inds,
+                                 size_t loc, size_t chromType, bool countAllele, bool countGeno,
+                                 ALLELECNT & caseAlleleCnt, ALLELECNT & ctrlAlleleCnt,
+                                 GENOCNT & caseGenoCnt, GENOCNT & ctrlGenoCnt) const
+{
+	size_t ply = pop.ploidy();
+	size_t totNumLoci = pop.totNumLoci();
+	bool haplodiploid = pop.isHaplodiploid();
+
+	for (size_t i = 0; i < inds.size(); ++i) {
+		const Individual * ind = inds[i];
+		GenoIterator geno = ind->genoBegin() + loc;
+		Sex sex = ind->sex();
+		if (countAllele) {
+			for (size_t p = 0; p < ply; ++p) {
+				if (ply == 2 && p == 1 && sex == MALE && haplodiploid)
+					continue;
+				if (ply == 2 && chromType == CHROMOSOME_Y && sex == FEMALE)
+					continue;
+				if (ply == 2 && ((chromType == CHROMOSOME_X && p == 1) ||
+				                 (chromType == CHROMOSOME_Y && p == 0)) && sex == MALE)
+					continue;
+				if (chromType == MITOCHONDRIAL && p > 0)
+					continue;
+				if (ind->affected())
+					caseAlleleCnt[DEREF_ALLELE(geno + p * totNumLoci)]++;
+				else
+					ctrlAlleleCnt[DEREF_ALLELE(geno + p * totNumLoci)]++;
+			}
+		}
+		if (countGeno) {
+			if (chromType == CHROMOSOME_X || chromType == CHROMOSOME_Y || chromType == MITOCHONDRIAL)
+				continue;
+			Allele a1 = DEREF_ALLELE(geno);
+			Allele a2 = DEREF_ALLELE(geno + totNumLoci);
+			if (a1 > a2)
+				std::swap(a1, a2);
+			if (ind->affected())
+				caseGenoCnt[GENOCNT::key_type(a1, a2)]++;
+			else
+				ctrlGenoCnt[GENOCNT::key_type(a1, a2)]++;
+		}
+	}
+}
+
+
 bool statAssociation::apply(Population & pop) const
 {
 	if (m_loci.empty())
@@ -2771,150 +2927,213 @@ bool statAssociation::apply(Population & pop) const
 			hasGenoTest = true;
 		}
 	}
-	// count for all specified subpopulations
-	size_t nLoci = loci.size();
-	ALLELECNTLIST allCaseAlleleCnt(nLoci);
-	ALLELECNTLIST allCtrlAlleleCnt(nLoci);
-	GENOCNTLIST allCaseGenoCnt(nLoci);
-	GENOCNTLIST allCtrlGenoCnt(nLoci);
-	// selected (virtual) subpopulatons.
+	bool alleleSp = m_vars.contains(Allele_ChiSq_sp_String) || m_vars.contains(Allele_ChiSq_p_sp_String);
+	bool alleleAll = m_vars.contains(Allele_ChiSq_String) || m_vars.contains(Allele_ChiSq_p_String);
+	bool genoSp = m_vars.contains(Geno_ChiSq_sp_String) || m_vars.contains(Geno_ChiSq_p_sp_String);
+	bool genoAll = m_vars.contains(Geno_ChiSq_String) || m_vars.contains(Geno_ChiSq_p_String);
+	bool armitageSp = m_vars.contains(Armitage_p_sp_String);
+	bool armitageAll = m_vars.contains(Armitage_p_String);
+
+	// selected (virtual) subpopulatons, and individuals in them.
 	subPopList subPops = m_subPops.expandFrom(pop);
-	subPopList::const_iterator it = subPops.begin();
-	subPopList::const_iterator itEnd = subPops.end();
-	for (; it != itEnd; ++it) {
-		ALLELECNTLIST caseAlleleCnt(nLoci);
-		ALLELECNTLIST ctrlAlleleCnt(nLoci);
-		GENOCNTLIST caseGenoCnt(nLoci);
-		GENOCNTLIST ctrlGenoCnt(nLoci);
+	size_t nSP = subPops.size();
+	vector<vector<const Individual *> > inds(nSP);
+	for (size_t sp = 0; sp < nSP; ++sp) {
+		pop.activateVirtualSubPop(subPops[sp]);
+		IndIterator ind = pop.indIterator(subPops[sp].subPop());
+		for (; ind.valid(); ++ind)
+			inds[sp].push_back(&*ind);
+		pop.deactivateVirtualSubPop(subPops[sp].subPop());
+	}
 
-		pop.activateVirtualSubPop(*it);
+	// Counts of alleles 0, 1 and genotypes 00, 01, 11 of cases and controls
+	// for each locus and each subpopulation are saved in a dense array, so
+	// that loci can be counted and tested in parallel. Loci with alleles
+	// other than 0 and 1 are marked and handled by the general algorithm.
+	size_t nLoci = loci.size();
+	size_t totNumLoci = pop.totNumLoci();
+	bool haplodiploid = pop.isHaplodiploid();
+	const size_t nCnt = 5;
+	vectoru counts(nSP * nLoci * 2 * nCnt, 0);
+	vector<char> general(nLoci, 0);
+	// test statistics for each subpopulation, and for all subpopulations in
+	// the last row.
+	vectorf alleleChisq((nSP + 1) * nLoci, 0);
+	vectorf alleleChisq_p((nSP + 1) * nLoci, 0);
+	vectorf genoChisq((nSP + 1) * nLoci, 0);
+	vectorf genoChisq_p((nSP + 1) * nLoci, 0);
+	vectorf armitage_p((nSP + 1) * nLoci, 0);
+
+	// loci are processed in blocks so that each thread scans individuals once
+	// for a number of loci
+	const size_t blockSize = 64;
+	ssize_t nBlocks = static_cast<ssize_t>((nLoci + blockSize - 1) / blockSize);
 
-		IndIterator ind = pop.indIterator(it->subPop());
-		for (; ind.valid(); ++ind) {
-			if (hasAlleleTest) {
-				for (size_t p = 0; p < ply; ++p) {
-					if (ply == 2 && p == 1 && ind->sex() == MALE && pop.isHaplodiploid())
+#pragma omp parallel for if(numThreads() > 1)
+	for (ssize_t blk = 0; blk < nBlocks; ++blk) {
+		size_t first = static_cast<size_t>(blk) * blockSize;
+		size_t last = std::min(first + blockSize, nLoci);
+		for (size_t sp = 0; sp < nSP; ++sp) {
+			const vector<const Individual *> & spInds = inds[sp];
+			for (size_t i = 0; i < spInds.size(); ++i) {
+				const Individual * ind = spInds[i];
+				GenoIterator geno = ind->genoBegin();
+				Sex sex = ind->sex();
+				size_t c = ind->affected() ? 0 : 1;
+				for (size_t idx = first; idx < last; ++idx) {
+					if (general[idx])
 						continue;
-					GenoIterator geno = ind->genoBegin(p);
-					// allele count
-					for (size_t idx = 0; idx < nLoci; ++idx) {
-						if (ply == 2 && chromTypes[idx] == CHROMOSOME_Y && ind->sex() == FEMALE)
-							continue;
-						if (ply == 2 && ((chromTypes[idx] == CHROMOSOME_X && p == 1) ||
-						                 (chromTypes[idx] == CHROMOSOME_Y && p == 0)) && ind->sex() == MALE)
+					size_t * cnt = &counts[((sp * nLoci + idx) * 2 + c) * nCnt];
+					size_t chromType = chromTypes[idx];
+					if (hasAlleleTest) {
+						for (size_t p = 0; p < ply; ++p) {
+							if (ply == 2 && p == 1 && sex == MALE && haplodiploid)
+								continue;
+							if (ply == 2 && chromType == CHROMOSOME_Y && sex == FEMALE)
+								continue;
+							if (ply == 2 && ((chromType == CHROMOSOME_X && p == 1) ||
+							                 (chromType == CHROMOSOME_Y && p == 0)) && sex == MALE)
+								continue;
+							if (chromType == MITOCHONDRIAL && p > 0)
+								continue;
+							size_t a = ALLELE_AS_UNSINGED(DEREF_ALLELE(geno + loci[idx] + p * totNumLoci));
+							if (a > 1) {
+								general[idx] = 1;
+								break;
+							}
+							++cnt[a];
+						}
+					}
+					if (hasGenoTest && !general[idx]) {
+						if (chromType == CHROMOSOME_X || chromType == CHROMOSOME_Y || chromType == MITOCHONDRIAL)
 							continue;
-						if (chromTypes[idx] == MITOCHONDRIAL && p > 0)
+						size_t a1 = ALLELE_AS_UNSINGED(DEREF_ALLELE(geno + loci[idx]));
+						size_t a2 = ALLELE_AS_UNSINGED(DEREF_ALLELE(geno + loci[idx] + totNumLoci));
+						if (a1 > 1 || a2 > 1) {
+							general[idx] = 1;
 							continue;
-						if (ind->affected())
-							caseAlleleCnt[idx][DEREF_ALLELE(geno + loci[idx])]++;
-						else
-							ctrlAlleleCnt[idx][DEREF_ALLELE(geno + loci[idx])]++;
+						}
+						++cnt[2 + a1 + a2];
 					}
 				}
 			}
-			// genotype
-			if (hasGenoTest) {
-				GenoIterator geno1 = ind->genoBegin(0);
-				GenoIterator geno2 = ind->genoBegin(1);
-				for (size_t idx = 0; idx < nLoci; ++idx) {
-					if (chromTypes[idx] == CHROMOSOME_X || chromTypes[idx] == CHROMOSOME_Y || chromTypes[idx] == MITOCHONDRIAL)
+		}
+		// test statistics of loci in this block
+		for (size_t idx = first; idx < last; ++idx) {
+			if (general[idx])
+				continue;
+			size_t all[2][nCnt] = { { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 } };
+			for (size_t sp = 0; sp <= nSP; ++sp) {
+				const size_t * caseCnt = 0;
+				const size_t * ctrlCnt = 0;
+				if (sp < nSP) {
+					caseCnt = &counts[(sp * nLoci + idx) * 2 * nCnt];
+					ctrlCnt = caseCnt + nCnt;
+					for (size_t k = 0; k < nCnt; ++k) {
+						all[0][k] += caseCnt[k];
+						all[1][k] += ctrlCnt[k];
+					}
+					if (!alleleSp && !genoSp && !armitageSp)
 						continue;
-					Allele a1 = DEREF_ALLELE(geno1 + loci[idx]);
-					Allele a2 = DEREF_ALLELE(geno2 + loci[idx]);
-					if (a1 > a2)
-						std::swap(a1, a2);
-					if (ind->affected())
-						caseGenoCnt[idx][GENOCNT::key_type(a1, a2)]++;
-					else
-						ctrlGenoCnt[idx][GENOCNT::key_type(a1, a2)]++;
+				} else {
+					caseCnt = all[0];
+					ctrlCnt = all[1];
 				}
+				size_t pos = sp * nLoci + idx;
+				if (sp < nSP ? alleleSp : alleleAll)
+					denseChiSqTest(caseCnt, ctrlCnt, 2, alleleChisq[pos], alleleChisq_p[pos]);
+				if (sp < nSP ? genoSp : genoAll)
+					denseChiSqTest(caseCnt + 2, ctrlCnt + 2, 3, genoChisq[pos], genoChisq_p[pos]);
+				if (sp < nSP ? armitageSp : armitageAll)
+					armitage_p[pos] = denseArmitageTest(caseCnt + 2, ctrlCnt + 2);
 			}
 		}
-		pop.deactivateVirtualSubPop(it->subPop());
-		//
-		// output variable.
-		if (m_vars.contains(Allele_ChiSq_sp_String) || m_vars.contains(Allele_ChiSq_p_sp_String)) {
-			uintDict chisq;
-			uintDict chisq_p;
-			for (size_t i = 0; i < loci.size(); ++i)
-				alleleChiSqTest(caseAlleleCnt[i], ctrlAlleleCnt[i], chisq[loci[i]], chisq_p[loci[i]]);
+	}
+
+	// loci with more than two alleles
+	for (size_t idx = 0; idx < nLoci; ++idx) {
+		if (!general[idx])
+			continue;
+		ALLELECNT allCaseAlleleCnt;
+		ALLELECNT allCtrlAlleleCnt;
+		GENOCNT allCaseGenoCnt;
+		GENOCNT allCtrlGenoCnt;
+		for (size_t sp = 0; sp < nSP; ++sp) {
+			ALLELECNT caseAlleleCnt;
+			ALLELECNT ctrlAlleleCnt;
+			GENOCNT caseGenoCnt;
+			GENOCNT ctrlGenoCnt;
+			countLocus(pop, inds[sp], loci[idx], chromTypes[idx], hasAlleleTest, hasGenoTest,
+				caseAlleleCnt, ctrlAlleleCnt, caseGenoCnt, ctrlGenoCnt);
+			size_t pos = sp * nLoci + idx;
+			if (alleleSp)
+				alleleChiSqTest(caseAlleleCnt, ctrlAlleleCnt, alleleChisq[pos], alleleChisq_p[pos]);
+			if (genoSp)
+				genoChiSqTest(caseGenoCnt, ctrlGenoCnt, genoChisq[pos], genoChisq_p[pos]);
+			if (armitageSp)
+				armitage_p[pos] = armitageTest(caseGenoCnt, ctrlGenoCnt);
+			//
+			ALLELECNT::const_iterator acnt = caseAlleleCnt.begin();
+			for (; acnt != caseAlleleCnt.end(); ++acnt)
+				allCaseAlleleCnt[acnt->first] += acnt->second;
+			for (acnt = ctrlAlleleCnt.begin(); acnt != ctrlAlleleCnt.end(); ++acnt)
+				allCtrlAlleleCnt[acnt->first] += acnt->second;
+			GENOCNT::const_iterator gcnt = caseGenoCnt.begin();
+			for (; gcnt != caseGenoCnt.end(); ++gcnt)
+				allCaseGenoCnt[gcnt->first] += gcnt->second;
+			for (gcnt = ctrlGenoCnt.begin(); gcnt != ctrlGenoCnt.end(); ++gcnt)
+				allCtrlGenoCnt[gcnt->first] += gcnt->second;
+		}
+		size_t pos = nSP * nLoci + idx;
+		if (alleleAll)
+			alleleChiSqTest(allCaseAlleleCnt, allCtrlAlleleCnt, alleleChisq[pos], alleleChisq_p[pos]);
+		if (genoAll)
+			genoChiSqTest(allCaseGenoCnt, allCtrlGenoCnt, genoChisq[pos], genoChisq_p[pos]);
+		if (armitageAll)
+			armitage_p[pos] = armitageTest(allCaseGenoCnt, allCtrlGenoCnt);
+	}
+
+	// output variables
+	for (size_t sp = 0; sp <= nSP; ++sp) {
+		if (sp < nSP ? !(alleleSp || genoSp || armitageSp) : !(alleleAll || genoAll || armitageAll))
+			continue;
+		uintDict aChisq;
+		uintDict aChisq_p;
+		uintDict gChisq;
+		uintDict gChisq_p;
+		uintDict pvalues;
+		for (size_t idx = 0; idx < nLoci; ++idx) {
+			size_t pos = sp * nLoci + idx;
+			aChisq[loci[idx]] = alleleChisq[pos];
+			aChisq_p[loci[idx]] = alleleChisq_p[pos];
+			gChisq[loci[idx]] = genoChisq[pos];
+			gChisq_p[loci[idx]] = genoChisq_p[pos];
+			pvalues[loci[idx]] = armitage_p[pos];
+		}
+		if (sp < nSP) {
 			if (m_vars.contains(Allele_ChiSq_sp_String))
-				pop.getVars().setVar(subPopVar_String(*it, Allele_ChiSq_String, m_suffix), chisq);
+				pop.getVars().setVar(subPopVar_String(subPops[sp], Allele_ChiSq_String, m_suffix), aChisq);
 			if (m_vars.contains(Allele_ChiSq_p_sp_String))
-				pop.getVars().setVar(subPopVar_String(*it, Allele_ChiSq_p_String, m_suffix), chisq_p);
-		}
-		if (m_vars.contains(Geno_ChiSq_sp_String) || m_vars.contains(Geno_ChiSq_p_sp_String)) {
-			uintDict chisq;
-			uintDict chisq_p;
-			for (size_t i = 0; i < loci.size(); ++i)
-				genoChiSqTest(caseGenoCnt[i], ctrlGenoCnt[i], chisq[loci[i]], chisq_p[loci[i]]);
+				pop.getVars().setVar(subPopVar_String(subPops[sp], Allele_ChiSq_p_String, m_suffix), aChisq_p);
 			if (m_vars.contains(Geno_ChiSq_sp_String))
-				pop.getVars().setVar(subPopVar_String(*it, Geno_ChiSq_String, m_suffix), chisq);
+				pop.getVars().setVar(subPopVar_String(subPops[sp], Geno_ChiSq_String, m_suffix), gChisq);
 			if (m_vars.contains(Geno_ChiSq_p_sp_String))
-				pop.getVars().setVar(subPopVar_String(*it, Geno_ChiSq_p_String, m_suffix), chisq_p);
-		}
-		if (m_vars.contains(Armitage_p_sp_String)) {
-			uintDict pvalues;
-			for (size_t i = 0; i < loci.size(); ++i)
-				pvalues[loci[i]] = armitageTest(caseGenoCnt[i], ctrlGenoCnt[i]);
-			pop.getVars().setVar(subPopVar_String(*it, Armitage_p_String, m_suffix), pvalues);
-		}
-		// total allele count
-		if (hasAlleleTest) {
-			for (size_t idx = 0; idx < nLoci; ++idx) {
-				ALLELECNT::const_iterator cnt = caseAlleleCnt[idx].begin();
-				ALLELECNT::const_iterator cntEnd = caseAlleleCnt[idx].end();
-				for (; cnt != cntEnd; ++cnt)
-					allCaseAlleleCnt[idx][cnt->first] += cnt->second;
-				cnt = ctrlAlleleCnt[idx].begin();
-				cntEnd = ctrlAlleleCnt[idx].end();
-				for (; cnt != cntEnd; ++cnt)
-					allCtrlAlleleCnt[idx][cnt->first] += cnt->second;
-			}
-		}
-		if (hasGenoTest) {
-			for (size_t idx = 0; idx < nLoci; ++idx) {
-				GENOCNT::const_iterator cnt = caseGenoCnt[idx].begin();
-				GENOCNT::const_iterator cntEnd = caseGenoCnt[idx].end();
-				for (; cnt != cntEnd; ++cnt)
-					allCaseGenoCnt[idx][cnt->first] += cnt->second;
-				cnt = ctrlGenoCnt[idx].begin();
-				cntEnd = ctrlGenoCnt[idx].end();
-				for (; cnt != cntEnd; ++cnt)
-					allCtrlGenoCnt[idx][cnt->first] += cnt->second;
-			}
+				pop.getVars().setVar(subPopVar_String(subPops[sp], Geno_ChiSq_p_String, m_suffix), gChisq_p);
+			if (armitageSp)
+				pop.getVars().setVar(subPopVar_String(subPops[sp], Armitage_p_String, m_suffix), pvalues);
+		} else {
+			if (m_vars.contains(Allele_ChiSq_String))
+				pop.getVars().setVar(Allele_ChiSq_String + m_suffix, aChisq);
+			if (m_vars.contains(Allele_ChiSq_p_String))
+				pop.getVars().setVar(Allele_ChiSq_p_String + m_suffix, aChisq_p);
+			if (m_vars.contains(Geno_ChiSq_String))
+				pop.getVars().setVar(Geno_ChiSq_String + m_suffix, gChisq);
+			if (m_vars.contains(Geno_ChiSq_p_String))
+				pop.getVars().setVar(Geno_ChiSq_p_String + m_suffix, gChisq_p);
+			if (armitageAll)
+				pop.getVars().setVar(Armitage_p_String + m_suffix, pvalues);
 		}
 	}
-	//
-	if (m_vars.contains(Allele_ChiSq_String) || m_vars.contains(Allele_ChiSq_p_String)) {
-		uintDict chisq;
-		uintDict chisq_p;
-		for (size_t i = 0; i < loci.size(); ++i)
-			alleleChiSqTest(allCaseAlleleCnt[i], allCtrlAlleleCnt[i],
-				chisq[loci[i]], chisq_p[loci[i]]);
-		// output variable.
-		if (m_vars.contains(Allele_ChiSq_String))
-			pop.getVars().setVar(Allele_ChiSq_String + m_suffix, chisq);
-		if (m_vars.contains(Allele_ChiSq_p_String))
-			pop.getVars().setVar(Allele_ChiSq_p_String + m_suffix, chisq_p);
-	}
-	if (m_vars.contains(Geno_ChiSq_String) || m_vars.contains(Geno_ChiSq_p_String)) {
-		uintDict chisq;
-		uintDict chisq_p;
-		for (size_t i = 0; i < loci.size(); ++i)
-			genoChiSqTest(allCaseGenoCnt[i], allCtrlGenoCnt[i],
-				chisq[loci[i]], chisq_p[loci[i]]);
-		if (m_vars.contains(Geno_ChiSq_String))
-			pop.getVars().setVar(Geno_ChiSq_String + m_suffix, chisq);
-		if (m_vars.contains(Geno_ChiSq_p_String))
-			pop.getVars().setVar(Geno_ChiSq_p_String + m_suffix, chisq_p);
-	}
-	if (m_vars.contains(Armitage_p_String)) {
-		uintDict pvalues;
-		for (size_t i = 0; i < loci.size(); ++i)
-			pvalues[loci[i]] = armitageTest(allCaseGenoCnt[i], allCtrlGenoCnt[i]);
-		pop.getVars().setVar(Armitage_p_String + m_suffix, pvalues);
-	}
 	return true;
 }
 
@@ -3205,7 +3424,7 @@ void statStructure::calcFst_WC84(const vectoru & loci, const vectoru & n_i, LOCI
 }
 
 
-bool statStructure::apply(Population & pop) const
+bool statStructure::apply(Population & pop, const DiploidLociCounts * counts) const
 {
 	if (m_loci.empty())
 		return true;
@@ -3223,6 +3442,8 @@ bool statStructure::apply(Population & pop) const
 
 	// selected (virtual) subpopulatons.
 	subPopList subPops = m_subPops.expandFrom(pop);
+	if (counts != NULL && (!use_observed_het || !counts->covers(loci)))
+		counts = NULL;
 	subPopList::const_iterator it = subPops.begin();
 	subPopList::const_iterator itEnd = subPops.end();
 	// count for all specified subpopulations
@@ -3247,19 +3468,34 @@ bool statStructure::apply(Population & pop) const
 			size_t cnt = 0;
 
 			if (use_observed_het) {
-				// go through all alleles
-				IndAlleleIterator a = pop.alleleIterator(loc, it->subPop());
-				for (; a.valid(); ++cnt) {
-					Allele a1 = DEREF_ALLELE(a);
-					++a;
-					Allele a2 = DEREF_ALLELE(a);
-					++a;
-					++af[a1];
-					++af[a2];
-					hf[a1] += a1 != a2;
-					hf[a2] += a1 != a2;
-					alleles[a1] = true;
-					alleles[a2] = true;
+				size_t cntIdx = counts == NULL ? 0 : counts->index(loc);
+				if (counts != NULL && !counts->general(spIdx, cntIdx)) {
+					// alleles 0 and 1 from counts of genotypes 00, 01 and 11
+					const size_t * genoCnt = counts->genoCnt(spIdx, cntIdx);
+					for (size_t allele = 0; allele < 2; ++allele) {
+						size_t num = genoCnt[1] + genoCnt[allele * 2] * 2;
+						if (num == 0)
+							continue;
+						af[allele] = static_cast<float>(num);
+						hf[allele] = static_cast<float>(genoCnt[1]);
+						alleles[allele] = true;
+					}
+					cnt = counts->individuals(spIdx).size();
+				} else {
+					// go through all alleles
+					IndAlleleIterator a = pop.alleleIterator(loc, it->subPop());
+					for (; a.valid(); ++cnt) {
+						Allele a1 = DEREF_ALLELE(a);
+						++a;
+						Allele a2 = DEREF_ALLELE(a);
+						++a;
+						++af[a1];
+						++af[a2];
+						hf[a1] += a1 != a2;
+						hf[a2] += a1 != a2;
+						alleles[a1] = true;
+						alleles[a2] = true;
+					}
 				}
 				// allele frequency
 				map<size_t, float>::iterator it = af.begin();
@@ -3337,6 +3573,85 @@ bool statStructure::apply(Population & pop) const
 }
 
 
+void countDiploidLoci(const Population & pop, const vector<const Individual *> & inds,
+                      const vectoru & loci, vectoru & genoCnt, vectoru & IBSCnt, vectoru & IBDCnt,
+                      vector<char> & general)
+{
+	size_t nLoci = loci.size();
+	size_t totNumLoci = pop.totNumLoci();
+	const size_t blockSize = 64;
+	ssize_t nBlocks = static_cast<ssize_t>((nLoci + blockSize - 1) / blockSize);
+
+#pragma omp parallel for if(numThreads() > 1)
+	for (ssize_t blk = 0; blk < nBlocks; ++blk) {
+		size_t first = static_cast<size_t>(blk) * blockSize;
+		size_t last = std::min(first + blockSize, nLoci);
+		for (size_t i = 0; i < inds.size(); ++i) {
+			GenoIterator geno = inds[i]->genoBegin();
+#ifdef LINEAGE
+			LineageIterator lineage = inds[i]->lineageBegin();
+#endif
+			for (size_t idx = first; idx < last; ++idx) {
+				size_t a1 = ALLELE_AS_UNSINGED(DEREF_ALLELE(geno + loci[idx]));
+				size_t a2 = ALLELE_AS_UNSINGED(DEREF_ALLELE(geno + loci[idx] + totNumLoci));
+				if (a1 == a2)
+					++IBSCnt[idx];
+#ifdef LINEAGE
+				if (*(lineage + loci[idx]) == *(lineage + loci[idx] + totNumLoci))
+					++IBDCnt[idx];
+#endif
+				if (a1 > 1 || a2 > 1)
+					general[idx] = 1;
+				else
+					++genoCnt[idx * 3 + a1 + a2];
+			}
+		}
+	}
+#ifndef LINEAGE
+	(void)IBDCnt;
+#endif
+}
+
+
+void DiploidLociCounts::count(Population & pop, const subPopList & subPops, const vectoru & loci)
+{
+	m_loci = loci;
+	std::sort(m_loci.begin(), m_loci.end());
+	m_loci.erase(std::unique(m_loci.begin(), m_loci.end()), m_loci.end());
+
+	size_t nSP = subPops.size();
+	size_t nLoci = m_loci.size();
+	m_inds.assign(nSP, vector<const Individual *>());
+	m_genoCnt.assign(nSP, vectoru(nLoci * 3, 0));
+	m_IBSCnt.assign(nSP, vectoru(nLoci, 0));
+	m_IBDCnt.assign(nSP, vectoru(nLoci, 0));
+	m_general.assign(nSP, vector<char>(nLoci, 0));
+	m_anyGeneral.assign(nLoci, 0);
+	for (size_t sp = 0; sp < nSP; ++sp) {
+		pop.activateVirtualSubPop(subPops[sp]);
+		IndIterator ind = pop.indIterator(subPops[sp].subPop());
+		for (; ind.valid(); ++ind)
+			m_inds[sp].push_back(&*ind);
+		pop.deactivateVirtualSubPop(subPops[sp].subPop());
+
+		countDiploidLoci(pop, m_inds[sp], m_loci, m_genoCnt[sp], m_IBSCnt[sp], m_IBDCnt[sp], m_general[sp]);
+		for (size_t idx = 0; idx < nLoci; ++idx)
+			m_anyGeneral[idx] |= m_general[sp][idx];
+	}
+}
+
+
+bool DiploidLociCounts::covers(const vectoru & loci) const
+{
+	if (empty())
+		return false;
+	for (size_t i = 0; i < loci.size(); ++i)
+		if (!std::binary_search(m_loci.begin(), m_loci.end(), loci[i]))
+			return false;
+	return true;
+}
+
+
 statHWE::statHWE(const lociList & loci,  const subPopList & subPops,
 	const stringList & vars, const string & suffix)
 	: m_loci(loci), m_subPops(subPops), m_vars(), m_suffix(suffix)
@@ -3381,7 +3696,7 @@ vectoru statHWE::mapToCount(const GENOCNT & cnt) const
 }
 
 
-bool statHWE::apply(Population & pop) const
+bool statHWE::apply(Population & pop, const DiploidLociCounts * counts) const
 {
 	if (m_loci.empty())
 		return true;
@@ -3400,51 +3715,81 @@ bool statHWE::apply(Population & pop) const
 #endif
 	// count for all specified subpopulations
 	size_t nLoci = loci.size();
-	GENOCNTLIST allGenoCnt(nLoci);
 	// selected (virtual) subpopulatons.
 	subPopList subPops = m_subPops.expandFrom(pop);
-	subPopList::const_iterator it = subPops.begin();
-	subPopList::const_iterator itEnd = subPops.end();
-	for (; it != itEnd; ++it) {
-		GENOCNTLIST genoCnt(nLoci);
+	size_t nSP = subPops.size();
+	DiploidLociCounts localCounts;
+	if (counts == NULL || !counts->covers(loci)) {
+		localCounts.count(pop, subPops, loci);
+		counts = &localCounts;
+	}
+	// genotype counts of each subpopulation, and of all subpopulations in the
+	// last row
+	vector<vectoru> genoCnt(nSP + 1, vectoru(nLoci * 3, 0));
+	vector<char> general(nLoci, 0);
+	for (size_t idx = 0; idx < nLoci; ++idx) {
+		size_t cntIdx = counts->index(loci[idx]);
+		general[idx] = counts->general(cntIdx);
+		for (size_t sp = 0; sp < nSP; ++sp) {
+			const size_t * cnt = counts->genoCnt(sp, cntIdx);
+			for (size_t i = 0; i < 3; ++i) {
+				genoCnt[sp][idx * 3 + i] = cnt[i];
+				genoCnt[nSP][idx * 3 + i] += cnt[i];
+			}
+		}
+	}
 
-		pop.activateVirtualSubPop(*it);
+	vector<vectorf> hwe(nSP + 1, vectorf(nLoci, 0));
+	for (size_t sp = 0; sp <= nSP; ++sp) {
+		if (sp < nSP ? !m_vars.contains(HWE_sp_String) : !m_vars.contains(HWE_String))
+			continue;
+		const vectoru & cnt = genoCnt[sp];
+		vectorf & pvalues = hwe[sp];
+#pragma omp parallel if(numThreads() > 1)
+		{
+			// tables of tail probabilities are cached by each thread
+			HWETestCache cache;
+#pragma omp for
+			for (ssize_t idx = 0; idx < static_cast<ssize_t>(nLoci); ++idx)
+				if (!general[idx])
+					pvalues[idx] = cache.pvalue(&cnt[idx * 3]);
+		}
+	}
 
-		IndIterator ind = pop.indIterator(it->subPop());
-		for (; ind.valid(); ++ind) {
-			GenoIterator geno1 = ind->genoBegin(0);
-			GenoIterator geno2 = ind->genoBegin(1);
-			for (size_t idx = 0; idx < nLoci; ++idx) {
-				Allele a1 = DEREF_ALLELE(geno1 + loci[idx]);
-				Allele a2 = DEREF_ALLELE(geno2 + loci[idx]);
+	// loci with alleles other than 0 and 1
+	for (size_t idx = 0; idx < nLoci; ++idx) {
+		if (!general[idx])
+			continue;
+		GENOCNT allCnt;
+		for (size_t sp = 0; sp < nSP; ++sp) {
+			GENOCNT cnt;
+			const vector<const Individual *> & inds = counts->individuals(sp);
+			for (size_t i = 0; i < inds.size(); ++i) {
+				Allele a1 = DEREF_ALLELE(inds[i]->genoBegin(0) + loci[idx]);
+				Allele a2 = DEREF_ALLELE(inds[i]->genoBegin(1) + loci[idx]);
 				if (a1 > a2)
 					std::swap(a1, a2);
-				genoCnt[idx][GENOCNT::key_type(a1, a2)]++;
+				cnt[GENOCNT::key_type(a1, a2)]++;
+				allCnt[GENOCNT::key_type(a1, a2)]++;
 			}
+			if (m_vars.contains(HWE_sp_String))
+				hwe[sp][idx] = hweTest(mapToCount(cnt));
 		}
-		pop.deactivateVirtualSubPop(it->subPop());
-		//
-		// output variable.
-		if (m_vars.contains(HWE_sp_String)) {
-			uintDict hwe;
-			for (size_t i = 0; i < loci.size(); ++i) {
-				hwe[loci[i]] = hweTest(mapToCount(genoCnt[i]));
-			}
-			pop.getVars().setVar(subPopVar_String(*it, HWE_String, m_suffix), hwe);
-		}
-		for (size_t idx = 0; idx < nLoci; ++idx) {
-			GENOCNT::const_iterator cnt = genoCnt[idx].begin();
-			GENOCNT::const_iterator cntEnd = genoCnt[idx].end();
-			for (; cnt != cntEnd; ++cnt)
-				allGenoCnt[idx][cnt->first] += cnt->second;
-		}
+		if (m_vars.contains(HWE_String))
+			hwe[nSP][idx] = hweTest(mapToCount(allCnt));
 	}
-	//
-	if (m_vars.contains(HWE_String)) {
-		uintDict hwe;
-		for (size_t i = 0; i < loci.size(); ++i)
-			hwe[loci[i]] = hweTest(mapToCount(allGenoCnt[i]));
-		pop.getVars().setVar(HWE_String + m_suffix, hwe);
+
+	// output variable.
+	for (size_t sp = 0; sp <= nSP; ++sp) {
+		if (sp < nSP ? !m_vars.contains(HWE_sp_String) : !m_vars.contains(HWE_String))
+			continue;
+		uintDict res;
+		for (size_t i = 0; i < nLoci; ++i)
+			res[loci[i]] = hwe[sp][i];
+		if (sp < nSP)
+			pop.getVars().setVar(subPopVar_String(subPops[sp], HWE_String, m_suffix), res);
+		else
+			pop.getVars().setVar(HWE_String + m_suffix, res);
 	}
 	return true;
 }
@@ -3480,7 +3825,7 @@ string statInbreeding::describe(bool /* format */) const
 }
 
 
-bool statInbreeding::apply(Population & pop) const
+bool statInbreeding::apply(Population & pop, const DiploidLociCounts * counts) const
 {
 	DBG_WARNIF(pop.ploidy() != 2,
 		"Statistics for inbreeding is currently only available for diploid populations.");
@@ -3489,107 +3834,68 @@ bool statInbreeding::apply(Population & pop) const
 		return true;
 
 	const vectoru & loci = m_loci.elems(&pop);
+	size_t nLoci = loci.size();
+
+#ifndef OPTIMIZED
+	for (size_t idx = 0; idx < nLoci; ++idx) {
+		size_t chromType = pop.chromType(pop.chromLocusPair(loci[idx]).first);
+		DBG_FAILIF(chromType == CHROMOSOME_X || chromType == CHROMOSOME_Y || chromType == MITOCHONDRIAL,
+			ValueError, "IBD/IBS count for sex and mitochondrial chromosomes is not supported.");
+	}
+#endif
 
 	// count for all specified subpopulations
-	uintDict allIBDCnt;
-	uintDict allIBSCnt;
+	vectoru allIBDCnt(nLoci, 0);
+	vectoru allIBSCnt(nLoci, 0);
 	size_t allCnt = 0;
 
 	// selected (virtual) subpopulatons.
 	subPopList subPops = m_subPops.expandFrom(pop);
+	// IBS and IBD are counted with genotypes in a single pass
+	DiploidLociCounts localCounts;
+	if (counts == NULL || !counts->covers(loci)) {
+		localCounts.count(pop, subPops, loci);
+		counts = &localCounts;
+	}
+	vectoru cntIdx(nLoci);
+	for (size_t idx = 0; idx < nLoci; ++idx)
+		cntIdx[idx] = counts->index(loci[idx]);
+
 	subPopList::const_iterator it = subPops.begin();
 	subPopList::const_iterator itEnd = subPops.end();
-	for (; it != itEnd; ++it) {
-		pop.activateVirtualSubPop(*it);
-
-		uintDict IBDCnt;
-		uintDict IBSCnt;
-
-#pragma omp parallel for if(numThreads() > 1)
-		for (ssize_t idx = 0; idx < static_cast<ssize_t>(loci.size()); ++idx) {
-			size_t loc = loci[idx];
-
-#ifndef OPTIMIZED
-			size_t chromType = pop.chromType(pop.chromLocusPair(loc).first);
-			DBG_FAILIF(chromType == CHROMOSOME_X || chromType == CHROMOSOME_Y || chromType == MITOCHONDRIAL,
-				ValueError, "IBD/IBS count for sex and mitochondrial chromosomes is not supported.");
-#endif
-			size_t IBD = 0;
-			size_t IBS = 0;
-
-			// go through all alleles
-			IndIterator ind = pop.indIterator(it->subPop());
-			for (; ind.valid(); ++ind) {
-				if (ind->allele(loc, 0) == ind->allele(loc, 1))
-					IBS += 1;
-#ifdef LINEAGE
-				if (ind->alleleLineage(loc, 0) == ind->alleleLineage(loc, 1))
-					IBD += 1;
-#endif
-			}
-#pragma omp critical
-			{
-				IBDCnt[loc] = static_cast<double>(IBD);
-				IBSCnt[loc] = static_cast<double>(IBS);
-				//
-				allIBDCnt[loc] += IBDCnt[loc];
-				allIBSCnt[loc] += IBSCnt[loc];
-			}
+	for (size_t spIdx = 0; it != itEnd; ++it, ++spIdx) {
+		vectoru IBDCnt(nLoci, 0);
+		vectoru IBSCnt(nLoci, 0);
+		for (size_t idx = 0; idx < nLoci; ++idx) {
+			IBDCnt[idx] = counts->IBDCnt(spIdx, cntIdx[idx]);
+			IBSCnt[idx] = counts->IBSCnt(spIdx, cntIdx[idx]);
+			allIBDCnt[idx] += IBDCnt[idx];
+			allIBSCnt[idx] += IBSCnt[idx];
 		}
-		//
-		pop.deactivateVirtualSubPop(it->subPop());
-		size_t cnt = pop.subPopSize(*it);
+		size_t cnt = counts->individuals(spIdx).size();
 		allCnt += cnt;
 		// output subpopulation variable?
 		if (m_vars.contains(IBD_freq_sp_String)) {
-			uintDict freq;
-			for (size_t idx = 0; idx < loci.size(); ++idx) {
-				size_t loc = loci[idx];
-				freq[loc] = cnt == 0. ? 0 : IBDCnt[loc] / static_cast<double>(cnt);
-			}
-			uintDict::const_iterator ct = freq.begin();
-			uintDict::const_iterator ct_end = freq.end();
-			for (; ct != ct_end; ++ct)
+			for (size_t idx = 0; idx < nLoci; ++idx)
 				pop.getVars().setVar((boost::format("%1%{%2%}") % subPopVar_String(*it, IBD_freq_String, m_suffix)
-					                  % ct->first).str(), ct->second);
+					                  % loci[idx]).str(), cnt == 0 ? 0. : IBDCnt[idx] / static_cast<double>(cnt));
 		}
 		if (m_vars.contains(IBS_freq_sp_String)) {
-			uintDict freq;
-			for (size_t idx = 0; idx < loci.size(); ++idx) {
-				size_t loc = loci[idx];
-				freq[loc] = cnt == 0. ? 0 : IBSCnt[loc] / static_cast<double>(cnt);
-			}
-			uintDict::const_iterator ct = freq.begin();
-			uintDict::const_iterator ct_end = freq.end();
-			for (; ct != ct_end; ++ct)
+			for (size_t idx = 0; idx < nLoci; ++idx)
 				pop.getVars().setVar((boost::format("%1%{%2%}") % subPopVar_String(*it, IBS_freq_String, m_suffix)
-					                  % ct->first).str(), ct->second);
+					                  % loci[idx]).str(), cnt == 0 ? 0. : IBSCnt[idx] / static_cast<double>(cnt));
 		}
 	}
 	// for whole population.
 	if (m_vars.contains(IBD_freq_String)) {
-		uintDict freq;
-		for (size_t idx = 0; idx < loci.size(); ++idx) {
-			size_t loc = loci[idx];
-			freq[loc] = allCnt == 0. ? 0 : allIBDCnt[loc] / static_cast<double>(allCnt);
-		}
-		uintDict::const_iterator ct = freq.begin();
-		uintDict::const_iterator ct_end = freq.end();
-		for (; ct != ct_end; ++ct)
-			pop.getVars().setVar((boost::format("%1%{%2%}") % (IBD_freq_String + m_suffix) % ct->first).str(),
-				ct->second);
+		for (size_t idx = 0; idx < nLoci; ++idx)
+			pop.getVars().setVar((boost::format("%1%{%2%}") % (IBD_freq_String + m_suffix) % loci[idx]).str(),
+				allCnt == 0 ? 0. : allIBDCnt[idx] / static_cast<double>(allCnt));
 	}
 	if (m_vars.contains(IBS_freq_String)) {
-		uintDict freq;
-		for (size_t idx = 0; idx < loci.size(); ++idx) {
-			size_t loc = loci[idx];
-			freq[loc] = allCnt == 0. ? 0 : allIBSCnt[loc] / static_cast<double>(allCnt);
-		}
-		uintDict::const_iterator ct = freq.begin();
-		uintDict::const_iterator ct_end = freq.end();
-		for (; ct != ct_end; ++ct)
-			pop.getVars().setVar((boost::format("%1%{%2%}") % (IBS_freq_String + m_suffix) % ct->first).str(),
-				ct->second);
+		for (size_t idx = 0; idx < nLoci; ++idx)
+			pop.getVars().setVar((boost::format("%1%{%2%}") % (IBS_freq_String + m_suffix) % loci[idx]).str(),
+				allCnt == 0 ? 0. : allIBSCnt[idx] / static_cast<double>(allCnt));
 	}
 
 	return true;
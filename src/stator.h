@@ -447,6 +447,104 @@ private:
 };
 
 
+/** CPPONLY Count genotypes of diploid individuals \e inds at \e loci in a
+ *  single pass, processing blocks of loci in parallel. Numbers of genotypes
+ *  00, 01 and 11 at each locus are added to \e genoCnt (three counts per
+ *  locus), and numbers of individuals with identical-by-state and
+ *  identical-by-descent (lineage modules only) alleles are added to
+ *  \e IBSCnt and \e IBDCnt. Loci with alleles other than 0 and 1 are
+ *  marked in \e general and their genotype counts are not reliable.
+ */
+void countDiploidLoci(const Population & pop, const vector<const Individual *> & inds,
+	const vectoru & loci, vectoru & genoCnt, vectoru & IBSCnt, vectoru & IBDCnt,
+	vector<char> & general);
+
+/** CPPONLY Genotype counts of diploid individuals in each of a list of
+ *  (virtual) subpopulations at a set of loci, collected by
+ *  \c countDiploidLoci in a single sweep so that they can be shared by all
+ *  statistics calculated by a \c Stat operator.
+ */
+class DiploidLociCounts
+{
+public:
+	DiploidLociCounts() : m_loci(), m_inds(), m_genoCnt(), m_IBSCnt(), m_IBDCnt(),
+		m_general(), m_anyGeneral()
+	{
+	}
+
+
+	/// count genotypes at \e loci in (expanded) \e subPops
+	void count(Population & pop, const subPopList & subPops, const vectoru & loci);
+
+	/// return \c true if no genotype is counted
+	bool empty() const
+	{
+		return m_inds.empty();
+	}
+
+
+	/// return \c true if genotypes at all \e loci are counted
+	bool covers(const vectoru & loci) const;
+
+	/// index of locus \e loc in the counts, which should be covered
+	size_t index(size_t loc) const
+	{
+		return std::lower_bound(m_loci.begin(), m_loci.end(), loc) - m_loci.begin();
+	}
+
+
+	/// individuals in the \e sp-th (virtual) subpopulation
+	const vector<const Individual *> & individuals(size_t sp) const
+	{
+		return m_inds[sp];
+	}
+
+
+	/// numbers of genotypes 00, 01 and 11 at the \e idx-th locus
+	const size_t * genoCnt(size_t sp, size_t idx) const
+	{
+		return &m_genoCnt[sp][idx * 3];
+	}
+
+
+	size_t IBSCnt(size_t sp, size_t idx) const
+	{
+		return m_IBSCnt[sp][idx];
+	}
+
+
+	size_t IBDCnt(size_t sp, size_t idx) const
+	{
+		return m_IBDCnt[sp][idx];
+	}
+
+
+	/// if there are alleles other than 0 and 1 at the \e idx-th locus
+	bool general(size_t sp, size_t idx) const
+	{
+		return m_general[sp][idx] != 0;
+	}
+
+
+	/// if there are alleles other than 0 and 1 at the \e idx-th locus in any
+	/// of the (virtual) subpopulations
+	bool general(size_t idx) const
+	{
+		return m_anyGeneral[idx] != 0;
+	}
+
+
+private:
+	vectoru m_loci;
+	vector<vector<const Individual *> > m_inds;
+	vector<vectoru> m_genoCnt;
+	vector<vectoru> m_IBSCnt;
+	vector<vectoru> m_IBDCnt;
+	vector<vector<char> > m_general;
+	vector<char> m_anyGeneral;
+};
+
+
 /// CPPONLY
 class statAlleleFreq
 {
@@ -472,7 +570,15 @@ public:
 	}
 
 
-	bool apply(Population & pop) const;
+	/// loci at which statistics are calculated
+	const lociList & loci() const
+	{
+		return m_loci;
+	}
+
+
+	/// calculate statistics, using genotype counts in \e counts if available
+	bool apply(Population & pop, const DiploidLociCounts * counts = NULL) const;
 
 private:
 	/// which alleles?
@@ -503,7 +609,15 @@ public:
 
 	string describe(bool format = true) const;
 
-	bool apply(Population & pop) const;
+	/// loci at which statistics are calculated
+	const lociList & loci() const
+	{
+		return m_loci;
+	}
+
+
+	/// calculate statistics, using genotype counts in \e counts if available
+	bool apply(Population & pop, const DiploidLociCounts * counts = NULL) const;
 
 private:
 	/// heteroFreq
@@ -761,6 +875,19 @@ private:
 	double armitageTest(const GENOCNT & caseCnt,
 		const GENOCNT & controlCnt) const;
 
+	/// chi-square test of \e n allele or genotype counts of cases and controls
+	void denseChiSqTest(const size_t * caseCnt, const size_t * controlCnt,
+		size_t n, double & chisq, double & chisq_p) const;
+
+	/// Armitage test of genotype counts (00, 01, 11) of cases and controls
+	double denseArmitageTest(const size_t * caseCnt, const size_t * controlCnt) const;
+
+	/// count alleles and genotypes of individuals \e inds at \e loc
+	void countLocus(const Population & pop, const vector<const Individual *> & inds,
+		size_t loc, size_t chromType, bool countAllele, bool countGeno,
+		ALLELECNT & caseAlleleCnt, ALLELECNT & ctrlAlleleCnt,
+		GENOCNT & caseGenoCnt, GENOCNT & ctrlGenoCnt) const;
+
 private:
 	/// Association
 	lociList m_loci;
@@ -820,7 +947,15 @@ public:
 
 	string describe(bool format = true) const;
 
-	bool apply(Population & pop) const;
+	/// loci at which statistics are calculated
+	const lociList & loci() const
+	{
+		return m_loci;
+	}
+
+
+	/// calculate statistics, using genotype counts in \e counts if available
+	bool apply(Population & pop, const DiploidLociCounts * counts = NULL) const;
 
 private:
 	typedef map<size_t, float> FREQ;
@@ -864,7 +999,15 @@ public:
 
 	string describe(bool format = true) const;
 
-	bool apply(Population & pop) const;
+	/// loci at which statistics are calculated
+	const lociList & loci() const
+	{
+		return m_loci;
+	}
+
+
+	/// calculate statistics, using genotype counts in \e counts if available
+	bool apply(Population & pop, const DiploidLociCounts * counts = NULL) const;
 
 private:
 	vectoru mapToCount(const GENOCNT & cnt) const;
@@ -892,7 +1035,15 @@ public:
 
 	string describe(bool format = true) const;
 
-	bool apply(Population & pop) const;
+	/// loci at which statistics are calculated
+	const lociList & loci() const
+	{
+		return m_loci;
+	}
+
+
+	/// calculate statistics, using genotype counts in \e counts if available
+	bool apply(Population & pop, const DiploidLociCounts * counts = NULL) const;
 
 private:
 	lociList m_loci;
@@ -58,14 +58,34 @@ bool IdTagger::apply(Population & pop) const
 	size_t curGen = pop.curAncestralGen();
 	for (int depth = pop.ancestralGens(); depth >= 0; --depth) {
 		pop.useAncestralGen(depth);
-		for (size_t i = 0, iEnd = pop.popSize(); i < iEnd; ++i)
-			pop.individual(i).setInfo(static_cast<double>(g_indID++), idx);
+		const ssize_t popSize = static_cast<ssize_t>(pop.popSize());
+		const ATOMICLONG startID = fetchAndAdd(&g_indID, popSize);
+#pragma omp parallel for if(numThreads() > 1)
+		for (ssize_t i = 0; i < popSize; ++i)
+			pop.individual(static_cast<size_t>(i)).setInfo(static_cast<double>(startID + i), idx);
 	}
 	pop.useAncestralGen(curGen);
 	return true;
 }
 
 
+void IdTagger::prepareDuringMating(Population & /* pop */, Population & offPop,
+                                   RawIndIterator offBegin, RawIndIterator offEnd) const
+{
+	// IDs are assigned one by one if only some of the offspring are tagged.
+	if (!applicableToAllOffspring() || offEnd <= offBegin) {
+		m_offPop = NULL;
+		return;
+	}
+	// A single atomic update of the global ID for all offspring in the
+	// range, which are then tagged by their positions without contention.
+	m_offPop = &offPop;
+	m_blockBegin = offBegin - offPop.rawIndBegin();
+	m_blockEnd = offEnd - offPop.rawIndBegin();
+	m_blockID = fetchAndAdd(&g_indID, static_cast<ATOMICLONG>(m_blockEnd - m_blockBegin));
+}
+
+
 bool IdTagger::applyDuringMating(Population & pop, Population & offPop, RawIndIterator offspring,
                                  Individual * dad, Individual * mom) const
 {
@@ -74,18 +94,21 @@ bool IdTagger::applyDuringMating(Population & pop, Population & offPop, RawIndIt
 		return true;
 	size_t idx = pop.infoIdx(infoField(0));
 
+	ATOMICLONG id = 0;
+	size_t pos = offspring - offPop.rawIndBegin();
+	if (m_offPop == &offPop && pos >= m_blockBegin && pos < m_blockEnd)
+		// an offspring that is regenerated keeps the ID of its slot
+		id = m_blockID + static_cast<ATOMICLONG>(pos - m_blockBegin);
+	else
+		id = fetchAndIncrement(&g_indID);
+
 	(void)dad;  // avoid a warning message in optimized modules
 	(void)mom;  // avoid a warning message in optimized modules
-	DBG_FAILIF(dad != NULL && dad->info(idx) >= g_indID, RuntimeError,
+	DBG_FAILIF(dad != NULL && dad->info(idx) >= id, RuntimeError,
 		"Paternal ID is larger than or equal to offspring ID (wrong startID?).");
-	DBG_FAILIF(mom != NULL && mom->info(idx) >= g_indID, RuntimeError,
+	DBG_FAILIF(mom != NULL && mom->info(idx) >= id, RuntimeError,
 		"Matental ID is larger than or equal to offspring ID (wrong startID?).");
-#ifdef _OPENMP
-	ATOMICLONG id = fetchAndIncrement(&g_indID);
-	offspring->setInfo(static_cast<long>(id), idx);
-#else
-	offspring->setInfo(static_cast<long>(g_indID++), idx);
-#endif
+	offspring->setInfo(static_cast<double>(id), idx);
 	return true;
 }
 
@@ -46,10 +46,13 @@ namespace simuPOP {
  *  of any \c IdTagger.
  *
  *  An \c IdTagger is usually used during-mating to assign ID to each offspring.
- *  However, if it is applied directly to a population, it will assign unique
- *  IDs to all individuals in this population. This property is usually used
- *  in the \c preOps parameter of function \c Simulator.evolve to assign
- *  initial ID to a population.
+ *  IDs are reserved in blocks for all offspring of a subpopulation so that
+ *  offspring of a subpopulation receive consecutive IDs, in the order they
+ *  are stored, regardless of the number of threads used. However, if it is
+ *  applied directly to a population, it will assign unique IDs to all
+ *  individuals in this population. This property is usually used in the
+ *  \c preOps parameter of function \c Simulator.evolve to assign initial ID
+ *  to a population.
  */
 class IdTagger : public BaseOperator
 {
@@ -65,12 +68,19 @@ public:
 		const intList & at = vectori(), const intList & reps = intList(),
 		const subPopList & subPops = subPopList(), const stringFunc & output = "",
 		const stringList & infoFields = vectorstr(1, "ind_id")) :
-		BaseOperator(output, begin, end, step, at, reps, subPops, infoFields)
+		BaseOperator(output, begin, end, step, at, reps, subPops, infoFields),
+		m_offPop(NULL), m_blockBegin(0), m_blockEnd(0), m_blockID(0)
 	{
 		DBG_FAILIF(infoFields.elems().size() != 1, ValueError,
 			"One and only one information field is needed for IdTagger.");
 	};
 
+	/// CPPONLY a copy does not share the IDs reserved by \e rhs
+	IdTagger(const IdTagger & rhs) :
+		BaseOperator(rhs), m_offPop(NULL), m_blockBegin(0), m_blockEnd(0), m_blockID(0)
+	{
+	}
+
 	virtual ~IdTagger()
 	{
 	}
@@ -94,6 +104,12 @@ public:
 	bool applyDuringMating(Population & pop, Population & offPop, RawIndIterator offspring,
 		Individual * dad = NULL, Individual * mom = NULL) const;
 
+	/** CPPONLY
+	 *  reserve a block of IDs for offspring from \e offBegin to \e offEnd
+	 */
+	void prepareDuringMating(Population & pop, Population & offPop,
+		RawIndIterator offBegin, RawIndIterator offEnd) const;
+
 	/// HIDDEN Deep copy of an \c IdTagger
 	virtual BaseOperator * clone() const
 	{
@@ -108,6 +124,13 @@ public:
 	}
 
 
+private:
+	/// offspring population and range of offspring for which IDs are reserved
+	mutable const Population * m_offPop;
+	mutable size_t m_blockBegin;
+	mutable size_t m_blockEnd;
+	/// ID of the first offspring in the reserved block
+	mutable ATOMICLONG m_blockID;
 };
 
 
@@ -27,6 +27,7 @@
 
 using std::min;
 using std::max;
+using std::make_pair;
 
 namespace simuPOP {
 
@@ -156,6 +157,56 @@ void GenoTransmitter::copyChromosomes(const Individual & parent,
 }
 
 
+void GenoTransmitter::copyLoci(const Individual & parent, int parPloidy,
+                               Individual & offspring, int ploidy, size_t begin, size_t end) const
+{
+	if (begin >= end)
+		return;
+#ifdef BINARYALLELE
+	copyGenotype(parent.genoBegin(parPloidy) + begin, offspring.genoBegin(ploidy) + begin, end - begin);
+#else
+#  ifdef MUTANTALLELE
+	copyGenotype(parent.genoBegin(parPloidy) + begin, parent.genoBegin(parPloidy) + end,
+		offspring.genoBegin(ploidy) + begin);
+#  else
+	copy(parent.genoBegin(parPloidy) + begin, parent.genoBegin(parPloidy) + end,
+		offspring.genoBegin(ploidy) + begin);
+#  endif
+#endif
+	LINEAGE_EXPR(copy(parent.lineageBegin(parPloidy) + begin, parent.lineageBegin(parPloidy) + end,
+			offspring.lineageBegin(ploidy) + begin));
+}
+
+
+void GenoTransmitter::clearLoci(const Individual & ind, int ploidy, size_t begin, size_t end) const
+{
+	if (begin >= end)
+		return;
+#ifdef BINARYALLELE
+	clearGenotype(ind.genoBegin(ploidy) + begin, end - begin);
+#else
+#  ifdef MUTANTALLELE
+	clearGenotype(ind.genoBegin(ploidy) + begin, ind.genoBegin(ploidy) + end);
+#  else
+	fill(ind.genoBegin(ploidy) + begin, ind.genoBegin(ploidy) + end, 0);
+#  endif
+#endif
+	LINEAGE_EXPR(fill(ind.lineageBegin(ploidy) + begin, ind.lineageBegin(ploidy) + end, 0));
+}
+
+
+void GenoTransmitter::recordChromosomes(Genealogy & genealogy, const Individual & parent,
+                                        int parPloidy, size_t offIdx, int ploidy) const
+{
+	if (m_hasCustomizedChroms) {
+		for (size_t ch = 0; ch < m_lociToCopy.size(); ++ch)
+			if (m_lociToCopy[ch] > 0)
+				genealogy.addEdge(parent, parPloidy, offIdx, ploidy, m_chromIdx[ch], m_chromIdx[ch + 1]);
+	} else
+		genealogy.addEdge(parent, parPloidy, offIdx, ploidy, 0, m_chromIdx.back());
+}
+
+
 string CloneGenoTransmitter::describe(bool /* format */) const
 {
 	return "<simuPOP.CloneGenoTransmitter> clone genotype, sex and information fields of parent to offspring" ;
@@ -244,6 +295,18 @@ bool CloneGenoTransmitter::applyDuringMating(Population & pop, Population & offP
 #endif
 		LINEAGE_EXPR(copy(parent->lineageBegin(), parent->lineageEnd(), offspring->lineageBegin()));
 	}
+	Genealogy * genealogy = pop.genealogyRecorder();
+	if (genealogy) {
+		size_t offIdx = offspring - offPop.rawIndBegin();
+		for (size_t p = 0; p != m_ploidy; ++p) {
+			if (!m_chroms.allAvail()) {
+				const vectoru chroms = m_chroms.elems();
+				for (size_t i = 0; i < chroms.size(); ++i)
+					genealogy->addEdge(*parent, p, offIdx, p, m_chromIdx[chroms[i]], m_chromIdx[chroms[i] + 1]);
+			} else
+				recordChromosomes(*genealogy, *parent, p, offIdx, p);
+		}
+	}
 	// for clone transmitter, sex is also transmitted
 	offspring->setSex(parent->sex());
 	offspring->setAffected(parent->affected());
@@ -267,109 +330,90 @@ void MendelianGenoTransmitter::initialize(const Individual & ind) const
 	m_chromY = ind.chromY();
 	m_mitochondrial = ind.mitochondrial();
 	m_numChrom = ind.numChrom();
+	// Plans for maternal and paternal chromosomes of male and female
+	// offspring. Chromosomes with fixed origin, or that are cleared, are
+	// merged with adjacent ones so that they can be handled in blocks.
+	m_plans.resize(4);
+	for (int ploidy = 0; ploidy < 2; ++ploidy) {
+		for (int female = 0; female < 2; ++female) {
+			TransmissionPlan & plan = m_plans[ploidy * 2 + female];
+			plan.clear();
+			for (int ch = 0; static_cast<size_t>(ch) < m_numChrom; ++ch) {
+				// customized chromosome?
+				if (m_lociToCopy[ch] == 0)
+					continue;
+				TransmissionSegment seg;
+				seg.begin = m_chromIdx[ch];
+				seg.end = m_chromIdx[ch + 1];
+				if ((ploidy == 0 && ch == m_chromY) ||   // maternal, Y chromosome
+				    (ploidy == 1 &&
+				     ((ch == m_chromX && !female) ||
+				      (ch == m_chromY && female) ||
+				      (ch == m_mitochondrial))))
+					seg.parPloidy = -2;
+				else if (ploidy == 1 && ch == m_chromX)
+					seg.parPloidy = 0;
+				else if (ploidy == 1 && ch == m_chromY)
+					seg.parPloidy = 1;          // copy chrom Y from second ploidy
+				else
+					seg.parPloidy = -1;
+				if (seg.parPloidy != -1 && !plan.empty() && plan.back().parPloidy == seg.parPloidy
+				    && plan.back().end == seg.begin)
+					plan.back().end = seg.end;
+				else
+					plan.push_back(seg);
+			}
+		}
+	}
 }
 
 
 void MendelianGenoTransmitter::transmitGenotype(const Individual & parent,
                                                 Individual & offspring, int ploidy) const
 {
-	initializeIfNeeded(offspring);
-
-	// current parental ploidy (copy from which chromosome copy)
-	int parPloidy = 0;
+	transmitGenotype(parent, offspring, ploidy, NULL, 0);
+}
 
-#ifdef BINARYALLELE
-	// for the simple case, use faster algorithm
-	if (m_chromX < 0 && m_chromY < 0 && !m_hasCustomizedChroms) {
-		// pointer to parental, and offspring chromosome copies
-		GenoIterator par[2];
-		GenoIterator off;
-#  ifdef LINEAGE
-		LineageIterator parLineage[2];
-		LineageIterator offLineage;
-#  endif
 
-		//
-		par[0] = parent.genoBegin(0);
-		par[1] = parent.genoBegin(1);
-		off = offspring.genoBegin(ploidy);
-#  ifdef LINEAGE
-		parLineage[0] = parent.lineageBegin(0);
-		parLineage[1] = parent.lineageBegin(1);
-		offLineage = offspring.lineageBegin(ploidy);
-#  endif
+void MendelianGenoTransmitter::transmitGenotype(const Individual & parent,
+                                                Individual & offspring, int ploidy, Genealogy * genealogy, size_t offIdx) const
+{
+	initializeIfNeeded(offspring);
 
-		//
-		//
-		// 1. try to copy in blocks,
-		// 2. if two chromosomes can be copied together, copy together
-		// 3. if length is short, using the old method.
-		//
-		size_t parBegin = 0;
-		size_t parEnd = 0;
-		// first chromosome
-		parPloidy = getRNG().randBit();
-		//
-		int nextParPloidy = 0;
-		bool copyPar;
-		for (size_t ch = 0; ch < m_numChrom; ++ch) {
-			// if it is the last chromosome, copy anyway
-			if (ch == m_numChrom - 1)
-				copyPar = true;
-			else {                                                                 // is there a different chromosome?
-				nextParPloidy = getRNG().randBit();
-				copyPar = parPloidy != nextParPloidy;
-			}
-			if (copyPar) {
-				// end of this chromosome, is the beginning of the next
-				parEnd = m_chromIdx[ch + 1];
-				size_t length = parEnd - parBegin;
-				//
-				// the easiest case, try to get some speed up...
-				if (length == 1) {
-					off[parBegin] = par[parPloidy][parBegin];
-					LINEAGE_EXPR(offLineage[parBegin] = parLineage[parPloidy][parBegin]);
-				} else {
-					copyGenotype(par[parPloidy] + parBegin, off + parBegin, length);
-					LINEAGE_EXPR(copy(parLineage[parPloidy] + parBegin,
-							parLineage[parPloidy] + parBegin + length,
-							offLineage + parBegin));
-				}
-				//
-				if (ch != m_numChrom - 1)
-					parPloidy = nextParPloidy;
-				parBegin = parEnd;
-			}
-		}
-		return;
-	}
-#endif
-	//
-	for (int ch = 0; static_cast<size_t>(ch) < m_numChrom; ++ch) {
-		// customized chromosome?
-		if (m_lociToCopy[ch] == 0)
+	const TransmissionPlan & plan = transmissionPlan(ploidy, offspring);
+	// copy adjacent segments from the same parental copy in blocks
+	size_t blockBegin = 0;
+	size_t blockEnd = 0;
+	int blockPloidy = -1;
+	for (size_t i = 0; i < plan.size(); ++i) {
+		const TransmissionSegment & seg = plan[i];
+		if (seg.parPloidy == -2) {
+			clearLoci(offspring, ploidy, seg.begin, seg.end);
 			continue;
-		if ((ploidy == 0 && ch == m_chromY) ||   // maternal, Y chromosome
-		    (ploidy == 1 &&
-		     ((ch == m_chromX && offspring.sex() == MALE) ||
-		      (ch == m_chromY && offspring.sex() == FEMALE) ||
-		      (ch == m_mitochondrial)))) {
-			clearChromosome(offspring, ploidy, ch);
+		}
+		int parPloidy = seg.parPloidy == -1 ? static_cast<int>(getRNG().randBit()) : seg.parPloidy;
+		if (parPloidy == blockPloidy && seg.begin == blockEnd) {
+			blockEnd = seg.end;
 			continue;
 		}
-		if (ploidy == 1 && ch == m_chromX)
-			parPloidy = 0;
-		else if (ploidy == 1 && ch == m_chromY)
-			parPloidy = 1;          // copy chrom Y from second ploidy
-		else
-			parPloidy = getRNG().randBit();
-		//
-		copyChromosome(parent, parPloidy, offspring, ploidy, ch);
+		if (blockPloidy != -1) {
+			copyLoci(parent, blockPloidy, offspring, ploidy, blockBegin, blockEnd);
+			if (genealogy)
+				genealogy->addEdge(parent, blockPloidy, offIdx, ploidy, blockBegin, blockEnd);
+		}
+		blockBegin = seg.begin;
+		blockEnd = seg.end;
+		blockPloidy = parPloidy;
+	}
+	if (blockPloidy != -1) {
+		copyLoci(parent, blockPloidy, offspring, ploidy, blockBegin, blockEnd);
+		if (genealogy)
+			genealogy->addEdge(parent, blockPloidy, offIdx, ploidy, blockBegin, blockEnd);
 	}
 }
 
 
-bool MendelianGenoTransmitter::applyDuringMating(Population & /* pop */,
+bool MendelianGenoTransmitter::applyDuringMating(Population & pop,
                                                  Population & offPop, RawIndIterator offspring,
                                                  Individual * dad, Individual * mom) const
 {
@@ -383,14 +427,16 @@ bool MendelianGenoTransmitter::applyDuringMating(Population & /* pop */,
 		"Mendelian genotype transmitter only works for diploid individuals.");
 
 	initializeIfNeeded(*offspring);
+	Genealogy * genealogy = pop.genealogyRecorder();
+	size_t offIdx = genealogy ? offspring - offPop.rawIndBegin() : 0;
 	// the next two functions.
-	transmitGenotype(*mom, *offspring, 0);
-	transmitGenotype(*dad, *offspring, 1);
+	transmitGenotype(*mom, *offspring, 0, genealogy, offIdx);
+	transmitGenotype(*dad, *offspring, 1, genealogy, offIdx);
 	return true;
 }
 
 
-bool SelfingGenoTransmitter::applyDuringMating(Population & /* pop */, Population & offPop, RawIndIterator offspring,
+bool SelfingGenoTransmitter::applyDuringMating(Population & pop, Population & offPop, RawIndIterator offspring,
                                                Individual * dad, Individual * mom) const
 {
 	// if offspring does not belong to subPops, do nothing, but does not fail.
@@ -407,9 +453,11 @@ bool SelfingGenoTransmitter::applyDuringMating(Population & /* pop */, Populatio
 	Individual * parent = mom != NULL ? mom : dad;
 
 	initializeIfNeeded(*offspring);
+	Genealogy * genealogy = pop.genealogyRecorder();
+	size_t offIdx = genealogy ? offspring - offPop.rawIndBegin() : 0;
 	// use the same parent to produce two copies of chromosomes
-	transmitGenotype(*parent, *offspring, 0);
-	transmitGenotype(*parent, *offspring, 1);
+	transmitGenotype(*parent, *offspring, 0, genealogy, offIdx);
+	transmitGenotype(*parent, *offspring, 1, genealogy, offIdx);
 	return true;
 }
 
@@ -422,7 +470,7 @@ void HaplodiploidGenoTransmitter::initialize(const Individual & ind) const
 }
 
 
-bool HaplodiploidGenoTransmitter::applyDuringMating(Population & /* pop */,
+bool HaplodiploidGenoTransmitter::applyDuringMating(Population & pop,
                                                     Population & offPop, RawIndIterator offspring,
                                                     Individual * dad, Individual * mom) const
 {
@@ -433,11 +481,16 @@ bool HaplodiploidGenoTransmitter::applyDuringMating(Population & /* pop */,
 		"haplodiploid offspring generator: one of the parents is invalid.");
 
 	initializeIfNeeded(*offspring);
+	Genealogy * genealogy = pop.genealogyRecorder();
+	size_t offIdx = genealogy ? offspring - offPop.rawIndBegin() : 0;
 	// mom generate the first...
-	transmitGenotype(*mom, *offspring, 0);
+	transmitGenotype(*mom, *offspring, 0, genealogy, offIdx);
 
-	if (offspring->sex() == FEMALE)
+	if (offspring->sex() == FEMALE) {
 		copyChromosomes(*dad, 0, *offspring, 1);
+		if (genealogy)
+			recordChromosomes(*genealogy, *dad, 0, offIdx, 1);
+	}
 	return true;
 }
 
@@ -702,6 +755,83 @@ void Recombinator::initialize(const Individual & ind) const
 	//DBG_DO(DBG_TRANSMITTER, cerr	<< "Specify after Loci. With m_rates "
 	//	                            << vecP << " before " << m_recBeforeLoci << endl);
 
+	// handling of sex chromosomes, by specifying chromsome ranges that
+	// are ignored, copied with specified ploidy, or cleared, for each
+	// ploidy and sex of offspring.
+	size_t gtEnd = m_recBeforeLoci.empty() ? 0 : m_recBeforeLoci.back();
+	m_plans.resize(4);
+	for (int ploidy = 0; ploidy < 2; ++ploidy) {
+		for (int female = 0; female < 2; ++female) {
+			TransmissionPlan & plan = m_plans[ploidy * 2 + female];
+			plan.copied.clear();
+			plan.forced.clear();
+			plan.cleared[0].clear();
+			plan.cleared[1].clear();
+
+			vector<pair<size_t, size_t> > excluded;
+			ForcedRange forced;
+			forced.parPloidy = -1;
+			// from maternal, ignore chromosome Y
+			if (ploidy == 0 && m_chromY > 0) {
+				excluded.push_back(make_pair(ind.chromBegin(m_chromY), ind.chromEnd(m_chromY)));
+			} else if (ploidy == 1 && m_chromX > 0) {
+				if (!female) {
+					// for male
+					//
+					// xxxxxxxxxxxx
+					//             yyyyyyyyyyy  <- 1
+					//
+					excluded.push_back(make_pair(ind.chromBegin(m_chromX), ind.chromEnd(m_chromX)));
+					if (m_chromY > 0) {
+						forced.begin = ind.chromBegin(m_chromY);
+						forced.end = ind.chromEnd(m_chromY);
+						forced.parPloidy = 1;
+					}
+				} else {
+					// for female
+					//
+					// xxxxxxxxxxxx
+					// xxxxxxxxxxxx
+					if (m_chromY > 0)
+						excluded.push_back(make_pair(ind.chromBegin(m_chromY), ind.chromEnd(m_chromY)));
+					forced.begin = ind.chromBegin(m_chromX);
+					forced.end = ind.chromEnd(m_chromX);
+					forced.parPloidy = 0;
+				}
+			}
+			if (forced.parPloidy >= 0) {
+				// recombination points in the forced region
+				forced.firstPoint = lower_bound(m_recBeforeLoci.begin(), m_recBeforeLoci.end(),
+					forced.begin) - m_recBeforeLoci.begin();
+				forced.endPoint = lower_bound(m_recBeforeLoci.begin(), m_recBeforeLoci.end(),
+					forced.end) - m_recBeforeLoci.begin();
+				plan.forced.push_back(forced);
+			}
+			// do not copy genotype in the ignored and customized regions
+			if (m_customizedBegin >= 0)
+				excluded.push_back(make_pair(static_cast<size_t>(m_customizedBegin),
+						static_cast<size_t>(m_customizedEnd)));
+			sort(excluded.begin(), excluded.end());
+			size_t pos = 0;
+			for (size_t i = 0; i < excluded.size(); ++i) {
+				size_t end = min(excluded[i].first, gtEnd);
+				if (end > pos)
+					plan.copied.push_back(make_pair(pos, end));
+				pos = max(pos, excluded[i].second);
+			}
+			if (pos < gtEnd)
+				plan.copied.push_back(make_pair(pos, gtEnd));
+			// clear special chromosomes after transmission
+			if (m_chromX > 0 && !female)
+				plan.cleared[1].push_back(make_pair(ind.chromBegin(m_chromX), ind.chromEnd(m_chromX)));
+			if (m_chromY > 0) {
+				plan.cleared[0].push_back(make_pair(ind.chromBegin(m_chromY), ind.chromEnd(m_chromY)));
+				if (female)
+					plan.cleared[1].push_back(make_pair(ind.chromBegin(m_chromY), ind.chromEnd(m_chromY)));
+			}
+		}
+	}
+
 	if (vecP.empty())
 		return;
 
@@ -765,8 +895,8 @@ void Recombinator::initialize(const Individual & ind) const
 }
 
 
-void Recombinator::transmitGenotype(const Individual & parent,
-                                    Individual & offspring, int ploidy) const
+int Recombinator::transmitSegments(const Individual & parent,
+                                   Individual & offspring, int ploidy, vectoru * breaks) const
 {
 	initializeIfNeeded(offspring);
 
@@ -792,54 +922,17 @@ void Recombinator::transmitGenotype(const Individual & parent,
 	lineageOff = offspring.lineageBegin(ploidy);
 #endif
 
-	// handling of sex chromosomes, by specifying chromsome
-	// ranges with specified ploidy.
-	int ignoreBegin = -1;
-	int ignoreEnd = -1;
-	int forceFirstBegin = -1;
-	int forceFirstEnd = -1;
-	int forceSecondBegin = -1;
-	int forceSecondEnd = -1;
-
-	// from maternal, ignore chromosome Y
-	if (ploidy == 0 && m_chromY > 0) {
-		ignoreBegin = static_cast<int>(parent.chromBegin(m_chromY));
-		ignoreEnd = static_cast<int>(parent.chromEnd(m_chromY));
-	} else if (ploidy == 1 && m_chromX > 0) {
-		if (offspring.sex() == MALE) {
-			// for male
-			//
-			// xxxxxxxxxxxx
-			//             yyyyyyyyyyy  <- 1
-			//
-			ignoreBegin = static_cast<int>(parent.chromBegin(m_chromX));
-			ignoreEnd = static_cast<int>(parent.chromEnd(m_chromX));
-			if (m_chromY > 0) {
-				forceSecondBegin = static_cast<int>(parent.chromBegin(m_chromY));
-				forceSecondEnd = static_cast<int>(parent.chromEnd(m_chromY));
-			}
-		} else {
-			// for female
-			//
-			// xxxxxxxxxxxx
-			// xxxxxxxxxxxx
-			if (m_chromY > 0) {
-				ignoreBegin = static_cast<int>(parent.chromBegin(m_chromY));
-				ignoreEnd = static_cast<int>(parent.chromEnd(m_chromY));
-			}
-			forceFirstBegin = static_cast<int>(parent.chromBegin(m_chromX));
-			forceFirstEnd = static_cast<int>(parent.chromEnd(m_chromX));
-		}
-	}
+	const TransmissionPlan & plan = m_plans[ploidy * 2 + (offspring.sex() == FEMALE ? 1 : 0)];
 	// get a new set of values.
 	// const BoolResults& bs = bt.trial();
 	if (m_algorithm != 2)
 		bt.trial();
 	int curCp = m_algorithm == 2 ? getRNG().randBit() : (bt.trialSucc(m_recBeforeLoci.size() - 1) ? 0 : 1);
-	curCp = forceFirstBegin == 0 ? 0 : (forceSecondBegin == 0 ? 1 : curCp);
+	for (size_t i = 0; i < plan.forced.size(); ++i)
+		if (plan.forced[i].begin == 0)
+			curCp = plan.forced[i].parPloidy;
 
-	if (m_debugOutput)
-		*m_debugOutput << offspring.intInfo(infoField(0)) << ' ' << parent.intInfo(infoField(0)) << ' ' << curCp;
+	int startCp = curCp;
 
 	// the last one does not count, because it determines
 	// the initial copy of paternal chromosome
@@ -848,93 +941,94 @@ void Recombinator::transmitGenotype(const Individual & parent,
 
 	// algorithm one:
 	//
-	//  gt: index on chromosomes
-	//  gtEnd: total number of loci
-	//
-	//  at each locus, check if recombine after it, if so
-	//  recombine.
+	//  go through recombination points with successful trials, and
+	//  copy loci between them according to the transmission plan.
 	bool withConversion = static_cast<int>(m_convMode[0]) != NO_CONVERSION
 	                      && m_convMode[1] > 0.;
-#ifdef MUTANTALLELE
-	size_t last_gt = 0;
-	int last_cp = curCp;
-	size_t to_next = 0;
-#endif
 	if (m_algorithm == 0) {
-		// negative means no conversion is pending.
-		ssize_t convCount = -1;
+		// Loci are copied in blocks between points at which the copy of
+		// parental chromosomes changes, namely recombination points, ends of
+		// conversions, and the beginning of forced regions.
 		size_t gtEnd = m_recBeforeLoci.back();
-		for (size_t gt = 0, bl = 0; gt < gtEnd; ++gt, --convCount) {
-			// do not copy genotype in the ignored region.
-			if ((ignoreBegin < 0 || gt < static_cast<size_t>(ignoreBegin) || gt >= static_cast<size_t>(ignoreEnd)) &&
-			    (m_customizedBegin < 0 || gt < static_cast<size_t>(m_customizedBegin) || gt >= static_cast<size_t>(m_customizedEnd))) {
-				// copy
-#ifdef MUTANTALLELE
-				if (curCp != last_cp || gt >= last_gt + to_next) {
-					(off + gt).assignIfDiffer((cp[curCp] + gt).value());
-					last_cp = curCp;
-					last_gt = gt;
-					to_next = min((cp[curCp] + gt).to_next(), (off + gt).to_next());
+		size_t nPoints = m_recBeforeLoci.size();
+		// beginning of loci that have not been copied
+		size_t runBegin = 0;
+		// end of a pending conversion, 0 means no conversion is pending.
+		size_t convEnd = 0;
+		// recombination points before bl have been handled
+		size_t bl = 0;
+		// next forced region
+		size_t fr = 0;
+		while (true) {
+			// index of the first recombination point in the next forced region
+			while (fr < plan.forced.size() && (plan.forced[fr].firstPoint < bl ||
+			                                   plan.forced[fr].firstPoint >= plan.forced[fr].endPoint))
+				++fr;
+			size_t fp = fr < plan.forced.size() ? plan.forced[fr].firstPoint : nPoints;
+			if (convEnd > 0) {
+				// recombinations are ignored during conversion
+				size_t cp_bl = lower_bound(m_recBeforeLoci.begin() + bl, m_recBeforeLoci.end(),
+					convEnd) - m_recBeforeLoci.begin();
+				if (fp < cp_bl) {
+					// a forced region stops the conversion
+					convEnd = 0;
+					bl = fp;
+					continue;
 				}
-#else
-				off[gt] = cp[curCp][gt];
-#endif
-				LINEAGE_EXPR(lineageOff[gt] = lineagep[curCp][gt]);
-			}
-			// look ahead
-			if (convCount == 0) {             // conversion ...
-				if (forceFirstBegin > 0 && gt + 1 >= static_cast<size_t>(forceFirstBegin)
-				    && gt + 1 < static_cast<size_t>(forceFirstEnd)) {
-					if (curCp != 0 && m_debugOutput)
-						*m_debugOutput << ' ' << gt;
-					curCp = 0;
-				} else if (forceSecondBegin > 0 && gt + 1 >= static_cast<size_t>(forceSecondBegin)
-				           && gt + 1 < static_cast<size_t>(forceSecondEnd)) {
-					if (curCp != 1 && m_debugOutput)
-						*m_debugOutput << ' ' << gt;
-					curCp = 1;
-				} else {
-					curCp = (curCp + 1) % 2;
-					if (m_debugOutput)
-						*m_debugOutput << ' ' << gt;
+				if (convEnd > gtEnd)
+					break;
+				int newCp = forcedCopy(plan, convEnd);
+				if (newCp < 0)
+					newCp = (curCp + 1) % 2;
+				if (newCp != curCp) {
+					if (breaks)
+						breaks->push_back(convEnd - 1);
+					copyPlanned(plan, parent, curCp, offspring, ploidy, runBegin, convEnd);
+					runBegin = convEnd;
+					curCp = newCp;
 				}
-				//
 				// no pending conversion
-				convCount = -1;
+				convEnd = 0;
+				bl = cp_bl;
+				continue;
 			}
-			if (gt + 1 == m_recBeforeLoci[bl]) {
-				//DBG_DO(DBG_TRANSMITTER, cerr << gt << " " << m_recBeforeLoci[bl] << ", ");
-				if (forceFirstBegin >= 0 && gt + 1 >= static_cast<size_t>(forceFirstBegin)
-				    && gt + 1 < static_cast<size_t>(forceFirstEnd)) {
-					if (curCp != 0 && m_debugOutput)
-						*m_debugOutput << ' ' << gt;
-					curCp = 0;
-					convCount = -1;
-				} else if (forceSecondBegin >= 0 && gt + 1 >= static_cast<size_t>(forceSecondBegin)
-				           && gt + 1 < static_cast<size_t>(forceSecondEnd)) {
-					if (curCp != 1 && m_debugOutput)
-						*m_debugOutput << ' ' << gt;
-					curCp = 1;
-					convCount = -1;
-				} else if (convCount < 0 && bt.trialSucc(bl)) {
-					// recombination (if convCount == 0, a conversion event is ending)
-					curCp = (curCp + 1) % 2;
-					if (m_debugOutput)
-						*m_debugOutput << ' ' << gt;
-					// if conversion happens
-					if (withConversion &&
-					    parent.lociLeft(gt) != 1 &&             // can not be at the end of a chromosome
-					    (m_convMode[1] == 1. || getRNG().randUniform() < m_convMode[1])) {
-						// convCount will be decreased, until reconversion completes
-						// or another recombination happens
-						convCount = markersConverted(gt + 1, parent);
-					} else
-						// another recombination stops the previous conversion
-						convCount = -1;
+			size_t sp = bl == 0 ? bt.probFirstSucc() : bt.probNextSucc(bl - 1);
+			if (sp == Bernullitrials_T::npos)
+				sp = nPoints;
+			if (fp < nPoints && fp <= sp) {
+				// recombinations are ignored in the forced region
+				const ForcedRange & forced = plan.forced[fr];
+				if (curCp != forced.parPloidy) {
+					size_t pt = m_recBeforeLoci[fp];
+					if (breaks)
+						breaks->push_back(pt - 1);
+					copyPlanned(plan, parent, curCp, offspring, ploidy, runBegin, pt);
+					runBegin = pt;
+					curCp = forced.parPloidy;
 				}
-				++bl;
+				bl = forced.endPoint;
+				continue;
 			}
+			if (sp >= nPoints)
+				break;
+			// recombination
+			size_t pt = m_recBeforeLoci[sp];
+			if (breaks)
+				breaks->push_back(pt - 1);
+			copyPlanned(plan, parent, curCp, offspring, ploidy, runBegin, pt);
+			runBegin = pt;
+			curCp = (curCp + 1) % 2;
+			// if conversion happens
+			if (withConversion &&
+			    parent.lociLeft(pt - 1) != 1 &&             // can not be at the end of a chromosome
+			    (m_convMode[1] == 1. || getRNG().randUniform() < m_convMode[1])) {
+				size_t convCount = markersConverted(pt, parent);
+				if (convCount > 0)
+					convEnd = pt + convCount;
+			}
+			bl = sp + 1;
 		}
+		copyPlanned(plan, parent, curCp, offspring, ploidy, runBegin, gtEnd);
 	} else if (m_algorithm == 1) {
 #ifndef BINARYALLELE
 		size_t gt = 0, gtEnd = 0;
@@ -948,14 +1042,13 @@ void Recombinator::transmitGenotype(const Individual & parent,
 			copyGenotype(cp[curCp] + gt, cp[curCp] + m_recBeforeLoci[pos], off + gt);
 			gt = m_recBeforeLoci[pos];
 #  else
-			for (; gt < m_recBeforeLoci[pos]; ++gt) {
-				off[gt] = cp[curCp][gt];
-				LINEAGE_EXPR(lineageOff[gt] = lineagep[curCp][gt]);
-			}
+			copy(cp[curCp] + gt, cp[curCp] + m_recBeforeLoci[pos], off + gt);
+			LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + m_recBeforeLoci[pos], lineageOff + gt));
+			gt = m_recBeforeLoci[pos];
 #  endif
 			curCp = (curCp + 1) % 2;
-			if (m_debugOutput)
-				*m_debugOutput << ' ' << gt - 1;
+			if (breaks)
+				breaks->push_back(gt - 1);
 			//
 			if (withConversion &&
 			    parent.lociLeft(gt - 1) != 1 &&             // can not be at the end of a chromosome
@@ -974,14 +1067,13 @@ void Recombinator::transmitGenotype(const Individual & parent,
 						copyGenotype(cp[curCp] + gt, cp[curCp] + convEnd, off + gt);
 						gt = convEnd;
 #  else
-						for (; gt < convEnd; ++gt) {
-							off[gt] = cp[curCp][gt];
-							LINEAGE_EXPR(lineageOff[gt] = lineagep[curCp][gt]);
-						}
+						copy(cp[curCp] + gt, cp[curCp] + convEnd, off + gt);
+						LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + convEnd, lineageOff + gt));
+						gt = convEnd;
 #  endif
 						curCp = (curCp + 1) % 2;
-						if (m_debugOutput)
-							*m_debugOutput << ' ' << gt - 1;
+						if (breaks)
+							breaks->push_back(gt - 1);
 					}
 					// no pending conversion
 					convCount = -1;
@@ -991,14 +1083,13 @@ void Recombinator::transmitGenotype(const Individual & parent,
 				copyGenotype(cp[curCp] + gt, cp[curCp] + gtEnd, off + gt);
 				gt = gtEnd;
 #  else
-				for (; gt < gtEnd; ++gt) {
-					off[gt] = cp[curCp][gt];
-					LINEAGE_EXPR(lineageOff[gt] = lineagep[curCp][gt]);
-				}
+				copy(cp[curCp] + gt, cp[curCp] + gtEnd, off + gt);
+				LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + gtEnd, lineageOff + gt));
+				gt = gtEnd;
 #  endif
 				curCp = (curCp + 1) % 2;
-				if (m_debugOutput)
-					*m_debugOutput << ' ' << gt - 1;
+				if (breaks)
+					breaks->push_back(gt - 1);
 				//
 				// conversion event for this recombination event
 				if (withConversion &&
@@ -1019,24 +1110,22 @@ void Recombinator::transmitGenotype(const Individual & parent,
 				copyGenotype(cp[curCp] + gt, cp[curCp] + convEnd, off + gt);
 				gt = convEnd;
 #  else
-				for (; gt < convEnd; ++gt) {
-					off[gt] = cp[curCp][gt];
-					LINEAGE_EXPR(lineageOff[gt] = lineagep[curCp][gt]);
-				}
+				copy(cp[curCp] + gt, cp[curCp] + convEnd, off + gt);
+				LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + convEnd, lineageOff + gt));
+				gt = convEnd;
 #  endif
 				curCp = (curCp + 1) % 2;
-				if (m_debugOutput)
-					*m_debugOutput << ' ' << gt - 1;
+				if (breaks)
+					breaks->push_back(gt - 1);
 			}
 		}
 #  ifdef MUTANTALLELE
 		copyGenotype(cp[curCp] + gt, cp[curCp] + gtEnd, off + gt);
 		gt = gtEnd;
 #  else
-		for (; gt < gtEnd; ++gt) {
-			off[gt] = cp[curCp][gt];
-			LINEAGE_EXPR(lineageOff[gt] = lineagep[curCp][gt]);
-		}
+		copy(cp[curCp] + gt, cp[curCp] + gtEnd, off + gt);
+		LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + gtEnd, lineageOff + gt));
+		gt = gtEnd;
 #  endif
 #else
 		size_t gt = 0, gtEnd = 0;
@@ -1053,8 +1142,8 @@ void Recombinator::transmitGenotype(const Individual & parent,
 			LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + m_recBeforeLoci[pos], lineageOff + gt));
 			gt = gtEnd;
 			curCp = (curCp + 1) % 2;
-			if (m_debugOutput)
-				*m_debugOutput << ' ' << gt - 1;
+			if (breaks)
+				breaks->push_back(gt - 1);
 			if (withConversion &&
 			    parent.lociLeft(gt - 1) != 1 &&             // can not be at the end of a chromosome
 			    (m_convMode[1] == 1. || getRNG().randUniform() < m_convMode[1])) {
@@ -1071,8 +1160,8 @@ void Recombinator::transmitGenotype(const Individual & parent,
 						LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + gt + convCount, lineageOff + gt));
 						gt = convEnd;
 						curCp = (curCp + 1) % 2;
-						if (m_debugOutput)
-							*m_debugOutput << ' ' << gt - 1;
+						if (breaks)
+							breaks->push_back(gt - 1);
 					}
 					// no pending conversion
 					convCount = -1;
@@ -1083,8 +1172,8 @@ void Recombinator::transmitGenotype(const Individual & parent,
 				LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + m_recBeforeLoci[pos], lineageOff + gt));
 				gt = gtEnd;
 				curCp = (curCp + 1) % 2;
-				if (m_debugOutput)
-					*m_debugOutput << ' ' << gt - 1;
+				if (breaks)
+					breaks->push_back(gt - 1);
 				// conversion event for this recombination event
 				if (withConversion &&
 				    parent.lociLeft(gt - 1) != 1 &&             // can not be at the end of a chromosome
@@ -1105,8 +1194,8 @@ void Recombinator::transmitGenotype(const Individual & parent,
 				LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + gt + convCount, lineageOff + gt));
 				gt = convEnd;
 				curCp = (curCp + 1) % 2;
-				if (m_debugOutput)
-					*m_debugOutput << ' ' << gt - 1;
+				if (breaks)
+					breaks->push_back(gt - 1);
 			}
 		}
 		copyGenotype(cp[curCp] + gt, off + gt, gtEnd - gt);
@@ -1132,14 +1221,13 @@ void Recombinator::transmitGenotype(const Individual & parent,
 			copyGenotype(cp[curCp] + gt, cp[curCp] + m_recBeforeLoci[pos], off + gt);
 			gt = m_recBeforeLoci[pos];
 #  else
-			for (; gt < m_recBeforeLoci[pos]; ++gt) {
-				off[gt] = cp[curCp][gt];
-				LINEAGE_EXPR(lineageOff[gt] = lineagep[curCp][gt]);
-			}
+			copy(cp[curCp] + gt, cp[curCp] + m_recBeforeLoci[pos], off + gt);
+			LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + m_recBeforeLoci[pos], lineageOff + gt));
+			gt = m_recBeforeLoci[pos];
 #  endif
 			curCp = (curCp + 1) % 2;
-			if (m_debugOutput)
-				*m_debugOutput << ' ' << gt - 1;
+			if (breaks)
+				breaks->push_back(gt - 1);
 			//
 			if (withConversion &&
 			    parent.lociLeft(gt - 1) != 1 &&             // can not be at the end of a chromosome
@@ -1164,14 +1252,13 @@ void Recombinator::transmitGenotype(const Individual & parent,
 						copyGenotype(cp[curCp] + gt, cp[curCp] + convEnd, off + gt);
 						gt = convEnd;
 #  else
-						for (; gt < convEnd; ++gt) {
-							off[gt] = cp[curCp][gt];
-							LINEAGE_EXPR(lineageOff[gt] = lineagep[curCp][gt]);
-						}
+						copy(cp[curCp] + gt, cp[curCp] + convEnd, off + gt);
+						LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + convEnd, lineageOff + gt));
+						gt = convEnd;
 #  endif
 						curCp = (curCp + 1) % 2;
-						if (m_debugOutput)
-							*m_debugOutput << ' ' << gt - 1;
+						if (breaks)
+							breaks->push_back(gt - 1);
 					}
 					// no pending conversion
 					convCount = -1;
@@ -1181,14 +1268,13 @@ void Recombinator::transmitGenotype(const Individual & parent,
 				copyGenotype(cp[curCp] + gt, cp[curCp] + gtEnd, off + gt);
 				gt = gtEnd;
 #  else
-				for (; gt < gtEnd; ++gt) {
-					off[gt] = cp[curCp][gt];
-					LINEAGE_EXPR(lineageOff[gt] = lineagep[curCp][gt]);
-				}
+				copy(cp[curCp] + gt, cp[curCp] + gtEnd, off + gt);
+				LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + gtEnd, lineageOff + gt));
+				gt = gtEnd;
 #  endif
 				curCp = (curCp + 1) % 2;
-				if (m_debugOutput)
-					*m_debugOutput << ' ' << gt - 1;
+				if (breaks)
+					breaks->push_back(gt - 1);
 				//
 				// conversion event for this recombination event
 				if (withConversion &&
@@ -1210,24 +1296,22 @@ void Recombinator::transmitGenotype(const Individual & parent,
 				copyGenotype(cp[curCp] + gt, cp[curCp] + convEnd, off + gt);
 				gt = convEnd;
 #  else
-				for (; gt < convEnd; ++gt) {
-					off[gt] = cp[curCp][gt];
-					LINEAGE_EXPR(lineageOff[gt] = lineagep[curCp][gt]);
-				}
+				copy(cp[curCp] + gt, cp[curCp] + convEnd, off + gt);
+				LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + convEnd, lineageOff + gt));
+				gt = convEnd;
 #  endif
 				curCp = (curCp + 1) % 2;
-				if (m_debugOutput)
-					*m_debugOutput << ' ' << gt - 1;
+				if (breaks)
+					breaks->push_back(gt - 1);
 			}
 		}
 #  ifdef MUTANTALLELE
 		copyGenotype(cp[curCp] + gt, cp[curCp] + gtEnd, off + gt);
 		gt = gtEnd;
 #  else
-		for (; gt < gtEnd; ++gt) {
-			off[gt] = cp[curCp][gt];
-			LINEAGE_EXPR(lineageOff[gt] = lineagep[curCp][gt]);
-		}
+		copy(cp[curCp] + gt, cp[curCp] + gtEnd, off + gt);
+		LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + gtEnd, lineageOff + gt));
+		gt = gtEnd;
 #  endif
 #else       // binary alleles
 		size_t gt = 0, gtEnd = 0;
@@ -1245,8 +1329,8 @@ void Recombinator::transmitGenotype(const Individual & parent,
 			LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + m_recBeforeLoci[pos], lineageOff + gt));
 			gt = gtEnd;
 			curCp = (curCp + 1) % 2;
-			if (m_debugOutput)
-				*m_debugOutput << ' ' << gt - 1;
+			if (breaks)
+				breaks->push_back(gt - 1);
 			if (withConversion &&
 			    parent.lociLeft(gt - 1) != 1 &&             // can not be at the end of a chromosome
 			    (m_convMode[1] == 1. || getRNG().randUniform() < m_convMode[1])) {
@@ -1269,8 +1353,8 @@ void Recombinator::transmitGenotype(const Individual & parent,
 						LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + gt + convCount, lineageOff + gt));
 						gt = convEnd;
 						curCp = (curCp + 1) % 2;
-						if (m_debugOutput)
-							*m_debugOutput << ' ' << gt - 1;
+						if (breaks)
+							breaks->push_back(gt - 1);
 					}
 					// no pending conversion
 					convCount = -1;
@@ -1281,8 +1365,8 @@ void Recombinator::transmitGenotype(const Individual & parent,
 				LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + m_recBeforeLoci[pos], lineageOff + gt));
 				gt = gtEnd;
 				curCp = (curCp + 1) % 2;
-				if (m_debugOutput)
-					*m_debugOutput << ' ' << gt - 1;
+				if (breaks)
+					breaks->push_back(gt - 1);
 				// conversion event for this recombination event
 				if (withConversion &&
 				    parent.lociLeft(gt - 1) != 1 &&             // can not be at the end of a chromosome
@@ -1303,8 +1387,8 @@ void Recombinator::transmitGenotype(const Individual & parent,
 				LINEAGE_EXPR(copy(lineagep[curCp] + gt, lineagep[curCp] + gt + convCount, lineageOff + gt));
 				gt = convEnd;
 				curCp = (curCp + 1) % 2;
-				if (m_debugOutput)
-					*m_debugOutput << ' ' << gt - 1;
+				if (breaks)
+					breaks->push_back(gt - 1);
 			}
 		}
 		copyGenotype(cp[curCp] + gt, off + gt, gtEnd - gt);
@@ -1314,19 +1398,87 @@ void Recombinator::transmitGenotype(const Individual & parent,
 	}
 
 
-	if (m_debugOutput)
-		*m_debugOutput << '\n';
 	// handle special chromosomes
-	if (m_chromX > 0) {
-		if (offspring.sex() == MALE)
-			clearChromosome(offspring, 1, m_chromX);
-	}
-	if (m_chromY > 0) {
-		if (offspring.sex() == FEMALE) {
-			clearChromosome(offspring, 0, m_chromY);
-			clearChromosome(offspring, 1, m_chromY);
-		} else
-			clearChromosome(offspring, 0, m_chromY);
+	for (int p = 0; p < 2; ++p)
+		for (size_t i = 0; i < plan.cleared[p].size(); ++i)
+			clearLoci(offspring, p, plan.cleared[p][i].first, plan.cleared[p][i].second);
+	return startCp;
+}
+
+
+int Recombinator::forcedCopy(const TransmissionPlan & plan, size_t pos) const
+{
+	for (size_t i = 0; i < plan.forced.size(); ++i)
+		if (plan.forced[i].begin > 0 && pos >= plan.forced[i].begin && pos < plan.forced[i].end)
+			return plan.forced[i].parPloidy;
+	return -1;
+}
+
+
+void Recombinator::copyPlanned(const TransmissionPlan & plan, const Individual & parent,
+                               int parPloidy, Individual & offspring, int ploidy, size_t begin, size_t end) const
+{
+	for (size_t i = 0; i < plan.copied.size() && plan.copied[i].first < end; ++i)
+		copyLoci(parent, parPloidy, offspring, ploidy, max(begin, plan.copied[i].first),
+			min(end, plan.copied[i].second));
+}
+
+
+void Recombinator::transmitGenotype(const Individual & parent,
+                                    Individual & offspring, int ploidy) const
+{
+	if (m_debugOutput) {
+		vectoru breaks;
+		int startCp = transmitSegments(parent, offspring, ploidy, &breaks);
+		outputSegments(parent, offspring, startCp, breaks);
+	} else
+		transmitSegments(parent, offspring, ploidy, NULL);
+}
+
+
+void Recombinator::outputSegments(const Individual & parent, const Individual & offspring,
+                                  int startCp, const vectoru & breaks) const
+{
+	*m_debugOutput << offspring.intInfo(infoField(0)) << ' ' << parent.intInfo(infoField(0)) << ' ' << startCp;
+	for (size_t i = 0; i < breaks.size(); ++i)
+		*m_debugOutput << ' ' << breaks[i];
+	*m_debugOutput << '\n';
+}
+
+
+void Recombinator::recordSegments(Genealogy & genealogy, const Individual & parent,
+                                  const Individual & offspring, size_t offIdx, int ploidy,
+                                  int startCp, const vectoru & breaks) const
+{
+	// regions that are not transmitted, namely customized chromosomes, and
+	// chromosome Y (or X for male offspring) that are cleared after transmission
+	vector<pair<size_t, size_t> > excluded;
+
+	if (m_customizedBegin >= 0)
+		excluded.push_back(std::make_pair(m_customizedBegin, m_customizedEnd));
+	if (m_chromY > 0 && (ploidy == 0 || offspring.sex() == FEMALE))
+		excluded.push_back(std::make_pair(offspring.chromBegin(m_chromY), offspring.chromEnd(m_chromY)));
+	if (m_chromX > 0 && ploidy == 1 && offspring.sex() == MALE)
+		excluded.push_back(std::make_pair(offspring.chromBegin(m_chromX), offspring.chromEnd(m_chromX)));
+	std::sort(excluded.begin(), excluded.end());
+
+	int cp = startCp;
+	size_t left = 0;
+	for (size_t i = 0; i <= breaks.size(); ++i) {
+		size_t right = i == breaks.size() ? m_recBeforeLoci.back() : breaks[i] + 1;
+		// split the segment by excluded regions
+		size_t pos = left;
+		for (size_t j = 0; j < excluded.size(); ++j) {
+			if (excluded[j].second <= pos || excluded[j].first >= right)
+				continue;
+			if (excluded[j].first > pos)
+				genealogy.addEdge(parent, cp, offIdx, ploidy, pos, excluded[j].first);
+			pos = excluded[j].second;
+		}
+		if (pos < right)
+			genealogy.addEdge(parent, cp, offIdx, ploidy, pos, right);
+		left = right;
+		cp = (cp + 1) % 2;
 	}
 }
 
@@ -1351,8 +1503,21 @@ bool Recombinator::applyDuringMating(Population & pop, Population & offPop, RawI
 		m_debugOutput = &getOstream(pop.dict());
 	else
 		m_debugOutput = NULL;
-	transmitGenotype(*(mom ? mom : dad), *offspring, 0);
-	transmitGenotype(*(dad ? dad : mom), *offspring, 1);
+	Genealogy * genealogy = pop.genealogyRecorder();
+	if (genealogy) {
+		size_t offIdx = offspring - offPop.rawIndBegin();
+		for (int p = 0; p < 2; ++p) {
+			const Individual & parent = p == 0 ? *(mom ? mom : dad) : *(dad ? dad : mom);
+			vectoru breaks;
+			int startCp = transmitSegments(parent, *offspring, p, &breaks);
+			if (m_debugOutput)
+				outputSegments(parent, *offspring, startCp, breaks);
+			recordSegments(*genealogy, parent, *offspring, offIdx, p, startCp, breaks);
+		}
+	} else {
+		transmitGenotype(*(mom ? mom : dad), *offspring, 0);
+		transmitGenotype(*(dad ? dad : mom), *offspring, 1);
+	}
 
 	if (m_debugOutput)
 		closeOstream();
@@ -1361,88 +1526,86 @@ bool Recombinator::applyDuringMating(Population & pop, Population & offPop, RawI
 
 #ifdef LONGALLELE
 
+void MutSpaceRecombinator::getMutants(const Individual & parent, int ploidy, size_t ch,
+                                      vectoru & alleles) const
+{
+	alleles.clear();
+	GenoIterator it = parent.genoBegin(ploidy, ch);
+	GenoIterator it_end = parent.genoEnd(ploidy, ch);
+	bool sorted = true;
+	for (; it != it_end; ++it) {
+		if (*it == 0u)
+			break;
+		if (!alleles.empty() && *it < alleles.back())
+			sorted = false;
+		alleles.push_back(*it);
+	}
+	// mutants are sorted unless they are set outside of mutational space operators
+	if (!sorted)
+		std::sort(alleles.begin(), alleles.end());
+}
+
+
+void MutSpaceRecombinator::setMutants(Population & pop, Population & offPop, size_t offIndex,
+                                      int ploidy, size_t ch, const vectoru & alleles) const
+{
+	// not enough size
+	size_t nLoci = offPop.numLoci(ch);
+
+	if (alleles.size() + 1 > nLoci) {
+		// add at least as many loci as existing ones to reduce re-allocation
+		size_t sz = std::max(alleles.size() + 2 - nLoci, nLoci);
+		DBG_DO(DBG_TRANSMITTER, cerr << "Extending size of chromosome " << ch <<
+			" to " << nLoci + sz << endl);
+		vectorf added(sz);
+		for (size_t j = 0; j < sz; ++j)
+			added[j] = static_cast<double>(nLoci + j + 1);
+		vectoru addedChrom(sz, ch);
+		offPop.addLoci(addedChrom, added);
+		pop.addLoci(addedChrom, added);
+	}
+	//
+	GenoIterator it = offPop.individual(offIndex).genoBegin(ploidy, ch);
+	GenoIterator it_end = offPop.individual(offIndex).genoEnd(ploidy, ch);
+	for (size_t i = 0; i < alleles.size(); ++i, ++it)
+		*it = TO_ALLELE(alleles[i]);
+	// fill the rest with 0.
+	std::fill(it, it_end, 0);
+}
+
+
 void MutSpaceRecombinator::transmitGenotype0(Population & pop, Population & offPop, const Individual & parent,
                                              size_t offIndex, int ploidy) const
 {
-	size_t nCh = parent.numChrom();
-
-	// chromosome X is not passed to male offspring
+	vectoru mutants[2];
+	vectoru alleles;
 
-	// count duplicates...
 	for (size_t ch = 0; ch < parent.numChrom(); ++ch) {
-		MutCounter cnt;
-		vectoru alleles;
-		alleles.reserve(parent.numLoci(ch));
-		if (nCh == 1) {
-			// this is faster... for a most common case
-			GenoIterator it = parent.genoBegin();
-			GenoIterator it_end = parent.genoEnd();
-			for (; it != it_end; ++it) {
-				if (*it == 0u)
-					continue;
-				MutCounter::iterator mit = cnt.find(*it);
-				if (mit == cnt.end())
-					cnt[*it] = 1;
-				else
-					++mit->second;
+		getMutants(parent, 0, ch, mutants[0]);
+		getMutants(parent, 1, ch, mutants[1]);
+		// merge sorted mutants, keep mutants on both copies, and mutants on
+		// one of the copies with probability 0.5
+		alleles.clear();
+		vectoru::const_iterator it0 = mutants[0].begin();
+		vectoru::const_iterator it0_end = mutants[0].end();
+		vectoru::const_iterator it1 = mutants[1].begin();
+		vectoru::const_iterator it1_end = mutants[1].end();
+		while (it0 != it0_end || it1 != it1_end) {
+			if (it1 == it1_end || (it0 != it0_end && *it0 < *it1)) {
+				if (getRNG().randBit())
+					alleles.push_back(*it0);
+				++it0;
+			} else if (it0 == it0_end || *it1 < *it0) {
+				if (getRNG().randBit())
+					alleles.push_back(*it1);
+				++it1;
+			} else {
+				alleles.push_back(*it0);
+				++it0;
+				++it1;
 			}
-		} else {
-			GenoIterator it = parent.genoBegin(0, ch);
-			GenoIterator it_end = parent.genoEnd(0, ch);
-			for (; it != it_end; ++it) {
-				if (*it == 0u)
-					break;
-				MutCounter::iterator mit = cnt.find(*it);
-				if (mit == cnt.end())
-					cnt[*it] = 1;
-				else
-					++mit->second;
-			}
-			it = parent.genoBegin(1, ch);
-			it_end = parent.genoEnd(1, ch);
-			for (; it != it_end; ++it) {
-				if (*it == 0u)
-					break;
-				MutCounter::iterator mit = cnt.find(*it);
-				if (mit == cnt.end())
-					cnt[*it] = 1;
-				else
-					++mit->second;
-			}
-		}
-		// no valid allele
-		if (cnt.empty()) {
-			GenoIterator it = offPop.individual(offIndex).genoBegin(ploidy, ch);
-			GenoIterator it_end = offPop.individual(offIndex).genoEnd(ploidy, ch);
-			std::fill(it, it_end, 0);
-			continue;
 		}
-		// keep 1 count with probability 0.5, keep 2 count with probability 1
-		MutCounter::iterator mit = cnt.begin();
-		MutCounter::iterator mit_end = cnt.end();
-		for (; mit != mit_end; ++mit) {
-			if (mit->second == 2 || getRNG().randBit())
-				alleles.push_back(mit->first);
-		}
-		// not enough size
-		if (alleles.size() + 1 > offPop.numLoci(ch)) {
-			DBG_DO(DBG_TRANSMITTER, cerr << "Extending size of chromosome " << ch <<
-				" to " << alleles.size() + 2 << endl);
-			size_t sz = alleles.size() - offPop.numLoci(ch) + 2;
-			vectorf added(sz);
-			for (size_t j = 0; j < sz; ++j)
-				added[j] = static_cast<double>(offPop.numLoci(ch) + j + 1);
-			vectoru addedChrom(sz, ch);
-			offPop.addLoci(addedChrom, added);
-			pop.addLoci(addedChrom, added);
-		}
-		//
-		GenoIterator it = offPop.individual(offIndex).genoBegin(ploidy, ch);
-		GenoIterator it_end = offPop.individual(offIndex).genoEnd(ploidy, ch);
-		for (size_t i = 0; i < alleles.size(); ++i, ++it)
-			*it = TO_ALLELE(alleles[i]);
-		// fill the rest with 0.
-		std::fill(it, it_end, 0);
+		setMutants(pop, offPop, offIndex, ploidy, ch, alleles);
 	}
 }
 
@@ -1451,10 +1614,11 @@ void MutSpaceRecombinator::transmitGenotype1(Population & pop, Population & offP
                                              size_t offIndex, int ploidy) const
 {
 	const matrixi & ranges = m_ranges.elems();
+	vectoru mutants[2];
+	vectoru alleles;
 
 	for (size_t ch = 0; ch < parent.numChrom(); ++ch) {
 		size_t width = ranges[ch][1] - ranges[ch][0];
-		size_t beg = 0;
 		size_t end = getRNG().randGeometric(m_rate);
 		int p = getRNG().randBit() ? 0 : 1;
 		// no recombination
@@ -1462,94 +1626,27 @@ void MutSpaceRecombinator::transmitGenotype1(Population & pop, Population & offP
 			copyChromosome(parent, p, offPop.individual(offIndex), ploidy, ch);
 			continue;
 		}
-		// we are in trouble... get some properties of alleles to reduce comparison
-		vectoru alleles;
-		size_t minAllele[2];
-		size_t maxAllele[2];
-		size_t cnt[2];
-		cnt[0] = 0;
-		cnt[1] = 0;
-		minAllele[0] = ranges[ch][1];
-		minAllele[1] = ranges[ch][1];
-		maxAllele[0] = ranges[ch][0];
-		maxAllele[1] = ranges[ch][0];
-		GenoIterator it = parent.genoBegin(0, ch);
-		GenoIterator it_end = parent.genoEnd(0, ch);
-		for (; it != it_end; ++it) {
-			if (*it == 0u)
+		getMutants(parent, 0, ch, mutants[0]);
+		getMutants(parent, 1, ch, mutants[1]);
+		// because mutants are sorted, each piece between two recombination
+		// points is a continuous range of mutants of the chosen copy.
+		alleles.clear();
+		size_t idx[2] = { 0, 0 };
+		while (true) {
+			size_t last = end >= width ? static_cast<size_t>(ranges[ch][1]) : end + ranges[ch][0];
+			const vectoru & cp = mutants[p];
+			for (; idx[p] < cp.size() && cp[idx[p]] < last; ++idx[p])
+				alleles.push_back(cp[idx[p]]);
+			const vectoru & other = mutants[1 - p];
+			for (; idx[1 - p] < other.size() && other[idx[1 - p]] < last; ++idx[1 - p]) ;
+			if (end >= width || (idx[0] == mutants[0].size() && idx[1] == mutants[1].size()))
 				break;
-			++cnt[0];
-			if (*it < minAllele[0])
-				minAllele[0] = *it;
-			if (*it > maxAllele[0])
-				maxAllele[0] = *it;
-		}
-		it = parent.genoBegin(1, ch);
-		it_end = parent.genoEnd(1, ch);
-		for (; it != it_end; ++it) {
-			if (*it == 0u)
-				break;
-			++cnt[1];
-			if (*it < minAllele[1])
-				minAllele[1] = *it;
-			if (*it > maxAllele[1])
-				maxAllele[1] = *it;
-		}
-		minAllele[0] -= ranges[ch][0];
-		minAllele[1] -= ranges[ch][0];
-		maxAllele[0] -= ranges[ch][0];
-		maxAllele[1] -= ranges[ch][0];
-		do {
-			// copy piece
-			// this algorithm is NOT efficient, but we count the rareness of recombination. :-)
-			if (cnt[p] > 0 && end >= minAllele[p] && beg <= maxAllele[p]) {
-				it = parent.genoBegin(p, ch);
-				it_end = parent.genoEnd(p, ch);
-				for (; it != it_end; ++it) {
-					if (*it == 0u)
-						break;
-					if (*it >= beg + ranges[ch][0] && *it < end + ranges[ch][0]) {
-						alleles.push_back(*it);
-						--cnt[p];
-					}
-				}
-			}
 			// change ploidy
 			p = (p + 1) % 2;
 			// next step
-			beg = end;
 			end += getRNG().randGeometric(m_rate);
-		} while (end < width && (cnt[0] > 0 || cnt[1] > 0));
-		// last piece
-		if (cnt[0] > 0 || cnt[1] > 0) {
-			it = parent.genoBegin(p, ch);
-			it_end = parent.genoEnd(p, ch);
-			for (; it != it_end; ++it) {
-				if (*it >= beg + static_cast<size_t>(ranges[ch][0]) &&
-				    *it < static_cast<size_t>(ranges[ch][1]))
-					alleles.push_back(*it);
-			}
-		}
-		// set alleles
-		// not enough size
-		if (alleles.size() + 1 > offPop.numLoci(ch)) {
-			DBG_DO(DBG_TRANSMITTER, cerr << "Extending size of chromosome " << ch <<
-				" to " << alleles.size() + 2 << endl);
-			size_t sz = alleles.size() - offPop.numLoci(ch) + 2;
-			vectorf added(sz);
-			for (size_t j = 0; j < sz; ++j)
-				added[j] = static_cast<double>(offPop.numLoci(ch) + j + 1);
-			vectoru addedChrom(sz, ch);
-			offPop.addLoci(addedChrom, added);
-			pop.addLoci(addedChrom, added);
 		}
-		//
-		it = offPop.individual(offIndex).genoBegin(ploidy, ch);
-		it_end = offPop.individual(offIndex).genoEnd(ploidy, ch);
-		for (size_t i = 0; i < alleles.size(); ++i, ++it)
-			*it = TO_ALLELE(alleles[i]);
-		// fill the rest with 0.
-		std::fill(it, it_end, 0);
+		setMutants(pop, offPop, offIndex, ploidy, ch, alleles);
 	}
 }
 
@@ -121,6 +121,26 @@ public:
 	/// CPPONLY
 	virtual void initializeIfNeeded(const Individual & ind) const;
 
+protected:
+	/** Record to \e genealogy that all non-customized chromosomes on the
+	 *  \e ploidy-th homologous set of the \e offIdx-th offspring are copied
+	 *  from the \e parPloidy-th homologous set of \e parent.
+	 */
+	void recordChromosomes(Genealogy & genealogy, const Individual & parent, int parPloidy,
+		size_t offIdx, int ploidy) const;
+
+	/** Copy loci <tt>[begin, end)</tt> on the \e parPloidy-th homologous set
+	 *  of chromosomes of \e parent to the \e ploidy-th homologous set of
+	 *  chromosomes of \e offspring, with allelic lineage if applicable.
+	 */
+	void copyLoci(const Individual & parent, int parPloidy,
+		Individual & offspring, int ploidy, size_t begin, size_t end) const;
+
+	/** Clear loci <tt>[begin, end)</tt> on the \e ploidy-th homologous set
+	 *  of chromosomes of individual \e ind.
+	 */
+	void clearLoci(const Individual & ind, int ploidy, size_t begin, size_t end) const;
+
 protected:
 	// record the last handled population type. If this is change,
 	// everything has to be changed.
@@ -257,6 +277,14 @@ public:
 	void transmitGenotype(const Individual & parent,
 		Individual & offspring, int ploidy) const;
 
+	/** CPPONLY Transmit genotype from parent to offspring as function
+	 *  \c transmitGenotype, and record inherited segments to \e genealogy,
+	 *  if it is not \c NULL, with \e offIdx being the index of
+	 *  \e offspring in the offspring population.
+	 */
+	void transmitGenotype(const Individual & parent,
+		Individual & offspring, int ploidy, Genealogy * genealogy, size_t offIdx) const;
+
 
 	/// CPPONLY
 	bool parallelizable() const
@@ -265,6 +293,27 @@ public:
 	}
 
 
+protected:
+	/** A range of loci that is copied from the first (\c 0) or second
+	 *  (\c 1) homologous copy of parental chromosomes, from a randomly
+	 *  chosen copy (\c -1), or cleared (\c -2).
+	 */
+	struct TransmissionSegment
+	{
+		size_t begin;
+		size_t end;
+		int parPloidy;
+	};
+
+	typedef vector<TransmissionSegment> TransmissionPlan;
+
+	/// plan for the \e ploidy-th homologous set of chromosomes of \e offspring
+	const TransmissionPlan & transmissionPlan(int ploidy, const Individual & offspring) const
+	{
+		return m_plans[ploidy * 2 + (offspring.sex() == FEMALE ? 1 : 0)];
+	}
+
+
 protected:
 	// cache chromBegin, chromEnd for better performance.
 	mutable vectoru m_chIdx;
@@ -276,6 +325,12 @@ protected:
 	mutable int m_mitochondrial;
 
 	mutable size_t m_numChrom;
+
+	/// transmission plans for each ploidy and offspring sex, each of which
+	/// has one segment for each chromosome that is randomly transmitted, and
+	/// segments of adjacent chromosomes that are cleared or copied from a
+	/// given parental copy.
+	mutable vector<TransmissionPlan> m_plans;
 };
 
 
@@ -638,6 +693,53 @@ private:
 	/// determine number of markers to convert
 	size_t markersConverted(size_t index, const Individual & ind) const;
 
+	/** transmit genotype from parent to offspring, and return the parental
+	 *  copy from which transmission starts. If \e breaks is not \c NULL,
+	 *  loci after which transmission switches between parental copies are
+	 *  appended to it.
+	 */
+	int transmitSegments(const Individual & parent,
+		Individual & offspring, int ploidy, vectoru * breaks) const;
+
+	/// write recombination events to debug output
+	void outputSegments(const Individual & parent, const Individual & offspring,
+		int startCp, const vectoru & breaks) const;
+
+	/// record transmitted segments to genealogy
+	void recordSegments(Genealogy & genealogy, const Individual & parent,
+		const Individual & offspring, size_t offIdx, int ploidy,
+		int startCp, const vectoru & breaks) const;
+
+	/// a region in which loci are copied from a given parental copy
+	struct ForcedRange
+	{
+		size_t begin;
+		size_t end;
+		int parPloidy;
+		/// index of the first recombination point in, and after the region
+		size_t firstPoint;
+		size_t endPoint;
+	};
+
+	/** Loci that are copied (regions other than ignored sex chromosomes and
+	 *  customized chromosomes), copied from a given parental copy, and
+	 *  cleared after the \e ploidy-th homologous set of chromosomes of an
+	 *  offspring is transmitted from a parent.
+	 */
+	struct TransmissionPlan
+	{
+		vector<pair<size_t, size_t> > copied;
+		vector<ForcedRange> forced;
+		vector<pair<size_t, size_t> > cleared[2];
+	};
+
+	/// parental copy at locus \e pos if it is forced at the end of a conversion
+	int forcedCopy(const TransmissionPlan & plan, size_t pos) const;
+
+	/// copy loci <tt>[begin, end)</tt> that are copied according to \e plan
+	void copyPlanned(const TransmissionPlan & plan, const Individual & parent,
+		int parPloidy, Individual & offspring, int ploidy, size_t begin, size_t end) const;
+
 private:
 	/// intensity
 	const double m_intensity;
@@ -660,6 +762,9 @@ private:
 	mutable int m_customizedBegin;
 	mutable int m_customizedEnd;
 
+	/// transmission plans indexed by ploidy * 2 + (offspring is female)
+	mutable vector<TransmissionPlan> m_plans;
+
 	/// algorithm to use (frequent or seldom recombinations)
 	mutable int m_algorithm;
 
@@ -731,14 +836,13 @@ public:
 		Individual * dad, Individual * mom) const;
 
 private:
-#  if TR1_SUPPORT == 0
-	typedef std::map<unsigned int, int> MutCounter;
-#  elif TR1_SUPPORT == 1
-	typedef std::unordered_map<unsigned int, int> MutCounter;
-#  else
-	// this is faster than std::map
-	typedef std::tr1::unordered_map<unsigned int, int> MutCounter;
-#  endif
+	// get sorted mutants on a chromosome
+	void getMutants(const Individual & parent, int ploidy, size_t ch, vectoru & alleles) const;
+
+	// set sorted mutants to a chromosome, add loci if necessary
+	void setMutants(Population & pop, Population & offPop, size_t offIndex,
+		int ploidy, size_t ch, const vectoru & alleles) const;
+
 	// use when m_rate = 0.5
 	void transmitGenotype0(Population & pop, Population & offPop, const Individual & parent,
 		size_t offIndex, int ploidy) const;
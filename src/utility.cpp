@@ -102,6 +102,12 @@ using std::ofstream;
 #  include <windows.h>
 #endif
 
+// for madvise
+#ifdef __linux__
+#  include <unistd.h>
+#  include <sys/mman.h>
+#endif
+
 #include "boost/dynamic_bitset/detail/lowest_bit.hpp"
 using boost::detail::lowest_bit;
 
@@ -413,6 +419,9 @@ int simuPOP_getch(void)
 // thread number, global variable
 UINT g_numThreads;
 
+// place population buffers by first touch, global variable
+bool g_firstTouch = false;
+
 // random number generator. a global variable.
 #ifdef _OPENMP
 #  if THREADPRIVATE_SUPPORT == 0
@@ -426,8 +435,11 @@ RNG * g_RNG;
 RNG g_RNG;
 #endif
 
-void setOptions(const int numThreads, const char * name, unsigned long seed)
+void setOptions(const int numThreads, const char * name, unsigned long seed,
+                const int firstTouch)
 {
+	if (firstTouch >= 0)
+		g_firstTouch = firstTouch != 0;
 #ifdef _OPENMP
 	// if numThreads is zero, all threads will be used.
 	if (numThreads == 0) {
@@ -476,6 +488,30 @@ UINT numThreads()
 }
 
 
+bool firstTouch()
+{
+	return g_firstTouch;
+}
+
+
+bool releasePages(void * begin, size_t size)
+{
+#ifdef __linux__
+	static const size_t pageSize = sysconf(_SC_PAGESIZE);
+	// only pages that are completely within the region can be released
+	size_t first = (reinterpret_cast<size_t>(begin) + pageSize - 1) / pageSize * pageSize;
+	size_t last = (reinterpret_cast<size_t>(begin) + size) / pageSize * pageSize;
+	if (last > first)
+		return madvise(reinterpret_cast<void *>(first), last - first, MADV_DONTNEED) == 0;
+	return true;
+#else
+	(void)begin;
+	(void)size;
+	return false;
+#endif
+}
+
+
 ATOMICLONG fetchAndIncrement(ATOMICLONG * val)
 {
 	if (g_numThreads == 1)
@@ -496,6 +532,23 @@ ATOMICLONG fetchAndIncrement(ATOMICLONG * val)
 }
 
 
+ATOMICLONG fetchAndAdd(ATOMICLONG * val, ATOMICLONG n)
+{
+	if (g_numThreads == 1) {
+		ATOMICLONG ret = *val;
+		*val += n;
+		return ret;
+	} else
+#ifdef _WIN64
+		return InterlockedExchangeAdd64(val, n);
+#elif defined(_WIN32)
+		return InterlockedExchangeAdd(val, n);
+#else
+		return __sync_fetch_and_add(val, n);
+#endif
+}
+
+
 // return the global RNG
 RNG & getRNG()
 {
@@ -570,6 +623,25 @@ floatList::floatList(PyObject * obj) : m_elems()
 	if (obj == NULL)
 		return;
 
+	// contiguous arrays of doubles (e.g. numpy arrays or array.array('d')),
+	// which are copied as a whole
+	if (PyObject_CheckBuffer(obj)) {
+		Py_buffer view;
+		if (PyObject_GetBuffer(obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0) {
+			bool isDouble = view.itemsize == sizeof(double) && view.format != NULL &&
+			                (string(view.format) == "d" || string(view.format) == "=d" ||
+			                 string(view.format) == "@d");
+			if (isDouble) {
+				const double * data = static_cast<const double *>(view.buf);
+				m_elems.assign(data, data + view.len / sizeof(double));
+			}
+			PyBuffer_Release(&view);
+			if (isDouble)
+				return;
+		} else
+			PyErr_Clear();
+	}
+
 	if (PyNumber_Check(obj))
 		m_elems.push_back(PyFloat_AsDouble(obj));
 	else if (PySequence_Check(obj)) {
@@ -2549,12 +2621,15 @@ SharedVariables & moduleVars()
 
 PyObject * pyPopObj(void * p)
 {
+	// genotypes can be changed from Python
+	static_cast<Population *>(p)->detachGenotype();
 	return SWIG_NewPointerObj(p, g_swigPopType, 0);
 }
 
 
 PyObject * pyIndObj(void * p)
 {
+	IndBuffers::detachGenotype(static_cast<Individual *>(p)->bufferIdx());
 	return SWIG_NewPointerObj(p, g_swigIndividual, 0);
 }
 
@@ -3683,30 +3758,12 @@ double armitageTrendTest(const vector<vectoru> & table, const vectorf & s)
 }
 
 
-double hweTest(const vectoru & cnt)
+/* Calculates the cumulative probabilities of observing no more (\e lower)
+ * and no less (\e upper) heterozygotes in \e diplotypes genotypes with
+ * \e rare copies of the rare allele.
+ */
+void hweCumProbs(size_t diplotypes, size_t rare, vectorf & lower, vectorf & upper)
 {
-	// Calculates exact two-sided hardy-weinberg p-value. Parameters
-	// are number of genotypes, number of rare alleles observed and
-	// number of heterozygotes observed.
-	//
-	// (c) 2003 Jan Wigginton, Goncalo Abecasis
-	size_t obsAA = cnt[2] > cnt[0] ? cnt[0] : cnt[2];                                             // in this algorithm, AA is rare.
-	size_t obsAB = cnt[1];
-	size_t obsBB = cnt[2] > cnt[0] ? cnt[2] : cnt[0];
-
-	size_t diplotypes = obsAA + obsAB + obsBB;
-	size_t rare = (obsAA * 2) + obsAB;
-	size_t hets = obsAB;
-
-
-	//make sure "rare" allele is really the rare allele
-	if (rare > diplotypes)
-		rare = 2 * diplotypes - rare;
-
-	//make sure numbers aren't screwy
-	if (hets > rare)
-		throw ValueError((boost::format("HW test: %1% heterozygotes but only %2% rare alleles.") % hets % rare).str());
-
 	vectorf tailProbs(rare + 1, 0.0);
 
 	//start at midpoint
@@ -3747,24 +3804,100 @@ double hweTest(const vectoru & cnt)
 	for (size_t z = 0; z < tailProbs.size(); z++)
 		tailProbs[z] /= sum;
 
-	double top = tailProbs[hets];
-	for (size_t i = hets + 1; i <= rare; i++)
-		top += tailProbs[i];
+	lower.resize(rare + 1);
+	upper.resize(rare + 1);
+	double cum = 0;
+	for (size_t i = 0; i <= rare; ++i) {
+		cum += tailProbs[i];
+		lower[i] = cum;
+	}
+	cum = 0;
+	for (size_t i = rare + 1; i > 0; --i) {
+		cum += tailProbs[i - 1];
+		upper[i - 1] = cum;
+	}
+}
+
+
+/* Returns the number of genotypes and rare alleles of genotype counts \e cnt,
+ * and the number of heterozygotes in \e hets.
+ */
+std::pair<size_t, size_t> hweAlleleCount(const size_t * cnt, size_t & hets)
+{
+	size_t obsAA = cnt[2] > cnt[0] ? cnt[0] : cnt[2];                                             // in this algorithm, AA is rare.
+	size_t obsAB = cnt[1];
+	size_t obsBB = cnt[2] > cnt[0] ? cnt[2] : cnt[0];
+
+	size_t diplotypes = obsAA + obsAB + obsBB;
+	size_t rare = (obsAA * 2) + obsAB;
+
+	hets = obsAB;
+
+	//make sure "rare" allele is really the rare allele
+	if (rare > diplotypes)
+		rare = 2 * diplotypes - rare;
+	return std::pair<size_t, size_t>(diplotypes, rare);
+}
 
-	double otherSide = tailProbs[hets];
-	for (ssize_t i = hets - 1; i >= 0; i--)
-		otherSide += tailProbs[i];
 
-	if (top > 0.5 && otherSide > 0.5) {
+double hwePvalue(double top, double otherSide)
+{
+	if (top > 0.5 && otherSide > 0.5)
+		return 1.0;
+	else if (top < otherSide)
+		return top * 2;
+	else
+		return otherSide * 2;
+}
+
+
+double hweTest(const vectoru & cnt)
+{
+	// Calculates exact two-sided hardy-weinberg p-value. Parameters
+	// are number of genotypes, number of rare alleles observed and
+	// number of heterozygotes observed.
+	//
+	// (c) 2003 Jan Wigginton, Goncalo Abecasis
+	size_t hets = 0;
+	std::pair<size_t, size_t> key = hweAlleleCount(&cnt[0], hets);
+	size_t rare = key.second;
+
+	//make sure numbers aren't screwy
+	if (hets > rare)
+		throw ValueError((boost::format("HW test: %1% heterozygotes but only %2% rare alleles.") % hets % rare).str());
+
+	if (key.first == 0)
+		return 1.0;
+
+	vectorf lower;
+	vectorf upper;
+	hweCumProbs(key.first, rare, lower, upper);
+	return hwePvalue(upper[hets], lower[hets]);
+}
+
+
+double HWETestCache::pvalue(const size_t * cnt)
+{
+	size_t hets = 0;
+	Key key = hweAlleleCount(cnt, hets);
+
+	// no heterozygote count is larger than the number of rare alleles for
+	// counts of real genotypes.
+	if (key.first == 0 || hets > key.second)
 		return 1.0;
-	} else {
-		if (top < otherSide)
-			return top * 2;
-		else
-			return otherSide * 2;
-	}
 
-	return 1.0;
+	std::map<Key, Table>::iterator it = m_tables.find(key);
+	if (it == m_tables.end()) {
+		// do not let the cache grow without limit
+		if (m_size > 1048576) {
+			m_tables.clear();
+			m_size = 0;
+		}
+		it = m_tables.insert(std::make_pair(key, Table())).first;
+		hweCumProbs(key.first, key.second, it->second.first, it->second.second);
+		m_size += key.second + 1;
+	}
+	return hwePvalue(it->second.second[hets], it->second.first[hets]);
 }
 
 
@@ -4435,6 +4568,72 @@ double Bernullitrials_T::probSuccRate() const
 #undef getBit
 
 
+#ifdef LONGALLELE
+
+size_t MutantRegistry::add(size_t loc, long gen)
+{
+	MutantIndex::iterator it = m_index.find(loc);
+
+	if (it != m_index.end())
+		return it->second;
+	Mutant mutant = { loc, gen };
+	m_mutants.push_back(mutant);
+	m_index[loc] = m_mutants.size() - 1;
+	return m_mutants.size() - 1;
+}
+
+
+void MutantRegistry::remove(size_t loc)
+{
+	MutantIndex::iterator it = m_index.find(loc);
+
+	if (it == m_index.end())
+		return;
+	size_t idx = it->second;
+	m_index.erase(it);
+	// move the last mutant to the vacated entry
+	if (idx + 1 != m_mutants.size()) {
+		m_mutants[idx] = m_mutants.back();
+		m_index[m_mutants[idx].loc] = idx;
+	}
+	m_mutants.pop_back();
+}
+
+
+void MutantRegistry::sync(ConstGenoIterator begin, ConstGenoIterator end, long gen)
+{
+	vector<bool> present(m_mutants.size(), false);
+
+	for (; begin != end; ++begin) {
+		if (*begin == 0u)
+			continue;
+		size_t idx = add(static_cast<size_t>(*begin), -1);
+		if (idx >= present.size())
+			present.resize(idx + 1, false);
+		present[idx] = true;
+	}
+	// remove lost mutants
+	size_t last = 0;
+	for (size_t i = 0; i < m_mutants.size(); ++i) {
+		if (!present[i])
+			continue;
+		if (i != last)
+			m_mutants[last] = m_mutants[i];
+		++last;
+	}
+	if (last != m_mutants.size()) {
+		m_mutants.resize(last);
+		m_index.clear();
+		for (size_t i = 0; i < m_mutants.size(); ++i)
+			m_index[m_mutants[i].loc] = i;
+	}
+	m_syncedGen = gen;
+	m_syncedSize = m_mutants.size();
+}
+
+#endif
+
+
 // Global debug and initialization related functions
 
 void gsl_error_handler(const char * reason, const char *,
@@ -4636,6 +4835,9 @@ PyObject * moduleInfo()
 #endif
 	Py_DECREF(val);
 
+	// placement of population buffers
+	PyDict_SetItem(dict, PyString_FromString("firstTouch"), firstTouch() ? Py_True : Py_False);
+
 	// 32 or 64 bits
 #ifdef _WIN64
 	PyDict_SetItem(dict, PyString_FromString("wordsize"), val = PyLong_FromLong(64));
@@ -70,6 +70,14 @@ using std::setw;
 
 #include <set>
 
+#if TR1_SUPPORT == 0
+#  include <map>
+#elif TR1_SUPPORT == 1
+#  include <unordered_map>
+#else
+#  include <tr1/unordered_map>
+#endif
+
 /// for ranr generator
 #include "gsl/gsl_sys.h"                                           // for floating point comparison
 #include "gsl/gsl_rng.h"
@@ -153,16 +161,36 @@ void checkRefCount();
  *  a number set by environmental variable \c OMP_NUM_THREADS.
  *  Second and third argument is to set the type or seed of existing random number generator using RNG \e name
  *  with \e seed. If using openMP, it sets the type or seed of random number
- *  generator of each thread.
+ *  generator of each thread. If \e firstTouch is set to \c 1, newly allocated
+ *  genotype, lineage and information field buffers of populations are first
+ *  written by the threads that will later generate offspring into them, so
+ *  that their memory pages are placed on the NUMA nodes of these threads
+ *  (Linux only). This policy can be turned off by setting \e firstTouch to
+ *  \c 0, and is left unchanged by the default value \c -1. The current
+ *  policy is available from <tt>moduleInfo()['firstTouch']</tt>.
  */
-void setOptions(const int numThreads = -1, const char * name = NULL, unsigned long seed = 0);
+void setOptions(const int numThreads = -1, const char * name = NULL, unsigned long seed = 0,
+                const int firstTouch = -1);
 
 /// CPPONLY get number of thread in openMP
 UINT numThreads();
 
+/// CPPONLY whether or not population buffers are placed by first touch
+bool firstTouch();
+
+/** CPPONLY return the physical pages that lie completely within memory region
+ *  [\e begin, \e begin + \e size) to the system so that they will be
+ *  reallocated, filled with zero, on the node of the thread that first writes
+ *  to them. Return \c false if this is not supported by the platform.
+ */
+bool releasePages(void * begin, size_t size);
+
 /// CPPONLY return val and increase val by 1, ensuring thread safety
 ATOMICLONG fetchAndIncrement(ATOMICLONG * val);
 
+/// CPPONLY return val and increase val by n, ensuring thread safety
+ATOMICLONG fetchAndAdd(ATOMICLONG * val, ATOMICLONG n);
+
 /// CPPONLY parallel sort by using tbb or gnu parallel
 template<class T1, class T2>
 void parallelSort(T1 start, T1 end, T2 cmp)
@@ -2011,6 +2039,33 @@ double armitageTrendTest(const vector<vectoru> & table, const vectorf & weight);
 /// CPPONLY
 double hweTest(const vectoru & cnt);
 
+/** CPPONLY Exact HWE tests that keep the cumulative probabilities of the
+ *  heterozygote distribution for each number of genotypes and rare alleles,
+ *  so that loci with the same allele counts are tested in constant time.
+ *  An object of this class should not be shared by threads.
+ */
+class HWETestCache
+{
+public:
+	HWETestCache() : m_tables(), m_size(0)
+	{
+	}
+
+
+	/// p-value of the test for genotype counts \e cnt (AA, AB, BB)
+	double pvalue(const size_t * cnt);
+
+private:
+	typedef std::pair<size_t, size_t> Key;
+	/// cumulative probabilities of no more and no less heterozygotes
+	typedef std::pair<vectorf, vectorf> Table;
+
+	std::map<Key, Table> m_tables;
+
+	/// total length of cached tables
+	size_t m_size;
+};
+
 /// CPPONLY
 template <typename IT>
 void propToCount(IT first, IT last, size_t N, vectoru & count)
@@ -2486,6 +2541,125 @@ private:
 };
 
 
+#ifdef LONGALLELE
+/** CPPONLY A registry of mutants in mutational space, where alleles are
+ *  locations of mutants. Each mutant is stored, with the generation at which
+ *  it is introduced, in a contiguous table that is indexed by a hash table
+ *  from location to table entry. A registry holds all mutants that were
+ *  segregating when it was last synchronized with a population, and all
+ *  mutants added after that, so checking if a location is vacant is a hash
+ *  lookup, without scanning the population.
+ */
+class MutantRegistry
+{
+public:
+	struct Mutant
+	{
+		/// location of the mutant
+		size_t loc;
+		/// generation at which the mutant is introduced, -1 if unknown
+		long gen;
+	};
+
+	MutantRegistry() : m_mutants(), m_index(), m_syncedGen(-1), m_syncedSize(0)
+	{
+	}
+
+
+	/// number of registered mutants
+	size_t size() const
+	{
+		return m_mutants.size();
+	}
+
+
+	/// return the index of mutant at \e loc, or \c NOT_FOUND.
+	size_t find(size_t loc) const
+	{
+		MutantIndex::const_iterator it = m_index.find(loc);
+
+		return it == m_index.end() ? NOT_FOUND : it->second;
+	}
+
+
+	/// if there is a registered mutant at \e loc
+	bool contains(size_t loc) const
+	{
+		return m_index.find(loc) != m_index.end();
+	}
+
+
+	const Mutant & operator[](size_t idx) const
+	{
+		return m_mutants[idx];
+	}
+
+
+	Mutant & operator[](size_t idx)
+	{
+		return m_mutants[idx];
+	}
+
+
+	/** Register a mutant at \e loc introduced at generation \e gen, and
+	 *  return its index. The index of the existing mutant is returned if
+	 *  \e loc is already registered.
+	 */
+	size_t add(size_t loc, long gen);
+
+	/// remove mutant at \e loc from the registry
+	void remove(size_t loc);
+
+	/** Keep only mutants in genotype <tt>[begin, end)</tt>, and register
+	 *  mutants that are not yet registered (with unknown generation). This
+	 *  function scans the whole genotype so it should be called sparingly.
+	 */
+	void sync(ConstGenoIterator begin, ConstGenoIterator end, long gen);
+
+	/// generation at which the registry was last synchronized
+	long syncedGen() const
+	{
+		return m_syncedGen;
+	}
+
+
+	/// number of mutants right after the last synchronization
+	size_t syncedSize() const
+	{
+		return m_syncedSize;
+	}
+
+
+	void swap(MutantRegistry & rhs)
+	{
+		m_mutants.swap(rhs.m_mutants);
+		m_index.swap(rhs.m_index);
+		std::swap(m_syncedGen, rhs.m_syncedGen);
+		std::swap(m_syncedSize, rhs.m_syncedSize);
+	}
+
+
+private:
+#if TR1_SUPPORT == 0
+	typedef std::map<size_t, size_t> MutantIndex;
+#elif TR1_SUPPORT == 1
+	typedef std::unordered_map<size_t, size_t> MutantIndex;
+#else
+	typedef std::tr1::unordered_map<size_t, size_t> MutantIndex;
+#endif
+
+	vector<Mutant> m_mutants;
+
+	MutantIndex m_index;
+
+	long m_syncedGen;
+
+	size_t m_syncedSize;
+};
+
+#endif
+
+
 // ////////////////////////////////////////////////////////////
 // /  Global debug and initialization related functions
 // ////////////////////////////////////////////////////////////
@@ -2506,6 +2680,8 @@ private:
  *  \li \c alleleBits: the number of bits used to store an allele
  *  \li \c maxNumSubPop: maximum number of subpopulations.
  *  \li \c maxIndex: maximum index size (limits population size * total number of marker).
+ *  \li \c firstTouch: Whether or not population buffers are placed by the
+ *       threads that first write to them (\c True or \c False).
  *  \li \c debug: A dictionary with debugging codes as keys and the status of each
  *       debugging code (\c True or \c False) as their values.
  */
@@ -462,6 +462,13 @@ void CombinedSplitter::activate(const Population & pop, size_t subPop, size_t vi
 }
 
 
+void CombinedSplitter::prepare(const Population & pop) const
+{
+	for (size_t s = 0; s < m_splitters.size(); ++s)
+		m_splitters[s]->prepare(pop);
+}
+
+
 string CombinedSplitter::name(size_t sp) const
 {
 	DBG_FAILIF(static_cast<UINT>(sp) >= numVirtualSubPop(), IndexError,
@@ -582,6 +589,13 @@ void ProductSplitter::activate(const Population & pop, size_t subPop, size_t vir
 }
 
 
+void ProductSplitter::prepare(const Population & pop) const
+{
+	for (size_t s = 0; s < m_splitters.size(); ++s)
+		m_splitters[s]->prepare(pop);
+}
+
+
 string ProductSplitter::name(size_t sp) const
 {
 	DBG_FAILIF(static_cast<UINT>(sp) >= numVirtualSubPop(), IndexError,
@@ -1083,7 +1097,8 @@ string RangeSplitter::name(size_t subPop) const
 GenotypeSplitter::GenotypeSplitter(const lociList & loci,
 	const intMatrix & alleles, bool phase, const stringList & names)
 	: BaseVspSplitter(names), m_loci(loci), m_alleles(alleles.elems()),
-	m_phase(phase)
+	m_phase(phase), m_compiledPloidy(0), m_compiledNumLoci(0), m_codes(),
+	m_codeBits(1), m_keyWords(1), m_keys()
 {
 }
 
@@ -1094,13 +1109,19 @@ size_t GenotypeSplitter::size(const Population & pop, size_t subPop, size_t virt
 		return countVisibleInds(pop, subPop);
 	DBG_FAILIF(static_cast<UINT>(virtualSubPop) >= m_alleles.size(), IndexError,
 		"Virtual subpopulation index out of range");
-	const vectori & alleles = m_alleles[virtualSubPop];
-	size_t count = 0;
+	prepare(pop);
+	const vectoru & loci = m_loci.elems(&pop);
 	ConstRawIndIterator it = pop.rawIndBegin(subPop);
-	ConstRawIndIterator it_end = pop.rawIndEnd(subPop);
-	for (; it != it_end; ++it)
-		if (match(&*it, alleles))
-			++count;
+	ssize_t numInds = pop.rawIndEnd(subPop) - it;
+	size_t count = 0;
+#pragma omp parallel reduction (+ : count) if(numThreads() > 1)
+	{
+		vector<ULONG> key(m_keyWords);
+#pragma omp for
+		for (ssize_t i = 0; i < numInds; ++i)
+			if (indKey(*(it + i), loci, &key[0]) && hasKey(virtualSubPop, &key[0]))
+				++count;
+	}
 	return count;
 }
 
@@ -1118,11 +1139,14 @@ bool GenotypeSplitter::contains(const Population & pop, size_t ind, vspID vsp) c
 	DBG_FAILIF(static_cast<UINT>(virtualSubPop) >= m_alleles.size(), IndexError,
 		"Virtual subpopulation index out of genotype");
 
-	const vectori & alleles = m_alleles[virtualSubPop];
-	// this can be very slow if contains is used extensively.
-	m_loci.elems(&pop);
-
-	return match(&pop.individual(ind, vsp.subPop()), alleles);
+	// patterns should have been compiled by prepare() so that this function
+	// can be called by multiple threads
+	const vectoru & loci = m_loci.elems(&pop);
+	DBG_ASSERT(m_compiledPloidy == pop.ploidy() && m_compiledNumLoci == loci.size(),
+		RuntimeError, "Genotype splitter is not prepared for the population");
+	vector<ULONG> key(m_keyWords);
+	return indKey(pop.individual(ind, vsp.subPop()), loci, &key[0]) &&
+	       hasKey(virtualSubPop, &key[0]);
 }
 
 
@@ -1131,12 +1155,17 @@ void GenotypeSplitter::activate(const Population & pop, size_t subPop, size_t vi
 	DBG_FAILIF(static_cast<UINT>(virtualSubPop) >= m_alleles.size(), IndexError,
 		"Virtual subpopulation index out of genotype");
 
-	m_loci.elems(&pop);
-	const vectori & alleles = m_alleles[virtualSubPop];
+	prepare(pop);
+	const vectoru & loci = m_loci.elems(&pop);
 	ConstRawIndIterator it = pop.rawIndBegin(subPop);
-	ConstRawIndIterator it_end = pop.rawIndEnd(subPop);
-	for (; it != it_end; ++it)
-		it->setVisible(match(&*it, alleles));
+	ssize_t numInds = pop.rawIndEnd(subPop) - it;
+#pragma omp parallel if(numThreads() > 1)
+	{
+		vector<ULONG> key(m_keyWords);
+#pragma omp for
+		for (ssize_t i = 0; i < numInds; ++i)
+			(it + i)->setVisible(indKey(*(it + i), loci, &key[0]) && hasKey(virtualSubPop, &key[0]));
+	}
 	m_activated = subPop;
 }
 
@@ -1181,76 +1210,135 @@ string GenotypeSplitter::name(size_t subPop) const
 }
 
 
-bool GenotypeSplitter::match(const Individual * it, const vectori & alleles) const
+void GenotypeSplitter::prepare(const Population & pop) const
 {
-	int ploidy = it->ploidy();
-	size_t numLoci = m_loci.allAvail() ? m_loci.elems((const GenoStruTrait *)(it)).size() : m_loci.size();
+	compile(pop.ploidy(), m_loci.elems(&pop).size());
+}
 
-	size_t choices = alleles.size() / ploidy / numLoci;
 
-	DBG_FAILIF(alleles.size() != choices * ploidy * numLoci,
-		ValueError, "Given genotype does not match population ploidy.");
+void GenotypeSplitter::compile(size_t ploidy, size_t numLoci) const
+{
+	if (ploidy == m_compiledPloidy && numLoci == m_compiledNumLoci)
+		return;
 
-	for (unsigned t = 0; t < choices; ++t) {
-		vectori partial(alleles.begin() + t * ploidy * numLoci,
-		                alleles.begin() + (t + 1) * ploidy * numLoci);
-		if (matchSingle(it, partial))
-			return true;
+	DBG_FAILIF(numLoci == 0, ValueError, "No locus is specified for a genotype splitter.");
+	// alleles used by patterns, others cannot be matched
+	m_codes.clear();
+	for (size_t vsp = 0; vsp < m_alleles.size(); ++vsp)
+		for (size_t i = 0; i < m_alleles[vsp].size(); ++i)
+			if (m_alleles[vsp][i] >= 0)
+				m_codes.push_back(m_alleles[vsp][i]);
+	std::sort(m_codes.begin(), m_codes.end());
+	m_codes.erase(std::unique(m_codes.begin(), m_codes.end()), m_codes.end());
+
+	m_codeBits = 1;
+	while ((static_cast<size_t>(1) << m_codeBits) < m_codes.size())
+		++m_codeBits;
+	size_t perWord = 8 * sizeof(ULONG) / m_codeBits;
+	m_keyWords = (ploidy * numLoci + perWord - 1) / perWord;
+
+	m_keys.assign(m_alleles.size(), vector<ULONG>());
+	vectoru codes(ploidy);
+	for (size_t vsp = 0; vsp < m_alleles.size(); ++vsp) {
+		const vectori & alleles = m_alleles[vsp];
+		size_t choices = alleles.size() / ploidy / numLoci;
+		DBG_FAILIF(alleles.size() != choices * ploidy * numLoci,
+			ValueError, "Given genotype does not match population ploidy.");
+
+		vector<vector<ULONG> > keys;
+		for (size_t t = 0; t < choices; ++t) {
+			vector<ULONG> key(m_keyWords, 0);
+			size_t idx = 0;
+			bool valid = true;
+			for (size_t l = 0; l < numLoci && valid; ++l) {
+				for (size_t p = 0; p < ploidy; ++p) {
+					// phased patterns are arranged locus by locus and
+					// unphased ones haplotype by haplotype
+					int a = m_phase || ploidy == 1 ? alleles[(t * numLoci + l) * ploidy + p]
+					        : alleles[t * numLoci * ploidy + l + p * numLoci];
+					if (a < 0) {
+						valid = false;
+						break;
+					}
+					codes[p] = std::lower_bound(m_codes.begin(), m_codes.end(),
+						static_cast<size_t>(a)) - m_codes.begin();
+				}
+				if (!m_phase)
+					std::sort(codes.begin(), codes.end());
+				for (size_t p = 0; p < ploidy; ++p, ++idx)
+					key[idx / perWord] = (key[idx / perWord] << m_codeBits) | codes[p];
+			}
+			if (valid)
+				keys.push_back(key);
+		}
+		std::sort(keys.begin(), keys.end());
+		keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+		for (size_t t = 0; t < keys.size(); ++t)
+			m_keys[vsp].insert(m_keys[vsp].end(), keys[t].begin(), keys[t].end());
 	}
-	return false;
+	m_compiledNumLoci = numLoci;
+	m_compiledPloidy = ploidy;
 }
 
 
-bool GenotypeSplitter::matchSingle(const Individual * it, const vectori & alleles) const
+bool GenotypeSplitter::indKey(const Individual & ind, const vectoru & loci, ULONG * key) const
 {
-	int ploidy = it->ploidy();
-	const vectoru & loci = m_loci.elems((const GenoStruTrait *)(it));
-
-	if (m_phase || ploidy == 1) {
-		// if phase=True, has to match exactly.
-		UINT idx = 0;
-		uintList::const_iterator loc = loci.begin();
-		uintList::const_iterator loc_end = loci.end();
-		for (; loc != loc_end; ++loc)
-			for (int p = 0; p < ploidy; ++p)
-				if (static_cast<int>(it->allele(*loc, p)) != alleles[idx++])
-					return false;
-		return true;
-	} else if (ploidy == 2) {
-		size_t idx = 0;
-		uintList::const_iterator loc = loci.begin();
-		uintList::const_iterator loc_end = loci.end();
-		size_t numLoci = loci.size();
-		for (; loc != loc_end; ++loc, ++idx) {
-			int a1 = it->allele(*loc, 0);
-			int a2 = it->allele(*loc, 1);
-			int a3 = alleles[idx];
-			int a4 = alleles[idx + numLoci];
-			if (!((a1 == a3 && a2 == a4) || (a1 == a4 && a2 == a3)))
+	size_t ploidy = ind.ploidy();
+	size_t totNumLoci = ind.totNumLoci();
+	size_t perWord = 8 * sizeof(ULONG) / m_codeBits;
+	GenoIterator geno = ind.genoBegin();
+	// codes of alleles at a locus, which are sorted if phase does not matter
+	vectoru codes(ploidy > 2 ? ploidy : 0);
+	size_t code[2];
+
+	std::fill(key, key + m_keyWords, 0);
+	size_t idx = 0;
+	for (size_t l = 0; l < loci.size(); ++l) {
+		for (size_t p = 0; p < ploidy; ++p) {
+			size_t a = static_cast<size_t>(DEREF_ALLELE(geno + loci[l] + p * totNumLoci));
+			vectoru::const_iterator it = std::lower_bound(m_codes.begin(), m_codes.end(), a);
+			if (it == m_codes.end() || *it != a)
 				return false;
+			if (ploidy > 2)
+				codes[p] = it - m_codes.begin();
+			else
+				code[p] = it - m_codes.begin();
 		}
-		return true;
-	} else {
-		UINT idx = 0;
-		uintList::const_iterator loc = loci.begin();
-		uintList::const_iterator loc_end = loci.end();
-		size_t numLoci = loci.size();
-		vectori v1(ploidy);
-		vectori v2(ploidy);
-		for (; loc != loc_end; ++loc, ++idx) {
-			for (int p = 0; p < ploidy; ++p) {
-				v1[p] = it->allele(*loc, p);
-				v2[p] = alleles[idx + p * numLoci];
-			}
-			std::sort(v1.begin(), v1.end());
-			std::sort(v2.begin(), v2.end());
-			for (int p = 0; p < ploidy; ++p)
-				if (v1[p] != v2[p])
-					return false;
+		if (ploidy > 2) {
+			if (!m_phase)
+				std::sort(codes.begin(), codes.end());
+			for (size_t p = 0; p < ploidy; ++p, ++idx)
+				key[idx / perWord] = (key[idx / perWord] << m_codeBits) | codes[p];
+		} else {
+			if (ploidy == 2 && !m_phase && code[0] > code[1])
+				std::swap(code[0], code[1]);
+			for (size_t p = 0; p < ploidy; ++p, ++idx)
+				key[idx / perWord] = (key[idx / perWord] << m_codeBits) | code[p];
 		}
-		return true;
 	}
-	return false;
+	return true;
+}
+
+
+bool GenotypeSplitter::hasKey(size_t vsp, const ULONG * key) const
+{
+	const vector<ULONG> & keys = m_keys[vsp];
+
+	if (m_keyWords == 1)
+		return std::binary_search(keys.begin(), keys.end(), key[0]);
+
+	// binary search of keys with multiple words
+	size_t lo = 0;
+	size_t hi = keys.size() / m_keyWords;
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+		const ULONG * k = &keys[mid * m_keyWords];
+		if (std::lexicographical_compare(k, k + m_keyWords, key, key + m_keyWords))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo < keys.size() / m_keyWords && std::equal(key, key + m_keyWords, &keys[lo * m_keyWords]);
 }
 
 
@@ -339,6 +339,16 @@ public:
 	/// CPPONLY
 	virtual void activate(const Population & pop, size_t subPop, size_t virtualSubPop) = 0;
 
+	/** Prepare the splitter for population \e pop so that function
+	 *  \c contains can be called for its individuals from multiple threads.
+	 *  CPPONLY
+	 */
+	virtual void prepare(const Population & pop) const
+	{
+		(void)pop;  // avoid warning about unused parameter
+	}
+
+
 	/// deactivate. Namely make all individuals visible again.
 	/// CPPONLY
 	void deactivate(size_t subPop)
@@ -454,6 +464,10 @@ public:
 	/// CPPONLY
 	void activate(const Population & pop, size_t subPop, size_t virtualSubPop);
 
+	/// prepare all combined splitters for population \e pop
+	/// CPPONLY
+	void prepare(const Population & pop) const;
+
 	/** Return the name of a VSP \e vsp, which is the name a VSP defined by one
 	 *  of the combined splitters unless a new set of names is specified. If
 	 *  a \e vspMap was used, names from different VSPs will be joined by \c "or".
@@ -521,6 +535,10 @@ public:
 	/// CPPONLY
 	void activate(const Population & pop, size_t subPop, size_t virtualSubPop);
 
+	/// prepare all splitters for population \e pop
+	/// CPPONLY
+	void prepare(const Population & pop) const;
+
 	/** Return the name of a VSP \e vsp, which is the names of indivdual VSPs
 	 *  separated by a comma, unless a new set of names is specified for each
 	 *  VSP.
@@ -881,6 +899,7 @@ public:
 
 	/** Return \c True if individual \e ind (an index relative to specified
 	 *  subpopulation) belongs to specified virtual subpopulation \e vsp.
+	 *  The splitter should have been prepared for \e pop.
 	 *  CPPONLY
 	 */
 	bool contains(const Population & pop, size_t ind, vspID vsp) const;
@@ -889,6 +908,11 @@ public:
 	/// CPPONLY
 	void activate(const Population & pop, size_t subPop, size_t virtualSubPop);
 
+	/** Resolve loci and compile allele patterns for population \e pop.
+	 *  CPPONLY
+	 */
+	void prepare(const Population & pop) const;
+
 	/** Return name of VSP \e vsp, which is <tt>"Genotype loc1,loc2:genotype"</tt>
 	 *  as defined by parameters \e loci and \e alleles. A user provided name
 	 *  will be returned if specified.
@@ -896,14 +920,44 @@ public:
 	string name(size_t vsp) const;
 
 private:
-	bool match(const Individual * ind, const vectori & alleles) const;
+	/** Compile allele patterns of all VSPs for individuals with \e ploidy
+	 *  and \e numLoci loci into sorted lists of keys, unless they have
+	 *  already been compiled for such individuals. Patterns are only
+	 *  compiled from the calling thread, before individuals are examined
+	 *  by multiple threads.
+	 */
+	void compile(size_t ploidy, size_t numLoci) const;
+
+	/** Write the key of genotype of \e ind at \e loci to \e key, which
+	 *  should have \c m_keyWords words. Return \c false if \e ind has an
+	 *  allele that is not used in any pattern, in which case it does not
+	 *  belong to any VSP.
+	 */
+	bool indKey(const Individual & ind, const vectoru & loci, ULONG * key) const;
 
-	bool matchSingle(const Individual * ind, const vectori & alleles) const;
+	/// if key \e key is one of the keys of VSP \e vsp
+	bool hasKey(size_t vsp, const ULONG * key) const;
 
 private:
 	lociList m_loci;
 	matrixi m_alleles;
 	bool m_phase;
+
+	/// ploidy and number of loci for which patterns are compiled
+	mutable size_t m_compiledPloidy;
+	mutable size_t m_compiledNumLoci;
+
+	/// sorted alleles used in patterns, an allele is coded by its index
+	mutable vectoru m_codes;
+
+	/// number of bits for each coded allele
+	mutable size_t m_codeBits;
+
+	/// number of words of each key
+	mutable size_t m_keyWords;
+
+	/// sorted keys (each with m_keyWords words) of each VSP
+	mutable vector<vector<ULONG> > m_keys;
 };
 
 }
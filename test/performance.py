@@ -1311,6 +1311,35 @@ class TestGenoIterator(PerformanceTest):
             'pop=getTestGenoIterPop(%d, %d, %d)' % (args[0], args[1], args[2]))
         return t.timeit(number=self.repeats)
 
+class TestFirstTouchPlacement(PerformanceTest):
+    def __init__(self, logger, time=30):
+        PerformanceTest.__init__(self, 'Random mating with population buffers placed by the main thread (firstTouch=0) '
+            'or by mating threads (firstTouch=1), results are number of offspring generated per second in %d seconds.' % int(time),
+            logger)
+        self.time = time
+
+    def run(self):
+        # overall running case, compare on multi-socket (NUMA) systems with -j #
+        return self.productRun(size=[100000, 1000000], loci=[1000], firstTouch=[0, 1])
+
+    def _run(self, size, loci, firstTouch):
+        # single test case
+        if size * loci * moduleInfo()['alleleBits'] / 8 > 1e9:
+            return 0
+        setOptions(firstTouch=firstTouch)
+        try:
+            # buffers are placed when the population and its scratch population are created
+            pop = Population(size=size, loci=loci)
+            start = time.time()
+            gens = pop.evolve(
+                initOps= [ InitSex(), InitGenotype(freq=[0.5, 0.5])],
+                preOps=TicToc(output='', stopAfter=self.time),
+                matingScheme=RandomMating(),
+            )
+            return int(gens * size / (time.time() - start))
+        finally:
+            setOptions(firstTouch=0)
+
 def analyze(test):
     '''Output performance statistics for a test
     '''
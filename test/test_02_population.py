@@ -10,7 +10,7 @@
 # $LastChangedDate$
 #
   
-import unittest, os, sys, random, copy
+import unittest, os, sys, random, copy, array
 from simuOpt import setOptions
 setOptions(quiet=True)
 new_argv = []
@@ -615,6 +615,24 @@ class TestPopulation(unittest.TestCase):
                     self.assertEqual(ind.allele(k), 0)
         self.assertRaises(ValueError, pop.addLoci, [2], [8], ['l7'])
         #
+        # repeated addition of loci, with individuals in and out of order
+        pop = self.getPop(size = [20, 30], loci = [3, 4], ancGen=2)
+        pop1 = pop.clone()
+        pop.sortIndividuals('x')
+        pop1.sortIndividuals('x')
+        for i in range(10):
+            pop.addLoci([i % 2], [10 + i])
+        self.assertEqual(pop.numLoci(), (8, 9))
+        for gen in range(pop.ancestralGens(), -1, -1):
+            pop.useAncestralGen(gen)
+            pop1.useAncestralGen(gen)
+            for ind, ind1 in zip(pop.individuals(), pop1.individuals()):
+                for p in range(pop.ploidy()):
+                    self.assertEqual(ind.genotype(p, 0)[:3], ind1.genotype(p, 0))
+                    self.assertEqual(ind.genotype(p, 1)[:4], ind1.genotype(p, 1))
+                    self.assertEqual(ind.genotype(p, 0)[3:], (0,)*5)
+                    self.assertEqual(ind.genotype(p, 1)[4:], (0,)*5)
+        #
 
     def testDeepcopy(self):
         'Testing deepcopy of population'
@@ -862,6 +880,56 @@ class TestPopulation(unittest.TestCase):
         for idx,ind in enumerate(pop.individuals()):
             self.assertEqual(ind.lineage(), range((idx*2+1)*20, (idx*2+2)*20))
 
+    def testRemoveIndividualsInParallel(self):
+        'Testing Population::removeIndividuals with multiple threads'
+        numThreads = moduleInfo()['threads']
+        pop = self.getPop(size=[300, 500, 200], loci=[5, 10], infoFields=['x', 'y'])
+        if moduleInfo()['alleleType'] == 'lineage':
+            pop.lineage()[:] = range(pop.popSize() * pop.genoSize())
+        removed = set(random.sample(range(pop.popSize()), 400) + list(range(300, 400)))
+        kept = [x for x in range(pop.popSize()) if x not in removed]
+        sizes = tuple([len([x for x in kept if x >= pop.subPopBegin(sp) and x < pop.subPopEnd(sp)])
+            for sp in range(pop.numSubPop())])
+        for threads in [1, 4]:
+            setOptions(numThreads=threads)
+            pop1 = pop.clone()
+            pop1.removeIndividuals(list(removed))
+            # surviving individuals are kept in their original order
+            self.assertEqual(pop1.subPopSizes(), sizes)
+            for idx, ind in enumerate(kept):
+                self.assertEqual(pop1.individual(idx), pop.individual(ind))
+                self.assertEqual(pop1.individual(idx).info('y'), pop.individual(ind).info('y'))
+            if moduleInfo()['alleleType'] == 'lineage':
+                lin = list(pop.lineage())
+                step = pop.genoSize()
+                self.assertEqual(list(pop1.lineage()),
+                    sum([lin[x*step:(x+1)*step] for x in kept], []))
+        setOptions(numThreads=numThreads)
+
+    def testFirstTouchPlacement(self):
+        'Testing placement of population buffers by mating threads'
+        numThreads = moduleInfo()['threads']
+        self.assertEqual(moduleInfo()['firstTouch'], False)
+        setOptions(numThreads=4)
+        pops = []
+        for firstTouch in [1, 0]:
+            setOptions(firstTouch=firstTouch, seed=123)
+            self.assertEqual(moduleInfo()['firstTouch'], firstTouch == 1)
+            pop = Population(size=[1000, 2500], loci=[20, 30], infoFields='x')
+            self.assertEqual(pop.genotype().count(0), pop.popSize() * pop.genoSize())
+            # growing populations allocate new buffers in each generation
+            pop.evolve(
+                initOps=[InitSex(), InitGenotype(freq=[0.3, 0.7]), InitInfo(1, infoFields='x')],
+                matingScheme=RandomMating(subPopSize=lambda gen: [1000 + 300 * gen, 2500 + 700 * gen]),
+                gen=5
+            )
+            self.assertEqual(pop.subPopSizes(), (2200, 5300))
+            self.assertEqual(pop.indInfo('x'), tuple([0.] * pop.popSize()))
+            pops.append(pop)
+        # placement of buffers does not change the evolutionary process
+        self.assertEqual(pops[0], pops[1])
+        setOptions(numThreads=numThreads)
+
     def testExtractSubPops(self):
         'Testing Population::extractSubPops()'
         pop = self.getPop(size=[0, 100, 0, 20, 30, 0, 50], subPopNames=['A', 'B', 'C', 'D', 'E', 'F', 'G'])
@@ -1015,6 +1083,35 @@ class TestPopulation(unittest.TestCase):
                 self.assertEqual(ind, pop.indByID(ind.ind_id), gen)
         self.assertEqual(sum(sz1), len(include))
 
+    def testRemoveLociRuns(self):
+        'Testing Population::removeLoci and extract with runs of loci'
+        pop = self.getPop(size=[20, 30], loci=[50, 40, 30], infoFields=['a', 'ind_id', 'c'], ancGen=2)
+        for gen in range(3):
+            pop.useAncestralGen(gen)
+            initGenotype(pop, freq=[.3, .7])
+            pop.setIndInfo(range(gen * 100 + 1, gen * 100 + 51), 'ind_id')
+        pop.useAncestralGen(0)
+        # runs that cross chromosomes, single loci, and the last locus
+        kept = list(range(0, 11)) + [12] + list(range(30, 96)) + [100, 119]
+        pop1 = pop.clone()
+        pop1.removeLoci(keep=kept)
+        # extract with loci and information fields
+        ped = Pedigree(pop, loci=kept, infoFields=['c', 'a'], ancGens=ALL_AVAIL,
+            fatherField='', motherField='')
+        self.assertEqual(ped.infoFields(), ('c', 'a', 'ind_id'))
+        for gen in range(3):
+            pop.useAncestralGen(gen)
+            pop1.useAncestralGen(gen)
+            ped.useAncestralGen(gen)
+            for idx in range(pop.popSize()):
+                ind = pop.individual(idx)
+                for p in range(2):
+                    geno = [ind.allele(x, p) for x in kept]
+                    self.assertEqual(list(pop1.individual(idx).genotype(p)), geno)
+                    self.assertEqual(list(ped.individual(idx).genotype(p)), geno)
+                self.assertEqual(ped.individual(idx).info('c'), ind.info('c'))
+                self.assertEqual(ped.individual(idx).info('a'), ind.info('a'))
+
     def testRemoveLoci(self):
         'Testing Population::removeLoci(loci=[], keep=[])'
         # Fixme: test loci, and keep, and test unordered parameters
@@ -1119,7 +1216,44 @@ class TestPopulation(unittest.TestCase):
             for loc in ['a2', 'a4']:
                 for p in range(2):
                     self.assertEqual(ind.allele(pop.locusByName(loc), p), 1)
-        # FIXME: recode ancestral generations.
+        # recode ancestral generations, with a function called once for
+        # each allele at each locus
+        pop = self.getPop(size=[10, 20], loci=[4, 5], ancGen=2)
+        for gen in range(3):
+            pop.useAncestralGen(gen)
+            initGenotype(pop, freq=[.3, .7])
+        pop.useAncestralGen(0)
+        old = []
+        for gen in range(3):
+            pop.useAncestralGen(gen)
+            old.append(list(pop.genotype()))
+        calls = []
+        def func1(allele, locus):
+            calls.append((allele, locus))
+            return (allele + locus) % 2
+        pop.recodeAlleles(func1, loci=[1, 3, 8])
+        self.assertEqual(len(calls), len(set(calls)))
+        for gen in range(3):
+            pop.useAncestralGen(gen)
+            new = pop.genotype()
+            for idx, (x, y) in enumerate(zip(old[gen], new)):
+                loc = idx % pop.totNumLoci()
+                if loc in [1, 3, 8]:
+                    self.assertEqual(y, (x + loc) % 2)
+                else:
+                    self.assertEqual(x, y)
+        # large alleles at many loci are recoded without lookup tables
+        if moduleInfo()['maxAllele'] > 2**20:
+            pop = self.getPop(size=[10, 20], loci=[20, 20])
+            initGenotype(pop, freq=[.3, .7])
+            pop.individual(3).setAllele(2**20, 5, 1)
+            old = list(pop.genotype())
+            calls = []
+            pop.recodeAlleles(func1)
+            self.assertEqual(len(calls), len(set(calls)))
+            self.assertTrue((2**20, 5) in calls)
+            for idx, (x, y) in enumerate(zip(old, pop.genotype())):
+                self.assertEqual(y, (x + idx % pop.totNumLoci()) % 2)
 
     def testResize(self):
         'Testing Population::resize(newSubPopSizes, propagate=false)'
@@ -1262,6 +1396,12 @@ class TestPopulation(unittest.TestCase):
                     self.assertEqual(ind.info('x'), 2)
             self.assertEqual(pop.indInfo('x', 0), tuple([1, 2]*(int(pop.subPopSize(0)/2))))
             self.assertEqual(pop.indInfo(0, 1), tuple([3, 4]*(int(pop.subPopSize(1)/2))))
+            # arrays of doubles are copied as a whole
+            pop.setIndInfo(array.array('d', range(pop.popSize())), 'x')
+            self.assertEqual(pop.indInfo('x'), tuple(range(pop.popSize())))
+            pop.setIndInfo(array.array('d', [5, 6]), 'x', 1)
+            self.assertEqual(pop.indInfo('x', 1), tuple([5, 6]*(int(pop.subPopSize(1)/2))))
+            self.assertEqual(pop.indInfo('x', 0), tuple(range(pop.subPopSize(0))))
         #
         testSetAndRead(self.getPop())
         testSetAndRead(self.getPop(True))
@@ -1306,6 +1446,59 @@ class TestPopulation(unittest.TestCase):
             pop1.useAncestralGen(gen)
             self.assertEqual(pop, pop1)
 
+    def testIndividualData(self):
+        'Testing genotype, info fields and lineage of individuals across generations'
+        lineage = moduleInfo()['alleleType'] == 'lineage'
+        def getPop(size):
+            pop = self.getPop(size=size, loci=[3, 4], infoFields=['x', 'y'])
+            if lineage:
+                initLineage(pop, [random.randint(1, 100) for x in range(pop.popSize())],
+                    mode=PER_INDIVIDUAL)
+            return pop
+        def indValue(ind):
+            return (list(ind.genotype()), ind.info('x'), ind.info('y'),
+                list(ind.lineage()) if lineage else [])
+        def indData(pop):
+            return [indValue(ind) for ind in pop.individuals()]
+        def allData(pop):
+            data = []
+            for gen in range(pop.ancestralGens(), -1, -1):
+                pop.useAncestralGen(gen)
+                data.append(indData(pop))
+            return data
+        # push generations of different sizes
+        pop = getPop([20, 30])
+        pop.setAncestralDepth(2)
+        data = [indData(pop)]
+        for size in [[10, 5], [40], [25, 25]]:
+            pop1 = getPop(size)
+            data.append(indData(pop1))
+            pop.push(pop1)
+            self.assertEqual(pop1.popSize(), 0)
+            self.assertEqual(allData(pop), data[-3:])
+        # populations created and released in between do not affect existing ones
+        for i in range(10):
+            getPop([50])
+        self.assertEqual(allData(pop), data[-3:])
+        # clone keeps data of all generations, after the original is removed
+        pop1 = pop.clone()
+        del pop
+        self.assertEqual(allData(pop1), data[-3:])
+        # swap exchanges all generations, including existing references to individuals
+        pop2 = getPop([15, 15])
+        data2 = [indData(pop2)]
+        pop1.useAncestralGen(0)
+        ind = pop1.individual(3)
+        pop1.swap(pop2)
+        self.assertEqual(allData(pop1), data2)
+        self.assertEqual(allData(pop2), data[-3:])
+        self.assertEqual(indValue(ind), data[-1][3])
+        # changing information fields relocates data of all generations
+        pop2.addInfoFields('z', 1)
+        pop2.setAncestralDepth(1)
+        self.assertEqual([[x[:3] for x in d] for d in allData(pop2)],
+            [[x[:3] for x in d] for d in data[-2:]])
+
     def testSave(self):
         'Testing Population::save(filename)'
         pop = self.getPop(ancGen=5, infoFields=['a', 'b'])
@@ -1334,6 +1527,23 @@ class TestPopulation(unittest.TestCase):
         pop1 = loadPopulation('popout')
         self.assertFalse('module_os' in pop1.vars())
         os.remove('popout')
+        if moduleInfo()['alleleType'] == 'lineage':
+            # lineage in runs, random lineage, and a single lineage
+            pop = self.getPop(ancGen=2)
+            sz = len(pop.lineage())
+            pop.lineage()[:] = [x // 7 for x in range(sz)]
+            pop.useAncestralGen(1)
+            pop.lineage()[:] = [random.randint(0, 1000) for x in range(sz)]
+            pop.useAncestralGen(2)
+            pop.lineage()[:] = [3] * sz
+            pop.useAncestralGen(0)
+            pop.save('popout')
+            pop1 = loadPopulation('popout')
+            for gen in range(3):
+                pop.useAncestralGen(gen)
+                pop1.useAncestralGen(gen)
+                self.assertEqual(list(pop.lineage()), list(pop1.lineage()))
+            os.remove('popout')
 
     def testCrossPlatformLoad(self):
         'Testing loading populations created from other platform and allele types'
@@ -1591,6 +1801,45 @@ class TestPopulation(unittest.TestCase):
             self.assertEqual(ind.allele(1, 0)==1 or ind.allele(1, 0)==0, True)
         for ind in pop.individuals([0, 1]):
             self.assertEqual(ind.allele(1, 0), 2)
+        # compare with genotypes matched directly
+        def match(ind, alleles, loci, phase):
+            ply = ind.ploidy()
+            n = len(loci)
+            for t in range(len(alleles) // (ply * n)):
+                geno = alleles[t * ply * n : (t + 1) * ply * n]
+                if phase and all([ind.allele(loc, p) == geno[i * ply + p]
+                    for i, loc in enumerate(loci) for p in range(ply)]):
+                    return True
+                if not phase and all([sorted([ind.allele(loc, p) for p in range(ply)]) ==
+                    sorted([geno[i + p * n] for p in range(ply)]) for i, loc in enumerate(loci)]):
+                    return True
+            return False
+        for ploidy, alleles in [(2, [[0, 1, 2, 2], [2, 1, 0, 1, 1, 1, 0, 0]]),
+                (3, [[0, 1, 2, 2, 1, 0], [1, 1, 1, 1, 1, 1, 0, 0, 2, 0, 0, 2]])]:
+            pop = Population([500, 300], ploidy=ploidy, loci=[3, 4])
+            initGenotype(pop, freq=[0.2, 0.3, 0.5])
+            for phase in [True, False]:
+                pop.setVirtualSplitter(GenotypeSplitter(loci=[2, 5], alleles=alleles, phase=phase))
+                for sp in range(2):
+                    for vsp in range(2):
+                        cnt = len([ind for ind in pop.individuals(sp) if match(ind, alleles[vsp], [2, 5], phase)])
+                        self.assertEqual(pop.subPopSize([sp, vsp]), cnt)
+                        self.assertEqual(len(list(pop.individuals([sp, vsp]))), cnt)
+                        for ind in pop.individuals([sp, vsp]):
+                            self.assertTrue(match(ind, alleles[vsp], [2, 5], phase))
+        # offspring are tested by several threads during mating
+        numThreads = moduleInfo()['threads']
+        setOptions(numThreads=4)
+        pop = Population([500, 300], loci=[3, 4], infoFields='a')
+        initSex(pop)
+        initGenotype(pop, freq=[0.2, 0.3, 0.5])
+        pop.setVirtualSplitter(GenotypeSplitter(loci=[2, 5], alleles=[[0, 1, 2, 2], [1, 1, 1, 1]]))
+        pop.evolve(matingScheme=RandomMating(ops=[MendelianGenoTransmitter(),
+            AdditiveQuanTrait(loci=0, effects=[[1, 1, 1]], infoFields='a',
+                subPops=[(ALL_AVAIL, 0)])]), gen=1)
+        for ind in pop.individuals():
+            self.assertEqual(ind.a == 2, match(ind, [0, 1, 2, 2], [2, 5], False))
+        setOptions(numThreads=numThreads)
 
 
     def testCombinedSplitter(self):
@@ -1961,6 +2210,136 @@ class TestPopulation(unittest.TestCase):
         for file in ['test.ped', 'test1.ped', 'test2.ped']:
             os.remove(file)
 
+    def testSaveLoadBinaryPedigree(self):
+        'Testing function loadPedigree with pedigrees saved in binary format'
+        pop = Population(200, loci=[5, 8], ancGen=-1,
+            infoFields=['ind_id', 'father_id', 'mother_id', 'x'])
+        tagID(pop, reset=True)
+        pop.evolve(
+            initOps = [
+                InitSex(),
+                InitGenotype(freq=[0.2, 0.3, 0.5]),
+            ],
+            preOps = MaPenetrance(loci=0, penetrance=[0.1, 0.5, 0.9]),
+            matingScheme=RandomMating(ops=[
+                MendelianGenoTransmitter(),
+                IdTagger(),
+                PedigreeTagger()]),
+            postOps = InitInfo(lambda: random.randint(0, 100) / 4., infoFields='x'),
+            gen = 5
+        )
+        pop.asPedigree()
+        for format in ['binary', 'binary.gz']:
+            pop.save('test1.ped', infoFields='x', loci=[1, 7, 8], format=format)
+            ped = loadPedigree('test1.ped')
+            self.assertEqual(ped.ancestralGens(), 5)
+            self.assertEqual(ped.numLoci(), (1, 2))
+            self.assertEqual(ped.infoFields(), ('ind_id', 'father_id', 'mother_id', 'x'))
+            for gen in range(6):
+                pop.useAncestralGen(gen)
+                ped.useAncestralGen(gen)
+                self.assertEqual(ped.indInfo('ind_id'), pop.indInfo('ind_id'))
+                self.assertEqual(ped.indInfo('x'), pop.indInfo('x'))
+                if gen < 5:
+                    self.assertEqual(ped.indInfo('father_id'), pop.indInfo('father_id'))
+                for i1, i2 in zip(ped.individuals(), pop.individuals()):
+                    self.assertEqual(i1.sex(), i2.sex())
+                    self.assertEqual(i1.affected(), i2.affected())
+                    self.assertEqual(i1.genotype(), [i2.allele(x, p) for p in range(2) for x in [1, 7, 8]])
+            # load selected generations
+            ped = loadPedigree('test1.ped', infoFields='y', ancGens=[1, 3])
+            self.assertEqual(ped.ancestralGens(), 1)
+            self.assertEqual(ped.infoFields(), ('ind_id', 'father_id', 'mother_id', 'y'))
+            for gen, pgen in [(0, 1), (1, 3)]:
+                pop.useAncestralGen(pgen)
+                ped.useAncestralGen(gen)
+                self.assertEqual(ped.indInfo('ind_id'), pop.indInfo('ind_id'))
+                self.assertEqual(ped.indInfo('y'), pop.indInfo('x'))
+            # skip saved fathers
+            ped = loadPedigree('test1.ped', fatherField='')
+            self.assertEqual(ped.infoFields(), ('ind_id', 'mother_id', 'x'))
+            for gen in range(6):
+                pop.useAncestralGen(gen)
+                ped.useAncestralGen(gen)
+                self.assertEqual(ped.indInfo('ind_id'), pop.indInfo('ind_id'))
+                self.assertEqual(ped.indInfo('x'), pop.indInfo('x'))
+                if gen < 5:
+                    self.assertEqual(ped.indInfo('mother_id'), pop.indInfo('mother_id'))
+                for i1, i2 in zip(ped.individuals(), pop.individuals()):
+                    self.assertEqual(i1.sex(), i2.sex())
+                    self.assertEqual(i1.genotype(), [i2.allele(x, p) for p in range(2) for x in [1, 7, 8]])
+        # alleles that are saved in four and eight bytes
+        for allele in [1000, 2**40 + 5]:
+            if allele > moduleInfo()['maxAllele']:
+                continue
+            pop.useAncestralGen(0)
+            pop.individual(3).setAllele(allele, 7, 1)
+            pop.save('test1.ped', loci=[1, 7, 8], format='binary')
+            ped = loadPedigree('test1.ped')
+            self.assertEqual(ped.individual(3).allele(1, 1), allele)
+            for i1, i2 in zip(ped.individuals(), pop.individuals()):
+                self.assertEqual(i1.genotype(), [i2.allele(x, p) for p in range(2) for x in [1, 7, 8]])
+        self.assertRaises(ValueError, pop.save, 'test1.ped', format='bin')
+        os.remove('test1.ped')
+
+    def testLoadPedigreeGenotype(self):
+        'Testing function loadPedigree with genotypes and information fields'
+        pop = Population(1000, loci=[10, 20], ancGen=-1,
+            infoFields=['ind_id', 'father_id', 'mother_id', 'x'])
+        tagID(pop, reset=True)
+        pop.evolve(
+            initOps = [
+                InitSex(),
+                InitGenotype(freq=[0.4, 0.6]),
+            ],
+            preOps = MaPenetrance(loci=0, penetrance=[0.1, 0.5, 0.9]),
+            matingScheme=RandomMating(ops=[
+                MendelianGenoTransmitter(),
+                IdTagger(),
+                PedigreeTagger()]),
+            postOps = InitInfo(lambda: random.randint(0, 100) / 4., infoFields='x'),
+            gen = 20
+        )
+        pop.asPedigree()
+        # a file of several megabytes that is parsed in chunks
+        pop.save('test1.ped', infoFields='x', loci=ALL_AVAIL)
+        ped = loadPedigree('test1.ped', infoFields='x')
+        self.assertEqual(ped.ancestralGens(), pop.ancestralGens())
+        self.assertEqual(ped.totNumLoci(), 30)
+        inds = {}
+        for gen in range(pop.ancestralGens() + 1):
+            pop.useAncestralGen(gen)
+            for ind in pop.individuals():
+                inds[ind.ind_id] = (ind.sex(), ind.affected(), ind.x, list(ind.genotype()))
+        for gen in range(ped.ancestralGens() + 1):
+            ped.useAncestralGen(gen)
+            self.assertEqual(ped.popSize(), 1000)
+            for ind in ped.individuals():
+                self.assertEqual((ind.sex(), ind.affected(), ind.x, list(ind.genotype())),
+                    inds[ind.ind_id])
+        # parents can be listed after their offspring
+        with open('test1.ped', 'w') as ped:
+            ped.write('3 1 2 F A 1 0 1 0\n\n1 0 0 M U 0 0 0 1\n  2 0 0 F U 1 1 1 1\n')
+        ped = loadPedigree('test1.ped')
+        self.assertEqual(ped.ancestralGens(), 1)
+        self.assertEqual(ped.indInfo('ind_id'), (3,))
+        self.assertEqual(ped.indInfo('father_id'), (1,))
+        self.assertEqual(ped.indInfo('mother_id'), (2,))
+        self.assertEqual(ped.individual(0).genotype(), [1, 1, 0, 0])
+        self.assertEqual(ped.individual(0).sex(), FEMALE)
+        self.assertTrue(ped.individual(0).affected())
+        ped.useAncestralGen(1)
+        self.assertEqual(ped.indInfo('ind_id'), (1, 2))
+        self.assertEqual(ped.individual(0).genotype(), [0, 0, 0, 1])
+        # duplicate IDs and individuals who are their own ancestors
+        with open('test1.ped', 'w') as ped:
+            ped.write('1 0 0 M\n2 0 0 F\n1 0 0 F\n')
+        self.assertRaises(ValueError, loadPedigree, 'test1.ped')
+        with open('test1.ped', 'w') as ped:
+            ped.write('3 0 0 M\n1 3 2 M\n2 1 0 F\n')
+        self.assertRaises(ValueError, loadPedigree, 'test1.ped')
+        os.remove('test1.ped')
+
     def testDiscardIf(self):
         'Testing operator DiscardIf'
         pop = Population(1000, loci=2, infoFields=['a', 'b'])
@@ -394,6 +394,23 @@ class TestOperator(unittest.TestCase):
         dump(pop, width=2, output='a.dump')
         dump(pop, infoFields='a', output='a.dump')
         dump(pop, infoFields=('b', 'a', 'b'), output='a.dump')
+        # content of the dump
+        pop = Population([3, 2], loci=[2, 1], chromTypes=[AUTOSOME, CHROMOSOME_Y],
+            alleleNames=['A', 'C'], infoFields='a')
+        initSex(pop, sex=[MALE, FEMALE])
+        pop.individual(0).setAllele(1, 1)
+        pop.setIndInfo([0.5, 2], 'a')
+        dump(pop, structure=False, width=2, max=4, output='a.dump')
+        with open('a.dump') as dmp:
+            self.assertEqual(dmp.read(),
+                'SubPopulation 0 (), 3 Individuals:\n'
+                '   0: MU  A C  _ |  A A  A |  0.5\n'
+                '   1: FU  A A  _ |  A A  _ |  2\n'
+                '   2: MU  A A  _ |  A A  A |  0.5\n'
+                'SubPopulation 1 (), 2 Individuals:\n'
+                '   3: FU  A A  _ |  A A  _ |  2\n'
+                ' ... (4 out of 5).\n\n\n')
+        os.remove('a.dump')
 
     def testcloseOutput(self):
         '''Testing global function closeOutput'''
@@ -421,6 +438,34 @@ class TestOperator(unittest.TestCase):
         self.assertRaises(RuntimeError, closeOutput, 'a.pop')
         os.remove('a.pop')
 
+    def testSavePopulationBackground(self):
+        '''Testing operator SavePopulation with background saving'''
+        pop = Population(500, loci=[200, 300], infoFields='a')
+        initSex(pop)
+        initGenotype(pop, freq=[.3, .7])
+        initInfo(pop, lambda: 1, infoFields='a')
+        pop.evolve(
+            matingScheme=RandomMating(),
+            postOps=[
+                PyExec('x = gen'),
+                SavePopulation(output='!"bg_%d.pop" % gen', background=2),
+                SavePopulation(output='!"fg_%d.pop" % gen'),
+            ],
+            gen=5
+        )
+        # all populations are saved when evolve returns
+        for gen in range(5):
+            bg = loadPopulation('bg_%d.pop' % gen)
+            fg = loadPopulation('fg_%d.pop' % gen)
+            self.assertEqual(bg, fg)
+            self.assertEqual(bg.dvars().x, gen)
+            os.remove('bg_%d.pop' % gen)
+            os.remove('fg_%d.pop' % gen)
+        # errors in background threads are raised at the end of evolve
+        self.assertRaises(RuntimeError, pop.evolve,
+            postOps=SavePopulation(output='nonexisting/dir/a.pop', background=2),
+            gen=1)
+
 
     # define a function
     def myFunc(self, pop):
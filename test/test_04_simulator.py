@@ -91,6 +91,45 @@ class TestSimulator(unittest.TestCase):
         self.assertEqual(simu.population(3).popSize(), 60)
         self.assertEqual(simu.numRep(), 6)
 
+    def testShareGenotype(self):
+        'Testing replicates that share genotypes until they are changed'
+        pop = Population(size=[200, 100], loci=[5, 10], ancGen=2)
+        initSex(pop)
+        initGenotype(pop, freq=[0.3, 0.7])
+        geno = list(pop.genotype())
+        def setDad(dad):
+            dad.setAllele(0, 0)
+            return True
+        results = []
+        for share in [False, True]:
+            getRNG().set(seed=12345)
+            simu = Simulator(pop, rep=3, stealPops=False, shareGenotype=share)
+            simu.evolve(
+                preOps=SNPMutator(u=0.01, reps=1),
+                matingScheme=RandomMating(ops=[MendelianGenoTransmitter(),
+                    PyOperator(func=setDad, reps=2)]),
+                gen=3)
+            res = []
+            for p in simu.populations():
+                for gen in range(p.ancestralGens() + 1):
+                    p.useAncestralGen(gen)
+                    res.append(list(p.genotype()))
+                p.useAncestralGen(0)
+            results.append(res)
+        self.assertEqual(results[0], results[1])
+        self.assertEqual(list(pop.genotype()), geno)
+        # changing one replicate does not change others
+        simu = Simulator(pop, rep=3, stealPops=False, shareGenotype=True)
+        simu1 = simu.clone()
+        simu.population(0).setGenotype([0])
+        self.assertEqual(list(simu.population(1).genotype()), geno)
+        rep = simu.extract(2)
+        rep.individual(0).setAllele(1, 0)
+        self.assertEqual(list(simu.population(1).genotype()), geno)
+        self.assertEqual(list(simu1.population(0).genotype()), geno)
+        self.assertEqual(list(simu1.population(2).genotype()), geno)
+        self.assertEqual(list(pop.genotype()), geno)
+
     def testExtract(self):
         'Testing Simulator::extract(rep), numRep()'
         pop = Population(size=[20, 80], loci=[3])
@@ -443,8 +443,37 @@ class TestMatingSchemes(unittest.TestCase):
         self.assertNotEqual(fi[0], fi[6])
         mi = simu.population(0).indInfo('mother_idx')
         self.assertEqual(mi[0], mi[1])
-        self.assertNotEqual(mi[0], mi[2])              
-       
+        self.assertNotEqual(mi[0], mi[2])
+
+    def testPolygamousMatingInParallel(self):
+        'Testing polygamous mating scheme with multiple threads'
+        numThreads = moduleInfo()['threads']
+        # the mating scheme is created before the number of threads is changed
+        mating = PolygamousMating(polySex=FEMALE, polyNum=3, numOffspring=2,
+            ops=[MendelianGenoTransmitter(), ParentsTagger()])
+        for threads in [1, 4]:
+            setOptions(numThreads=threads)
+            # offspring of each thread are multiples of 6
+            pop = Population(size=[240, 480], loci=[3,5], infoFields=['father_idx', 'mother_idx', 'fitness'])
+            initSex(pop)
+            # only every 7th individual can be chosen as parent
+            pop.setIndInfo([x % 7 == 0 for x in range(720)], 'fitness')
+            pop.evolve(matingScheme=mating, gen=1)
+            for sp, size in enumerate(pop.subPopSizes()):
+                fi = pop.indInfo('father_idx', subPop=sp)
+                mi = pop.indInfo('mother_idx', subPop=sp)
+                begin = pop.subPopBegin(sp)
+                for i in range(0, size, 6):
+                    # a mother mates with three fathers, two offspring each
+                    self.assertEqual(len(set(mi[i:i+6])), 1)
+                    self.assertEqual(fi[i], fi[i+1])
+                    for j in range(6):
+                        self.assertTrue(begin <= mi[i+j] < begin + size)
+                        self.assertTrue(begin <= fi[i+j] < begin + size)
+                        self.assertEqual(mi[i+j] % 7, 0)
+                        self.assertEqual(fi[i+j] % 7, 0)
+        setOptions(numThreads=numThreads)
+
     def testPedigreeMating(self):
         'Testing pedigree mating using a population object'
         pop = Population(size=[100, 100], loci=[2, 5], ancGen=-1,
@@ -455,6 +484,44 @@ class TestMatingSchemes(unittest.TestCase):
             gen = 20
         )
 
+    def testPedigreeMatingReplay(self):
+        'Testing pedigree mating that replays an existing pedigree'
+        ped = Population(size=[100, 200], ancGen=-1,
+            infoFields=['ind_id', 'father_id', 'mother_id'])
+        ped.evolve(
+            initOps=[InitSex(), IdTagger()],
+            matingScheme=RandomMating(ops=[IdTagger(), PedigreeTagger()]),
+            gen=5)
+        ped.asPedigree()
+        N = ped.ancestralGens()
+        IDs = [x.ind_id for x in ped.allIndividuals(ancGens=N)]
+        sex = [x.sex() for x in ped.allIndividuals(ancGens=N)]
+        # founders in the order of the pedigree, in reversed order, and
+        # without the father of the first individual of the next generation
+        ped.useAncestralGen(N-1)
+        missing = ped.individual(0).father_id
+        ped.useAncestralGen(0)
+        for order in [IDs, IDs[::-1], [x for x in IDs if x != missing]]:
+            pop = Population(size=len(order), loci=2,
+                infoFields=['ind_id', 'father_id', 'mother_id'])
+            initInfo(pop, order, infoFields='ind_id')
+            initSex(pop, sex=[sex[IDs.index(x)] for x in order])
+            if len(order) != len(IDs):
+                self.assertRaises(RuntimeError, pop.evolve,
+                    matingScheme=PedigreeMating(ped,
+                        ops=[MendelianGenoTransmitter(), PedigreeTagger()]),
+                    gen=N)
+                continue
+            pop.evolve(
+                matingScheme=PedigreeMating(ped,
+                    ops=[MendelianGenoTransmitter(), PedigreeTagger()]),
+                gen=N)
+            self.assertEqual(pop.indInfo('ind_id'), ped.indInfo('ind_id'))
+            self.assertEqual(pop.indInfo('father_id'), ped.indInfo('father_id'))
+            self.assertEqual(pop.indInfo('mother_id'), ped.indInfo('mother_id'))
+            self.assertEqual([x.sex() for x in pop.individuals()],
+                [x.sex() for x in ped.individuals()])
+
     def testSequentialParentsChooser(self):
         'Testing sequential parent chooser'
         pop = Population(size=[100, 200], infoFields=['parent_idx'])
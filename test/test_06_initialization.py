@@ -114,6 +114,10 @@ class TestInitialization(unittest.TestCase):
                 self.assertEqual(ind.sex(), MALE)
             else:
                 self.assertEqual(ind.sex(), FEMALE)
+        # default maleFreq
+        initSex(pop)
+        count = len([x for x in pop.individuals() if x.sex() == MALE])
+        self.assertTrue(count > 600 and count < 900)
         # maleFreq
         initSex(pop, maleFreq=0.3)
         count = 0
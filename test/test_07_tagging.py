@@ -8,7 +8,7 @@
 # $LastChangedDate$
 #
 
-import unittest, os, sys
+import unittest, os, sys, random
 from simuOpt import setOptions
 setOptions(quiet=True)
 new_argv = []
@@ -79,6 +79,44 @@ class TestTagger(unittest.TestCase):
                 li = 0
             self.assertEqual(ind.offspring_idx, li)
 
+    def testIdTagger(self):
+        'Testing id tagger'
+        pop = Population(size=[500,1000], loci=[2,4], ancGen=1,
+            infoFields=['ind_id', 'father_id', 'mother_id'])
+        IdTagger().reset(1)
+        IdTagger().apply(pop)
+        self.assertEqual(pop.indInfo('ind_id'), tuple(range(1, 1501)))
+        pop.evolve(
+            initOps = InitSex(),
+            matingScheme = RandomMating(
+                ops=[MendelianGenoTransmitter(), IdTagger(), PedigreeTagger()]),
+            gen = 2
+        )
+        # offspring get consecutive IDs in the order they are stored,
+        # regardless of the number of threads used
+        self.assertEqual(pop.indInfo('ind_id'), tuple(range(3001, 4501)))
+        pop.useAncestralGen(1)
+        self.assertEqual(pop.indInfo('ind_id'), tuple(range(1501, 3001)))
+        pop.useAncestralGen(0)
+        for ind in pop.individuals():
+            self.assertTrue(ind.father_id < ind.ind_id)
+            self.assertTrue(ind.mother_id < ind.ind_id)
+        # discarded offspring do not use up IDs
+        pop.evolve(
+            matingScheme = RandomMating(
+                ops=[MendelianGenoTransmitter(), IdTagger(),
+                    DiscardIf(lambda: random.random() < 0.5)]),
+            gen = 1
+        )
+        self.assertEqual(pop.indInfo('ind_id'), tuple(range(4501, 6001)))
+        # IDs are only assigned to offspring in a subpopulation
+        pop.evolve(
+            matingScheme = RandomMating(
+                ops=[MendelianGenoTransmitter(), IdTagger(subPops=1)]),
+            gen = 1
+        )
+        self.assertEqual(sorted(pop.indInfo('ind_id', subPop=1)), list(range(6001, 7001)))
+
 
     def testInheritTagger(self):
         'Testing inherit tagger (pass info from parents to offspring'
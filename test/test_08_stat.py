@@ -26,7 +26,7 @@ for arg in sys.argv:
 sys.argv=new_argv
 from simuPOP import *
 from simuPOP.utils import export
-from simuPOP.gsl import gsl_cdf_chisq_Pinv
+from simuPOP.gsl import gsl_cdf_chisq_Pinv, gsl_cdf_chisq_P
 
 try:
     import rpy
@@ -695,6 +695,116 @@ class TestStat(unittest.TestCase):
             self.assertAlmostEqual(CramerV(pop.dvars(sp), 2, 4), pop.dvars(sp).CramerV[2][4])
 
 
+    def testAssociation(self):
+        '''Testing association tests for di- and multi-allelic loci'''
+        def chisq(table):
+            cols = [j for j in range(len(table[0])) if table[0][j] + table[1][j] > 0]
+            N = sum([sum(row) for row in table]) * 1.
+            rowSum = [sum(row) for row in table]
+            res = 0
+            for i in range(2):
+                for j in cols:
+                    colSum = table[0][j] + table[1][j]
+                    if rowSum[i] > 0:
+                        e = rowSum[i] * colSum / N
+                        res += (table[i][j] - e) ** 2 / e
+            return res
+        def counts(pop, loc, subPop=[]):
+            alleles = set()
+            genos = set()
+            aCnt = [{}, {}]
+            gCnt = [{}, {}]
+            for ind in pop.individuals(subPop):
+                c = 0 if ind.affected() else 1
+                a1, a2 = ind.allele(loc, 0), ind.allele(loc, 1)
+                for a in (a1, a2):
+                    aCnt[c][a] = aCnt[c].get(a, 0) + 1
+                    alleles.add(a)
+                g = (min(a1, a2), max(a1, a2))
+                gCnt[c][g] = gCnt[c].get(g, 0) + 1
+                genos.add(g)
+            return ([[aCnt[c].get(a, 0) for a in sorted(alleles)] for c in range(2)],
+                [[gCnt[c].get(g, 0) for g in sorted(genos)] for c in range(2)])
+        # more than one block of loci
+        pop = Population(size=[300, 200], ploidy=2, loci=[150])
+        initGenotype(pop, freq=[.3, .7])
+        initSex(pop)
+        for ind in pop.individuals():
+            ind.setAffected(randint(0, 1) == 1)
+        if moduleInfo()['alleleType'] != 'binary':
+            # multi-allelic loci are handled differently
+            initGenotype(pop, freq=[.2, .3, .5], loci=[5, 140])
+        stat(pop, association=ALL_AVAIL, vars=['Allele_ChiSq', 'Allele_ChiSq_p',
+            'Geno_ChiSq', 'Geno_ChiSq_p', 'Allele_ChiSq_sp', 'Geno_ChiSq_sp'])
+        for loc in [0, 5, 64, 65, 140, 149]:
+            aTable, gTable = counts(pop, loc)
+            self.assertAlmostEqual(pop.dvars().Allele_ChiSq[loc], chisq(aTable))
+            self.assertAlmostEqual(pop.dvars().Geno_ChiSq[loc], chisq(gTable))
+            self.assertAlmostEqual(pop.dvars().Allele_ChiSq_p[loc],
+                1 - gsl_cdf_chisq_P(chisq(aTable), len(aTable[0]) - 1))
+            for sp in range(2):
+                aTable, gTable = counts(pop, loc, sp)
+                self.assertAlmostEqual(pop.dvars(sp).Allele_ChiSq[loc], chisq(aTable))
+                self.assertAlmostEqual(pop.dvars(sp).Geno_ChiSq[loc], chisq(gTable))
+        # Armitage test for diallelic loci
+        stat(pop, association=[0, 64, 149], vars=['Armitage_p', 'Armitage_p_sp'])
+        for loc in [0, 64, 149]:
+            self.assertTrue(0 <= pop.dvars().Armitage_p[loc] <= 1)
+            self.assertTrue(0 <= pop.dvars(1).Armitage_p[loc] <= 1)
+        if moduleInfo()['alleleType'] != 'binary':
+            self.assertRaises(ValueError, stat, pop, association=5, vars='Armitage_p')
+        # the same results are obtained for loci that appear in any order
+        stat(pop, association=[149, 0, 64], vars='Allele_ChiSq', suffix='_r')
+        for loc in [0, 64, 149]:
+            self.assertAlmostEqual(pop.dvars().Allele_ChiSq[loc], pop.dvars().Allele_ChiSq_r[loc])
+
+    def testHWE(self):
+        '''Testing exact HWE test and IBS frequency'''
+        def hwe(cnt):
+            n = sum(cnt)
+            rare = min(2 * cnt[0] + cnt[1], 2 * cnt[2] + cnt[1])
+            lfact = lambda x: math.lgamma(x + 1)
+            probs = {}
+            for h in range(rare % 2, rare + 1, 2):
+                r = (rare - h) // 2
+                c = n - h - r
+                probs[h] = math.exp(lfact(n) - lfact(r) - lfact(h) - lfact(c) + h * math.log(2)
+                    + lfact(rare) + lfact(2 * n - rare) - lfact(2 * n))
+            top = sum([p for h, p in probs.items() if h >= cnt[1]])
+            other = sum([p for h, p in probs.items() if h <= cnt[1]])
+            if top > 0.5 and other > 0.5:
+                return 1.
+            return 2 * min(top, other)
+        def counts(pop, loc, subPop=[]):
+            cnt = {}
+            for ind in pop.individuals(subPop):
+                g = tuple(sorted([ind.allele(loc, 0), ind.allele(loc, 1)]))
+                cnt[g] = cnt.get(g, 0) + 1
+            hom = [v for g, v in sorted(cnt.items()) if g[0] == g[1]]
+            het = sum([v for g, v in cnt.items() if g[0] != g[1]])
+            hom += [0] * (2 - len(hom))
+            return [hom[0], het, hom[1]]
+        pop = Population(size=[400, 300], ploidy=2, loci=[100])
+        initGenotype(pop, freq=[.2, .8])
+        initGenotype(pop, genotype=[0, 0], loci=[7])
+        # individuals with excess heterozygotes
+        initGenotype(pop, genotype=[0, 1], loci=70)
+        if moduleInfo()['alleleType'] != 'binary':
+            initGenotype(pop, freq=[0, .4, .6], loci=[20, 90])
+        stat(pop, HWE=ALL_AVAIL, inbreeding=ALL_AVAIL, vars=['HWE', 'HWE_sp', 'IBS_freq', 'IBS_freq_sp'])
+        for loc in [0, 7, 20, 63, 64, 70, 90, 99]:
+            self.assertAlmostEqual(pop.dvars().HWE[loc], hwe(counts(pop, loc)))
+            self.assertAlmostEqual(pop.dvars().IBS_freq[loc],
+                sum([ind.allele(loc, 0) == ind.allele(loc, 1) for ind in pop.individuals()]) / 700.)
+            for sp in range(2):
+                self.assertAlmostEqual(pop.dvars(sp).HWE[loc], hwe(counts(pop, loc, sp)))
+                self.assertAlmostEqual(pop.dvars(sp).IBS_freq[loc],
+                    sum([ind.allele(loc, 0) == ind.allele(loc, 1) for ind in pop.individuals(sp)]) /
+                        float(pop.subPopSize(sp)))
+        self.assertEqual(pop.dvars().HWE[7], 1.)
+        self.assertTrue(pop.dvars().HWE[70] < 1e-10)
+        self.assertEqual(pop.dvars().IBS_freq[70], 0.)
+
     def testCombinedStats(self):
         '''Testing dependency of combined statistics'''
         pop = Population(size=[500,100,1000], ploidy=2, loci = [5])
@@ -710,6 +820,33 @@ class TestStat(unittest.TestCase):
         pop.dvars().haploFreq[(1, 2)]
         pop.dvars().haploFreq[(1, 3)]
 
+    def testSharedGenotypeCounts(self):
+        '''Testing statistics calculated from shared genotype counts'''
+        pop = Population(size=[500, 300], ploidy=2, loci=[80, 40],
+            infoFields='x')
+        initSex(pop)
+        initGenotype(pop, freq=[.3, .7])
+        if moduleInfo()['alleleType'] != 'binary':
+            initGenotype(pop, freq=[0, .4, .6], loci=range(70, 90))
+        pop.setIndInfo([randint(0, 1) for x in range(pop.popSize())], 'x')
+        pop.setVirtualSplitter(InfoSplitter(field='x', values=[0, 1]))
+        for subPops in [ALL_AVAIL, [(0, 0), (0, 1), 1]]:
+            stats = dict(alleleFreq=range(60, 110), heteroFreq=range(20, 100),
+                homoFreq=[5, 100], structure=range(50), HWE=ALL_AVAIL,
+                inbreeding=range(30, 120))
+            vars = ['alleleNum', 'alleleFreq', 'alleleNum_sp', 'alleleFreq_sp',
+                'heteroNum', 'heteroFreq', 'homoNum', 'homoFreq', 'heteroNum_sp',
+                'heteroFreq_sp', 'homoNum_sp', 'homoFreq_sp', 'F_st', 'f_st',
+                'G_st', 'HWE', 'HWE_sp', 'IBS_freq', 'IBS_freq_sp']
+            # all statistics at once
+            pop1 = pop.clone()
+            stat(pop1, subPops=subPops, vars=vars, **stats)
+            # one statistic at a time
+            pop2 = pop.clone()
+            for key, value in stats.items():
+                stat(pop2, subPops=subPops, vars=vars, **{key: value})
+            self.assertEqual(pop1.vars(), pop2.vars())
+
     def pairwiseDiff(self, sample, loci):
         'Calculating pairwise difference'
         diff = []
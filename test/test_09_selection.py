@@ -1060,6 +1060,45 @@ class TestSelector(unittest.TestCase):
         self.assertLess(pop.dvars().alleleFreq[0][1], 0.9)
         self.assertGreater(pop.dvars().alleleFreq[0][1], 0.8)
 
+    def testMutSpaceSelector(self):
+        'Testing fitness values assigned by MutSpaceSelector with multiple threads'
+        if moduleInfo()['alleleType'] != 'long':
+            return
+        # mutational space operators are only defined in long allele modules
+        import simuPOP, random
+        random.seed(12345)
+        pop = Population(size=200, loci=20, infoFields='fitness')
+        # up to 20 distinct mutant locations (alleles) on each haplotype
+        for ind in pop.individuals():
+            for p in range(2):
+                ind.setGenotype(random.sample(range(1, 200), random.randint(0, 20)) + [0] * 20, p)
+        # expected fitness under a constant selection coefficient
+        s, h = 0.01, 0.2
+        fit = []
+        for ind in pop.individuals():
+            f = 1.
+            geno = [x for x in ind.genotype() if x != 0]
+            for mut in set(geno):
+                f *= 1 - s if geno.count(mut) == 2 else 1 - h * s
+            fit.append(f)
+        numThreads = moduleInfo()['threads']
+        for selDist, mode in [([CONSTANT, s, h], MULTIPLICATIVE),
+                ([GAMMA_DISTRIBUTION, 0.01, 0.5, 0.3], MULTIPLICATIVE),
+                ([GAMMA_DISTRIBUTION, 0.01, 0.5], ADDITIVE),
+                ([GAMMA_DISTRIBUTION, 0.01, 0.5, 0.3], EXPONENTIAL)]:
+            fitness = []
+            for nThreads in [1, 4]:
+                setOptions(numThreads=nThreads, seed=1234)
+                pop1 = pop.clone()
+                simuPOP.MutSpaceSelector(selDist=selDist, mode=mode).apply(pop1)
+                fitness.append(pop1.indInfo('fitness'))
+            # fitness values do not depend on the number of threads
+            self.assertEqual(fitness[0], fitness[1])
+            if selDist[0] == CONSTANT:
+                for x, y in zip(fitness[0], fit):
+                    self.assertAlmostEqual(x, y)
+        setOptions(numThreads=numThreads)
+
 
 
 if __name__ == '__main__':
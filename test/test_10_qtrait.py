@@ -68,6 +68,61 @@ class TestQuanTrait(unittest.TestCase):
             return random.normalvariate(0, 0.5*sum(geno) ), 1
         pyQuanTrait(pop, loci=[2,6], func=qt1, infoFields=['qtrait1', 'qtrait2'])
 
+    def testAdditiveQuanTrait(self):
+        'Testing the additive quantitative trait operator'
+        pop = Population(1000, loci=[3,5], infoFields=['qtrait'])
+        initGenotype(pop, freq=[.3, .5, .2])
+        effects = [[0, 0.5, 1], [0.2, -0.1]]
+        additiveQuanTrait(pop, loci=[2,6], effects=effects, infoFields='qtrait')
+        for ind in pop.individuals():
+            value = sum([effects[0][ind.allele(2, p)] for p in range(2)])
+            value += sum([(effects[1] + [0])[ind.allele(6, p)] for p in range(2)])
+            self.assertAlmostEqual(ind.qtrait, value)
+        # dominance
+        additiveQuanTrait(pop, loci=[2,6], effects=effects, dominance=[1, -0.5],
+            infoFields='qtrait')
+        for ind in pop.individuals():
+            value = 0
+            for idx, (loc, d) in enumerate([(2, 1), (6, -0.5)]):
+                e = [(effects[idx] + [0])[ind.allele(loc, p)] for p in range(2)]
+                value += sum(e) + d * abs(e[0] - e[1])
+            self.assertAlmostEqual(ind.qtrait, value)
+        # the same effects for all loci, with environmental variance
+        additiveQuanTrait(pop, loci=ALL_AVAIL, effects=[[0, 0, 0]], envVar=4,
+            infoFields='qtrait')
+        trait = pop.indInfo('qtrait')
+        self.assertTrue(abs(sum(trait) / len(trait)) < 0.3)
+        self.assertTrue(1.7 < self.stdev(trait) < 2.3)
+        # male chromosome X contributes only one copy
+        pop = Population(1000, loci=[2, 2], chromTypes=[AUTOSOME, CHROMOSOME_X],
+            infoFields='qtrait')
+        initSex(pop)
+        initGenotype(pop, freq=[.5, .5])
+        pop.evolve(matingScheme=RandomMating(ops=[MendelianGenoTransmitter(),
+            AdditiveQuanTrait(loci=[1, 3], effects=[[0, 1]], infoFields='qtrait')]),
+            gen=1)
+        for ind in pop.individuals():
+            value = ind.allele(1, 0) + ind.allele(1, 1) + ind.allele(3, 0)
+            if ind.sex() == FEMALE:
+                value += ind.allele(3, 1)
+            self.assertAlmostEqual(ind.qtrait, value)
+        # effects and dominance coefficients for all or each of the loci
+        self.assertRaises(ValueError, additiveQuanTrait, pop, loci=[0, 1, 2],
+            effects=[[0, 1], [0, 1]], infoFields='qtrait')
+        self.assertRaises(ValueError, additiveQuanTrait, pop, loci=[0, 1, 2],
+            effects=[[0, 1]], dominance=[0, 1], infoFields='qtrait')
+        self.assertRaises(ValueError, pop.evolve,
+            matingScheme=RandomMating(ops=[MendelianGenoTransmitter(),
+            AdditiveQuanTrait(loci=[0, 1, 2], effects=[[0, 1], [0, 1]], infoFields='qtrait')]),
+            gen=1)
+        self.assertRaises(ValueError, AdditiveQuanTrait, loci=[0], effects=[[0, 1]],
+            envVar=-1, infoFields='qtrait')
+        self.assertRaises(ValueError, AdditiveQuanTrait, loci=[0], effects=[])
+        # exactly one trait field
+        self.assertRaises(ValueError, AdditiveQuanTrait, loci=[0], effects=[[0, 1]])
+        self.assertRaises(ValueError, AdditiveQuanTrait, loci=[0], effects=[[0, 1]],
+            infoFields=['a', 'b'])
+
     def testAncestralGen(self):
         'Testing parameter ancestralGen of qtrait... (FIXME)'
         # test the ancestralGen parameter of qtrait
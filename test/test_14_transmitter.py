@@ -8,7 +8,7 @@
 # $LastChangedDate$
 #
 
-import unittest, os, sys
+import unittest, os, sys, hashlib
 from simuOpt import setOptions
 setOptions(quiet=True)
 new_argv = []
@@ -1051,6 +1051,37 @@ class TestTransmitters(unittest.TestCase):
         #     "Expression abs(simu.dvars(0).haploFreq[(3,6)].setdefault((a1,a2), 0) - 0.25) (test value %f) be less than 0.01. This test may occasionally fail due to the randomness of outcome." % (abs(simu.dvars(0).haploFreq[(3,6)].setdefault((a1,a2), 0) - 0.25)))
 
 
+    def testSexChromWithConversion(self):
+        'Testing transmission of sex chromosomes with frequent recombination and conversion'
+        if moduleInfo()['alleleType'] == 'binary':
+            a1, a2 = 0, 1
+        else:
+            a1, a2 = 1, 2
+        pop = Population(200, loci=[10, 6, 5, 10],
+            chromTypes=[AUTOSOME, CHROMOSOME_X, CHROMOSOME_Y, AUTOSOME])
+        initSex(pop)
+        pop.individual(0).setSex(MALE)
+        pop.individual(1).setSex(FEMALE)
+        initGenotype(pop, genotype=[a1]*31 + [a2]*31)
+        applyDuringMatingOperator(Recombinator(rates=0.4, convMode=(NUM_MARKERS, 0.5, 2)),
+            pop, pop, dad = 0, mom = 1, off=(2, pop.popSize()))
+        X = list(range(10, 16))
+        Y = list(range(16, 21))
+        for idx in range(2, pop.popSize()):
+            ind = pop.individual(idx)
+            if ind.sex() == MALE:
+                # chromosome X from mother, Y from the second copy of father
+                self.assertEqual([ind.allele(x, 1) for x in X], [0]*6)
+                self.assertEqual([ind.allele(x, 1) for x in Y], [a2]*5)
+            else:
+                # chromosome X from the first copy of father, no Y
+                self.assertEqual([ind.allele(x, 1) for x in X], [a1]*6)
+                self.assertEqual([ind.allele(x, 1) for x in Y], [0]*5)
+            self.assertEqual([ind.allele(x, 0) for x in Y], [0]*5)
+            for x in list(range(10)) + list(range(21, 31)):
+                self.assertTrue(ind.allele(x, 0) in [a1, a2])
+                self.assertTrue(ind.allele(x, 1) in [a1, a2])
+
     def testRecProportion(self):
         'Testing table 4 of H&C 3nd edition P49 '
         N = 100000
@@ -1149,6 +1180,57 @@ class TestTransmitters(unittest.TestCase):
         for ind in simu.population(0).individuals():
             self.assertEqual(ind.genotype(1), [0]*8)
 
+    def testRecombinatorReference(self):
+        'Testing offspring genotypes of Recombinator with fixed seeds'
+        def transmit(rec, numOff=50, ploidy=2, chromTypes=[], haplodiploid=False, seed=0):
+            # parental chromosomes are all 0 or all 1, so offspring genotypes
+            # record where recombination and conversion happened
+            pop = Population(size=numOff + 2, ploidy=ploidy,
+                loci=[15, 20, 10][:3 if chromTypes else 2], chromTypes=chromTypes)
+            initSex(pop, sex=[FEMALE, MALE])
+            mom, dad = pop.individual(0), pop.individual(1)
+            for ind in (mom, dad):
+                ind.setGenotype([0], 0)
+                ind.setGenotype([1], 1)
+            getRNG().set(seed=seed)
+            geno = []
+            for i in range(numOff):
+                off = pop.individual(i + 2)
+                rec.transmitGenotype(mom, off, 0)
+                if not haplodiploid:
+                    rec.transmitGenotype(dad, off, 1)
+                geno.extend(off.genotype())
+            return hashlib.md5(''.join(str(x) for x in geno).encode()).hexdigest()
+        # reference values were produced by the implementation of Recombinator
+        # before crossover points were collected by a shared routine
+        sexChroms = [AUTOSOME, CHROMOSOME_X, CHROMOSOME_Y]
+        for rec, kwargs, ref in [
+                # uniform and loci-specific rates
+                (Recombinator(rates=0.1), {'seed': 123},
+                    '298474513cb9693c983a7b3b766e4bb2'),
+                (Recombinator(rates=[0.1, 0.3, 0.05], loci=[2, 7, 20]), {'seed': 234},
+                    'cfd128b04b645e32dbdea06884b01202'),
+                (Recombinator(rates=0.001), {'numOff': 500, 'seed': 345},
+                    '2144957bdf18a1ea470801971e579915'),
+                (Recombinator(intensity=0.05), {'seed': 456},
+                    '58f0e56b697aeabb4ae1d3f9bfa298d7'),
+                # gene conversion
+                (Recombinator(rates=0.1, convMode=(NUM_MARKERS, 0.5, 2)), {'seed': 567},
+                    'a352bd38dedb5bd9b5f6e2750cb77c71'),
+                (Recombinator(rates=0.1, convMode=(TRACT_LENGTH, 0.5, 3)), {'seed': 678},
+                    '937425bc3af478f9e7985c7125f24f84'),
+                # sex chromosomes
+                (Recombinator(rates=0.1), {'chromTypes': sexChroms, 'seed': 789},
+                    '266c4eee422f3e06b587e737bcdb474c'),
+                (Recombinator(rates=0.1, convMode=(NUM_MARKERS, 0.5, 2)),
+                    {'chromTypes': sexChroms, 'seed': 890},
+                    '6231d4bd4ed8929ac5f6a339b5762a9f'),
+                # maternal chromosomes of haplodiploid offspring
+                (Recombinator(rates=0.1), {'ploidy': HAPLODIPLOID, 'haplodiploid': True, 'seed': 901},
+                    '4abc3cc32875bca2021efd355b9ddcd3'),
+            ]:
+            self.assertEqual(transmit(rec, **kwargs), ref)
+
     def testLineage(self):
         'Testing the transmission of lineage information'
         # pretend that we advance a generation
@@ -1164,6 +1246,46 @@ class TestTransmitters(unittest.TestCase):
         MendelianGenoTransmitter().transmitGenotype(dad, child, 1)
         # test lineage assignment in genotype transition
         self.assertEqual(child.lineage(), (list(mom.lineage(0)) + list(dad.lineage(1))))
+
+    def testGenealogy(self):
+        'Testing the recording of genealogy during mating'
+        for interval in [0, 3]:
+            pop = Population(size=50, loci=[20, 10], infoFields='ind_id')
+            initSex(pop)
+            initGenotype(pop, freq=[0.5, 0.5])
+            tagID(pop, reset=True)
+            founders = {}
+            for ind in pop.individuals():
+                for p in range(2):
+                    founders[int(ind.ind_id) * 2 + p] = list(ind.genotype(p))
+            pop.recordGenealogy('ind_id', simplifyInterval=interval)
+            pop.evolve(
+                matingScheme=RandomMating(ops=[IdTagger(), Recombinator(rates=0.05)]),
+                gen=10)
+            genealogy = pop.genealogy()
+            genealogy.simplify(pop)
+            self.assertEqual(len(genealogy.samples()), 2 * pop.popSize())
+            edges = {}
+            for left, right, parent, child in genealogy.edges():
+                self.assertTrue(left < right)
+                edges.setdefault(child, []).append((left, right, parent))
+            # every locus of every present haplotype can be traced to a founder
+            for ind in pop.individuals():
+                for p in range(2):
+                    geno = ind.genotype(p)
+                    for loc in range(pop.totNumLoci()):
+                        node = int(ind.ind_id) * 2 + p
+                        while node not in founders:
+                            parents = [x[2] for x in edges[node] if x[0] <= loc < x[1]]
+                            self.assertEqual(len(parents), 1)
+                            node = parents[0]
+                        self.assertEqual(geno[loc], founders[node][loc])
+            # neutral mutations are carried by present haplotypes only
+            samples = set(genealogy.samples())
+            for pos, node, carriers in genealogy.mutate(0.01):
+                self.assertTrue(0 <= pos < pop.totNumLoci())
+                self.assertTrue(len(carriers) > 0)
+                self.assertTrue(set(carriers).issubset(samples))
        
         
 if __name__ == '__main__':